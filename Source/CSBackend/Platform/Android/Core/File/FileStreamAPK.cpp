@@ -40,7 +40,7 @@ namespace CSBackend
 		/// Constructor
 		//--------------------------------------------------------------------------------------------------
 		FileStreamAPK::FileStreamAPK(std::mutex* inpMinizipMutex)
-			: mbOpen(false), mbError(false), mUnzipper(nullptr), mpMinizipMutex(inpMinizipMutex), mpDataBuffer(nullptr)
+			: mbOpen(false), mbError(false), mUnzipper(nullptr), mpMinizipMutex(inpMinizipMutex), mpDataBuffer(nullptr), mudwDataSize(0)
 		{
 		}
 		//--------------------------------------------------------------------------------------------------
@@ -94,6 +94,7 @@ namespace CSBackend
 
 					//load the file into memory
 					mpDataBuffer = new s8[info.uncompressed_size];
+					mudwDataSize = info.uncompressed_size;
 					unzReadCurrentFile(mUnzipper, (voidp)mpDataBuffer, info.uncompressed_size);
 
 					//create a string stream for reading from it.
@@ -143,6 +144,7 @@ namespace CSBackend
 			{
 				delete[] mpDataBuffer;
 				mpDataBuffer = nullptr;
+				mudwDataSize = 0;
 			}
 
 			if (mbOpen == true && mbError == false)
@@ -361,6 +363,20 @@ namespace CSBackend
 		{
 			mStringStream.flush();
 		}
+		//--------------------------------------------------------------------------------------------------
+		/// Try Get View
+		//--------------------------------------------------------------------------------------------------
+		bool FileStreamAPK::TryGetView(const s8*& out_data, u32& out_size) const
+		{
+			if (mbOpen == false || mbError == true || mpDataBuffer == nullptr)
+			{
+				return false;
+			}
+
+			out_data = mpDataBuffer;
+			out_size = mudwDataSize;
+			return true;
+		}
 							 
 		//--------------------------------------------------------------------------------------------------
 		/// Get File Mode
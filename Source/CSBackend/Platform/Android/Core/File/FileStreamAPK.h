@@ -295,6 +295,18 @@ namespace CSBackend
 			/// Synchronises the associated buffer with the stream.
 			//--------------------------------------------------------------------------------------------------
 			void Flush() override;
+			//--------------------------------------------------------------------------------------------------
+			/// Try Get View
+			///
+			/// The file is decompressed into memory when opened, so a view of it can always be provided
+			/// while the stream is open.
+			///
+			/// @param [Out] Pointer to the start of the file data.
+			/// @param [Out] The size of the file data in bytes.
+			///
+			/// @return Whether or not a view could be provided.
+			//--------------------------------------------------------------------------------------------------
+			bool TryGetView(const s8*& out_data, u32& out_size) const override;
 		protected:
 			//--------------------------------------------------------------------------------------------------
 			/// Constructor
@@ -338,6 +350,7 @@ namespace CSBackend
 			bool mbOpen;
 
 			s8 * mpDataBuffer;
+			u32 mudwDataSize;
 			CSCore::FileMode meFileMode;
 			std::stringstream mStringStream;
 		};
@@ -37,6 +37,7 @@
 #include <ChilliSource/Core/Base/Utils.h>
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
 #include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/File/MemoryMappedFileStream.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 
 #include <cstdio>
@@ -435,6 +436,18 @@ namespace CSBackend
 					default:
 					{
 						std::string filePath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+
+						//binary files on disk are memory mapped, falling back on a standard stream if mapping fails.
+						if (in_fileMode == CSCore::FileMode::k_readBinary)
+						{
+							CSCore::FileStreamUPtr mappedFileStream = CSCore::FileStreamUPtr(new CSCore::MemoryMappedFileStream());
+							mappedFileStream->Open(filePath, in_fileMode);
+							if (mappedFileStream->IsOpen() == true)
+							{
+								return mappedFileStream;
+							}
+						}
+
 						CSCore::FileStreamUPtr fileStream = CSCore::FileStreamUPtr(new CSCore::FileStream());
 						fileStream->Open(filePath, in_fileMode);
 						return fileStream;
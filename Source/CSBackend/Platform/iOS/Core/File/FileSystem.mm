@@ -32,6 +32,7 @@
 
 #import <CSBackend/Platform/iOS/Core/String/NSStringUtils.h>
 
+#import <ChilliSource/Core/File/MemoryMappedFileStream.h>
 #import <ChilliSource/Core/String/StringUtils.h>
 
 #import <iostream>
@@ -299,6 +300,18 @@ namespace CSBackend
             else
             {
                 std::string filePath = GetAbsolutePathToFile(in_storageLocation, in_filePath);
+                
+                //binary files are memory mapped, falling back on a standard stream if mapping fails.
+                if (in_fileMode == CSCore::FileMode::k_readBinary)
+                {
+                    CSCore::FileStreamUPtr mappedFileStream = CSCore::FileStreamUPtr(new CSCore::MemoryMappedFileStream());
+                    mappedFileStream->Open(filePath, in_fileMode);
+                    if (mappedFileStream->IsOpen() == true)
+                    {
+                        return mappedFileStream;
+                    }
+                }
+                
                 fileStream->Open(filePath, in_fileMode);
             }
             
@@ -151,10 +151,18 @@ namespace CSBackend
                     return;
                 }
                 
+                //parse directly from the file data if the stream holds it in memory, otherwise read it all first.
+                const s8* pbyData = nullptr;
+                u32 udwDataSize = 0;
                 std::string abyData;
-                pImageFile->GetAll(abyData);
+                if(pImageFile->TryGetView(pbyData, udwDataSize) == false)
+                {
+                    pImageFile->GetAll(abyData);
+                    pbyData = abyData.data();
+                    udwDataSize = abyData.size();
+                }
                 
-                CreatePNGImageFromFile(abyData.data(), abyData.size(), (CSCore::Image*)out_resource.get());
+                CreatePNGImageFromFile(pbyData, udwDataSize, (CSCore::Image*)out_resource.get());
                 
                 out_resource->SetLoadState(CSCore::Resource::LoadState::k_loaded);
                 if(in_delegate != nullptr)
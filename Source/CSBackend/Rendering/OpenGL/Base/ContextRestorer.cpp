@@ -35,31 +35,61 @@
 #include <CSBackend/Rendering/OpenGL/Texture/Texture.h>
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
+#include <ChilliSource/Rendering/Model/Mesh.h>
+#include <ChilliSource/Rendering/Model/SubMesh.h>
 #include <ChilliSource/Rendering/Shader/Shader.h>
 
+#include <unordered_set>
+
 namespace CSBackend
 {
     namespace OpenGL
     {
         //-----------------------------------------------------
         /// Shaders and most textures can be recreated from file,
-        /// however the mesh buffers must have a snap shot taken
+        /// as can the mesh buffers of meshes that were loaded
+        /// from file. Only the remaining mesh buffers must have
+        /// a snap shot taken.
         //-----------------------------------------------------
         void ContextRestorer::Backup()
         {
             if(m_hasContextBeenBackedUp == false)
             {
+                std::unordered_set<CSRendering::MeshBuffer*> fileMeshBuffers;
+                
+                auto allMeshes = CSCore::Application::Get()->GetResourcePool()->GetAllResources<CSRendering::Mesh>();
+                for (const auto& mesh : allMeshes)
+                {
+                    if (mesh->GetStorageLocation() != CSCore::StorageLocation::k_none)
+                    {
+                        for (u32 i = 0; i < mesh->GetNumSubMeshes(); ++i)
+                        {
+                            fileMeshBuffers.insert(mesh->GetSubMeshAtIndex(i)->GetInternalMeshBuffer());
+                        }
+                    }
+                }
+                
                 for(auto& buffer : m_meshBuffers)
                 {
-                    buffer->Backup();
+                    if (fileMeshBuffers.find(buffer) != fileMeshBuffers.end())
+                    {
+                        buffer->Discard();
+                    }
+                    else
+                    {
+                        buffer->Backup();
+                    }
                 }
                 
                 m_hasContextBeenBackedUp = true;
             }
         }
         //-----------------------------------------------------
-        /// Rebuild the shaders and textures from file. Re-upload
-        /// the mesh buffers
+        /// Rebuild the shaders from file and re-upload the
+        /// backed up textures and mesh buffers. Textures and
+        /// meshes that were loaded from file are re-read and
+        /// decoded in the background and are rebuilt once they
+        /// have loaded.
         //-----------------------------------------------------
         void ContextRestorer::Restore()
         {
@@ -79,25 +109,31 @@ namespace CSBackend
                 auto allTextures = resourcePool->GetAllResources<CSRendering::Texture>();
                 for (const auto& texture : allTextures)
 				{
+                    Texture* glTexture = static_cast<Texture*>(const_cast<CSRendering::Texture*>(texture.get()));
                     if (texture->GetStorageLocation() == CSCore::StorageLocation::k_none)
                     {
-                        Texture* glTexture = static_cast<Texture*>(const_cast<CSRendering::Texture*>(texture.get()));
                         glTexture->Restore();
                     }
+                    else
+                    {
+                        glTexture->Invalidate();
+                    }
                 }
-                resourcePool->RefreshResources<CSRendering::Texture>();
                 
                 //---Cubemaps
                 auto allCubemaps = resourcePool->GetAllResources<CSRendering::Cubemap>();
                 for (const auto& cubemap : allCubemaps)
 				{
+                    Cubemap* glCubemap = static_cast<Cubemap*>(const_cast<CSRendering::Cubemap*>(cubemap.get()));
 					if (cubemap->GetStorageLocation() == CSCore::StorageLocation::k_none)
                     {
-                        Cubemap* glCubemap = static_cast<Cubemap*>(const_cast<CSRendering::Cubemap*>(cubemap.get()));
                         glCubemap->Restore();
                     }
+                    else
+                    {
+                        glCubemap->Invalidate();
+                    }
                 }
-                resourcePool->RefreshResources<CSRendering::Cubemap>();
                 
                 //---Meshes
                 for(auto& buffer : m_meshBuffers)
@@ -105,6 +141,11 @@ namespace CSBackend
                     buffer->Restore();
                 }
                 
+                //---Resources from file
+                resourcePool->RefreshResourcesAsync<CSRendering::Texture>(nullptr);
+                resourcePool->RefreshResourcesAsync<CSRendering::Cubemap>(nullptr);
+                resourcePool->RefreshResourcesAsync<CSRendering::Mesh>(nullptr);
+                
                 m_hasContextBeenBackedUp = false;
             }
         }
@@ -62,13 +62,17 @@ namespace CSBackend
             //-----------------------------------------------------
             /// Take a snapshot of the GL context for resources
             /// that cannot be recreated from file and store them
-            /// so they can be recreated
+            /// so they can be recreated. No copy is kept of
+            /// resources that were loaded from file.
             ///
             /// @author S Downie
             //-----------------------------------------------------
             void Backup();
             //-----------------------------------------------------
-            /// Recreate the GL context with the backed up resources
+            /// Recreate the GL context with the backed up resources.
+            /// Textures, cubemaps and meshes that were loaded from
+            /// file are reloaded from file asynchronously and will
+            /// be in the loading state until they are rebuilt.
             ///
             /// @author S Downie
             //-----------------------------------------------------
@@ -48,7 +48,7 @@ namespace CSBackend
 		//-----------------------------------------------------
 		MeshBuffer::MeshBuffer(CSRendering::BufferDescription &inBuffDesc) 
         : CSRendering::MeshBuffer(inBuffDesc), mVertexBuffer(0), mIndexBuffer(0), mBufferUsage(0), mBufferAccess(0),
-          mpVertexData(nullptr), mpIndexData(nullptr), mpVertexDataBackup(nullptr), mpIndexDataBackup(nullptr), mbMapBufferAvailable(false), mbCacheValid(false)
+          mpVertexData(nullptr), mpIndexData(nullptr), mpVertexDataBackup(nullptr), mpIndexDataBackup(nullptr), mbMapBufferAvailable(false), mbCacheValid(false), mbDiscarded(false)
 		{
             mbMapBufferAvailable = CSCore::Application::Get()->GetSystem<CSRendering::RenderCapabilities>()->IsMapBufferSupported();
             
@@ -298,6 +298,21 @@ namespace CSBackend
                 UnlockIndex();
             }
             
+            mVertexBuffer = 0;
+			mIndexBuffer = 0;
+		}
+		//-----------------------------------------------------
+		/// Discard
+		///
+		/// Forgets the GL buffers on context loss without
+		/// taking a copy of their contents.
+		//-----------------------------------------------------
+		void MeshBuffer::Discard()
+		{
+            CS_SAFEDELETE_ARRAY(mpVertexDataBackup);
+            CS_SAFEDELETE_ARRAY(mpIndexDataBackup);
+            
+            mbDiscarded = true;
             mVertexBuffer = 0;
 			mIndexBuffer = 0;
 		}
@@ -312,6 +327,30 @@ namespace CSBackend
             //Force bind as we may have been bound from before context destruction
             MeshBuffer::pCurrentlyBoundBuffer = nullptr;
             
+            if(mbDiscarded == true)
+            {
+                //The contents will be re-populated by whoever owns the buffer so only the storage is needed.
+                glGenBuffers(1, &mVertexBuffer);
+                if(mBufferDesc.IndexDataCapacity > 0)
+                {
+                    glGenBuffers(1, &mIndexBuffer);
+                }
+                
+                Bind();
+                
+                glBufferData(GL_ARRAY_BUFFER, mBufferDesc.VertexDataCapacity, nullptr, mBufferUsage);
+                if(mIndexBuffer != 0)
+                {
+                    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mBufferDesc.IndexDataCapacity, nullptr, mBufferUsage);
+                }
+                
+                mbDiscarded = false;
+                mbCacheValid = false;
+                
+                CS_ASSERT_NOGLERROR("An OpenGL error occurred while restoring discarded mesh buffer.");
+                return;
+            }
+            
             if(mpVertexDataBackup == nullptr)
             {
                 return;
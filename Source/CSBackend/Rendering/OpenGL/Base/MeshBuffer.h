@@ -101,10 +101,21 @@ namespace CSBackend
 			//-----------------------------------------------------
 			void Backup();
 			//-----------------------------------------------------
+			/// Discard
+			///
+			/// Forgets the GL buffers on context loss without
+			/// taking a copy of their contents. This is used for
+			/// buffers that will be re-populated from file once
+			/// the context is restored.
+			//-----------------------------------------------------
+			void Discard();
+			//-----------------------------------------------------
 			/// Restore
 			///
 			/// Restore the mesh buffer data from the last
-			/// backup after the context has been re-created
+			/// backup after the context has been re-created. If
+			/// the buffer was discarded rather than backed up
+			/// empty buffers of the same capacity are created.
 			//-----------------------------------------------------
 			void Restore();
 			//-----------------------------------------------------
@@ -149,6 +160,7 @@ namespace CSBackend
 
             bool mbMapBufferAvailable;
             bool mbCacheValid;
+            bool mbDiscarded;
             
             static MeshBuffer* pCurrentlyBoundBuffer;
 		};
@@ -542,8 +542,10 @@ namespace CSBackend
         void RenderSystem::RenderVertexBuffer(CSRendering::MeshBuffer* inpBuffer, u32 inudwOffset, u32 inudwNumVerts, const CSCore::Matrix4& inmatWorld)
 		{
 #ifdef CS_ENABLE_DEBUGSTATS
-            CSCore::Application::Get()->GetDebugStats()->AddToEvent("DrawCalls", 1u);
-			CSCore::Application::Get()->GetDebugStats()->AddToEvent("Verts", inudwNumVerts);
+            static const CSDebugging::DebugStats::CounterHandle k_drawCallsCounter = CSDebugging::DebugStats::RegisterCounter("DrawCalls");
+            static const CSDebugging::DebugStats::CounterHandle k_vertsCounter = CSDebugging::DebugStats::RegisterCounter("Verts");
+            CSCore::Application::Get()->GetDebugStats()->IncrementCounter(k_drawCallsCounter);
+			CSCore::Application::Get()->GetDebugStats()->IncrementCounter(k_vertsCounter, inudwNumVerts);
 #endif
             
 			//Set the new model view matrix based on the camera view matrix and the object matrix
@@ -569,8 +571,10 @@ namespace CSBackend
         void RenderSystem::RenderBuffer(CSRendering::MeshBuffer* inpBuffer, u32 inudwOffset, u32 inudwNumIndices, const CSCore::Matrix4& inmatWorld)
 		{
 #ifdef CS_ENABLE_DEBUGSTATS
-            CSCore::Application::Get()->GetDebugStats()->AddToEvent("DrawCalls", 1u);
-            CSCore::Application::Get()->GetDebugStats()->AddToEvent("Verts", inpBuffer->GetVertexCount());
+            static const CSDebugging::DebugStats::CounterHandle k_drawCallsCounter = CSDebugging::DebugStats::RegisterCounter("DrawCalls");
+            static const CSDebugging::DebugStats::CounterHandle k_vertsCounter = CSDebugging::DebugStats::RegisterCounter("Verts");
+            CSCore::Application::Get()->GetDebugStats()->IncrementCounter(k_drawCallsCounter);
+            CSCore::Application::Get()->GetDebugStats()->IncrementCounter(k_vertsCounter, inpBuffer->GetVertexCount());
 #endif
             
 			//Set the new model view matrix based on the camera view matrix and the object matrix
@@ -428,6 +428,14 @@ namespace CSBackend
             SetWrapMode(sWrap, tWrap);
             SetFilterMode(filterMode);
         }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        void Cubemap::Invalidate()
+        {
+            CS_ASSERT(GetStorageLocation() != CSCore::StorageLocation::k_none, "Cannot invalidate cubemap that was not loaded from file. This should be handled using Restore().");
+            
+            m_cubemapHandle = 0;
+        }
 #endif
         //--------------------------------------------------
         //--------------------------------------------------
@@ -154,6 +154,13 @@ namespace CSBackend
             /// @author Ian Copland
             //--------------------------------------------------
             void Restore();
+            //--------------------------------------------------
+            /// Forgets the GL handle of a cubemap that was loaded
+            /// from file after the context has been lost. The
+            /// handle no longer refers to a valid cubemap so it
+            /// must not be deleted when the cubemap is rebuilt
+            /// from file.
+            //--------------------------------------------------
 #endif
             //--------------------------------------------------
             /// Destroys the cubemap and resets it to the state
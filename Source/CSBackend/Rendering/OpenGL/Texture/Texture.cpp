@@ -493,6 +493,14 @@ namespace CSBackend
             SetWrapMode(sWrap, tWrap);
             SetFilterMode(filterMode);
         }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        void Texture::Invalidate()
+        {
+            CS_ASSERT(GetStorageLocation() != CSCore::StorageLocation::k_none, "Cannot invalidate texture that was not loaded from file. This should be handled using Restore().");
+            
+            m_texHandle = 0;
+        }
 #endif
         //--------------------------------------------------
         //--------------------------------------------------
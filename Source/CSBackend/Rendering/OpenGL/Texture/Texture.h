@@ -164,6 +164,13 @@ namespace CSBackend
             /// @author Ian Copland
             //--------------------------------------------------
             void Restore();
+            //--------------------------------------------------
+            /// Forgets the GL handle of a texture that was loaded
+            /// from file after the context has been lost. The
+            /// handle no longer refers to a valid texture so it
+            /// must not be deleted when the texture is rebuilt
+            /// from file.
+            //--------------------------------------------------
 #endif
             //--------------------------------------------------
             /// Destroys the texture and resets it to the state
@@ -30,6 +30,7 @@
 
 #include <ChilliSource/Core/Base/AppConfig.h>
 #include <ChilliSource/Core/Base/Device.h>
+#include <ChilliSource/Core/Base/FrameAllocator.h>
 #include <ChilliSource/Core/Base/Logging.h>
 #include <ChilliSource/Core/Base/PlatformSystem.h>
 #include <ChilliSource/Core/Base/Screen.h>
@@ -50,6 +51,7 @@
 #ifdef CS_ENABLE_DEBUGSTATS
 #include <ChilliSource/Debugging/Base/DebugStats.h>
 #endif
+#include <ChilliSource/Debugging/Base/Profiler.h>
 
 #include <ChilliSource/GUI/Base/GUIViewFactory.h>
 
@@ -222,6 +224,8 @@ namespace ChilliSource
                 return;
             }
             
+            CS_PROFILE_SCOPE("Update");
+            
 #if CS_ENABLE_DEBUG
             //When debugging we may have breakpoints so restrict the time between
             //updates to something feasible.
@@ -251,6 +255,8 @@ namespace ChilliSource
             
             while((m_updateIntervalRemainder >= GetUpdateInterval()) || m_isFirstFrame)
             {
+                CS_PROFILE_SCOPE("FixedUpdate");
+                
                 m_updateIntervalRemainder -=  GetUpdateInterval();
                 
                 //update all of the application systems
@@ -277,11 +283,22 @@ namespace ChilliSource
                 return;
             }
             
-            //Render the scene
-            m_renderer->RenderToScreen(m_stateManager->GetActiveState()->GetScene());
+            {
+                CS_PROFILE_SCOPE("Render");
+                
+                //Render the scene
+                m_renderer->RenderToScreen(m_stateManager->GetActiveState()->GetScene());
+            }
+            
+            //Release everything allocated for this frame
+            m_frameAllocator->Reset();
             
 #ifdef CS_ENABLE_DEBUGSTATS
-            m_debugStats->Clear();
+            m_debugStats->EndFrame();
+#endif
+            
+#ifdef CS_ENABLE_PROFILING
+            m_profiler->EndFrame();
 #endif
         }
         //----------------------------------------------------
@@ -360,6 +377,8 @@ namespace ChilliSource
             m_renderSystem->Destroy();
 			m_resourcePool->Destroy();
 
+            //The log file can no longer be written once the file system is gone
+            Logging::Get()->DisableFileOutput();
             m_systems.clear();
 
             Logging::Destroy();
@@ -377,6 +396,7 @@ namespace ChilliSource
             m_screen = CreateSystem<Screen>();
             
 			m_taskScheduler = CreateSystem<TaskScheduler>();
+            m_frameAllocator = CreateSystem<FrameAllocator>();
             m_fileSystem = CreateSystem<FileSystem>();
             m_stateManager = CreateSystem<StateManager>();
             m_resourcePool = CreateSystem<ResourcePool>();
@@ -390,6 +410,9 @@ namespace ChilliSource
 #ifdef CS_ENABLE_DEBUGSTATS
             m_debugStats = CreateSystem<Debugging::DebugStats>();
 #endif
+#ifdef CS_ENABLE_PROFILING
+            m_profiler = CreateSystem<Debugging::Profiler>();
+#endif
 
             //Input
             CreateSystem<Input::Keyboard>();
@@ -529,6 +552,12 @@ namespace ChilliSource
         }
         //-----------------------------------------------------
         //-----------------------------------------------------
+        FrameAllocator* Application::GetFrameAllocator() const
+        {
+            return m_frameAllocator;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
         ResourcePool* Application::GetResourcePool() const
         {
             return m_resourcePool;
@@ -552,6 +581,14 @@ namespace ChilliSource
         {
             return m_debugStats;
         }
+#endif
+#ifdef CS_ENABLE_PROFILING
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        Debugging::Profiler* Application::GetProfiler() const
+        {
+            return m_profiler;
+        }
 #endif
         //----------------------------------------------------
         //----------------------------------------------------
@@ -234,6 +234,14 @@ namespace ChilliSource
 			/// @return Pointer to the task scheduler
 			//-----------------------------------------------------
             TaskScheduler* GetTaskScheduler() const;
+            //-----------------------------------------------------
+            /// Returns a pointer to the frame allocator, used for
+            /// memory which only needs to live until the end of the
+            /// current frame.
+            ///
+            /// @return Pointer to the frame allocator
+            //-----------------------------------------------------
+            FrameAllocator* GetFrameAllocator() const;
             //-----------------------------------------------------
 			/// Returns a pointer to the resource pool system.
             ///
@@ -265,6 +273,16 @@ namespace ChilliSource
 			/// @return Pointer to the debug stats system.
 			//-----------------------------------------------------
             Debugging::DebugStats* GetDebugStats() const;
+#endif
+#ifdef CS_ENABLE_PROFILING
+            //-----------------------------------------------------
+			/// Returns a pointer to the profiler system. This is
+            /// only available when the profiling preprocessor
+            /// flag CS_ENABLE_PROFILING is defined.
+            ///
+			/// @return Pointer to the profiler system.
+			//-----------------------------------------------------
+            Debugging::Profiler* GetProfiler() const;
 #endif
             //----------------------------------------------------
 			/// Initialises the application and kicks off the update
@@ -424,6 +442,7 @@ namespace ChilliSource
             ResourcePool* m_resourcePool = nullptr;
 			StateManager* m_stateManager = nullptr;
 			TaskScheduler* m_taskScheduler = nullptr;
+            FrameAllocator* m_frameAllocator = nullptr;
             Screen* m_screen = nullptr;
 			Rendering::Renderer* m_renderer = nullptr;
             Rendering::RenderSystem* m_renderSystem = nullptr;
@@ -436,6 +455,9 @@ namespace ChilliSource
 #ifdef CS_ENABLE_DEBUGSTATS
             Debugging::DebugStats* m_debugStats = nullptr;
 #endif
+#ifdef CS_ENABLE_PROFILING
+            Debugging::Profiler* m_profiler = nullptr;
+#endif
             
 			TimeIntervalSecs m_currentAppTime = 0;
 			f32 m_updateInterval;
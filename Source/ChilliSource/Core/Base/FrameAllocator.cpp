@@ -0,0 +1,203 @@
+//
+//  FrameAllocator.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Base/FrameAllocator.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#ifdef CS_ENABLE_DEBUGSTATS
+#include <ChilliSource/Debugging/Base/DebugStats.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_defaultPageSize = 64 * 1024;
+            const u32 k_trimIntervalFrames = 300;
+            
+            //-------------------------------------------------------
+            /// @param The address to align.
+            /// @param The alignment. Must be a power of two.
+            ///
+            /// @return The number of bytes which must be skipped to
+            /// align the address.
+            //-------------------------------------------------------
+            u32 CalcPadding(const u8* in_address, u32 in_alignment)
+            {
+                return u32((in_alignment - (reinterpret_cast<std::uintptr_t>(in_address) & (in_alignment - 1))) & (in_alignment - 1));
+            }
+        }
+        
+        CS_DEFINE_NAMEDTYPE(FrameAllocator);
+        
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        FrameAllocatorUPtr FrameAllocator::Create()
+        {
+            return FrameAllocatorUPtr(new FrameAllocator());
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        FrameAllocator::FrameAllocator()
+        {
+            Page page;
+            page.m_data.reset(new u8[k_defaultPageSize]);
+            page.m_size = k_defaultPageSize;
+            m_pages.push_back(std::move(page));
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        bool FrameAllocator::IsA(InterfaceIDType in_interfaceId) const
+        {
+            return (FrameAllocator::InterfaceID == in_interfaceId);
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void* FrameAllocator::Allocate(u32 in_size, u32 in_alignment)
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "The frame allocator can only be used on the main thread.");
+            CS_ASSERT(in_alignment > 0 && (in_alignment & (in_alignment - 1)) == 0, "Frame allocator alignment must be a power of two.");
+            
+            u32 padding = CalcPadding(m_pages[m_currentPage].m_data.get() + m_offset, in_alignment);
+            if (m_offset + padding + in_size > m_pages[m_currentPage].m_size)
+            {
+                NextPage(in_size, in_alignment);
+                padding = CalcPadding(m_pages[m_currentPage].m_data.get(), in_alignment);
+            }
+            
+            u8* memory = m_pages[m_currentPage].m_data.get() + m_offset + padding;
+            m_offset += padding + in_size;
+            
+            m_numAllocations++;
+            m_allocatedBytes += padding + in_size;
+            
+            return memory;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void FrameAllocator::Deallocate(void* in_memory, u32 in_size)
+        {
+            //Only the most recent allocation can be reclaimed, as this is what a growing vector will release.
+            u8* end = static_cast<u8*>(in_memory) + in_size;
+            if (in_memory != nullptr && end == m_pages[m_currentPage].m_data.get() + m_offset)
+            {
+                m_offset -= in_size;
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u32 FrameAllocator::GetNumAllocations() const
+        {
+            return m_numAllocations;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u32 FrameAllocator::GetAllocatedBytes() const
+        {
+            return m_allocatedBytes;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void FrameAllocator::NextPage(u32 in_size, u32 in_alignment)
+        {
+            m_currentPage++;
+            m_offset = 0;
+            
+            const u32 requiredSize = in_size + in_alignment;
+            if (m_currentPage >= m_pages.size() || m_pages[m_currentPage].m_size < requiredSize)
+            {
+                Page page;
+                page.m_size = std::max(k_defaultPageSize, requiredSize);
+                page.m_data.reset(new u8[page.m_size]);
+                m_pages.insert(m_pages.begin() + m_currentPage, std::move(page));
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void FrameAllocator::Reset()
+        {
+#ifdef CS_ENABLE_DEBUGSTATS
+            static const Debugging::DebugStats::CounterHandle k_frameAllocationsCounter = Debugging::DebugStats::RegisterCounter("FrameAllocs");
+            Application::Get()->GetDebugStats()->IncrementCounter(k_frameAllocationsCounter, m_numAllocations);
+#endif
+            
+            u32 frameBytes = m_offset;
+            for (u32 i = 0; i < m_currentPage; ++i)
+            {
+                frameBytes += m_pages[i].m_size;
+            }
+            m_peakFrameBytes = std::max(m_peakFrameBytes, frameBytes);
+            m_framesSinceTrim++;
+            
+            //If more than one page was needed, replace them all with a single page which will fit a whole frame.
+            if (m_pages.size() > 1)
+            {
+                u32 totalSize = 0;
+                for (const auto& page : m_pages)
+                {
+                    totalSize += page.m_size;
+                }
+                
+                m_pages.clear();
+                
+                Page page;
+                page.m_data.reset(new u8[totalSize]);
+                page.m_size = totalSize;
+                m_pages.push_back(std::move(page));
+                
+                m_framesSinceTrim = 0;
+                m_peakFrameBytes = 0;
+            }
+            else if (m_framesSinceTrim >= k_trimIntervalFrames)
+            {
+                //If the page is much larger than any recent frame has needed, for example after a one-off spike, it is
+                //shrunk back down, leaving some headroom so that normal variation doesn't cause it to grow again.
+                const u32 trimmedSize = std::max(k_defaultPageSize, m_peakFrameBytes + m_peakFrameBytes / 2);
+                if (m_pages[0].m_size > trimmedSize * 2)
+                {
+                    m_pages[0].m_data.reset(new u8[trimmedSize]);
+                    m_pages[0].m_size = trimmedSize;
+                }
+                
+                m_framesSinceTrim = 0;
+                m_peakFrameBytes = 0;
+            }
+            
+            m_currentPage = 0;
+            m_offset = 0;
+            m_numAllocations = 0;
+            m_allocatedBytes = 0;
+        }
+    }
+}
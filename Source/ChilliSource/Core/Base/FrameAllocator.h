@@ -0,0 +1,316 @@
+//
+//  FrameAllocator.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_BASE_FRAMEALLOCATOR_H_
+#define _CHILLISOURCE_CORE_BASE_FRAMEALLOCATOR_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------------
+        /// An application system providing a linear arena for memory
+        /// which only needs to live until the end of the current frame,
+        /// such as the intermediate lists built by the renderer.
+        /// Allocation simply bumps an offset into the current page, and
+        /// all allocations are released at once at the end of each
+        /// render. Individual deallocations are ignored, unless the
+        /// memory was the most recent allocation in which case it is
+        /// reclaimed immediately.
+        ///
+        /// If a frame spills into more than one page the pages are
+        /// replaced with a single larger page at the end of the frame,
+        /// so after the first few frames no further heap allocations
+        /// are made. Every few hundred frames the page is shrunk if it
+        /// is more than twice the size that the largest of those frames
+        /// needed, so a single spike doesn't hold on to memory forever.
+        ///
+        /// The allocator is not thread-safe and should only be used
+        /// from the main thread. Memory from it must not be held past
+        /// the end of the frame.
+        //---------------------------------------------------------------
+        class FrameAllocator final : public AppSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(FrameAllocator);
+            //-------------------------------------------------------
+            /// Allows querying of whether or not this system
+            /// implements the interface with the given Id.
+            ///
+            /// @param The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //-------------------------------------------------------
+            bool IsA(InterfaceIDType in_interfaceId) const override;
+            //-------------------------------------------------------
+            /// Allocates a block of memory which will remain valid
+            /// until the end of the current frame.
+            ///
+            /// @param The size of the block in bytes.
+            /// @param The required alignment of the block. Must be
+            /// a power of two.
+            ///
+            /// @return The block of memory.
+            //-------------------------------------------------------
+            void* Allocate(u32 in_size, u32 in_alignment);
+            //-------------------------------------------------------
+            /// Releases a block of memory. This only reclaims the
+            /// memory if it was the most recent allocation,
+            /// otherwise it will be reclaimed at the end of the
+            /// frame.
+            ///
+            /// @param The block of memory.
+            /// @param The size the block was allocated with.
+            //-------------------------------------------------------
+            void Deallocate(void* in_memory, u32 in_size);
+            //-------------------------------------------------------
+            /// @return The number of allocations made this frame.
+            //-------------------------------------------------------
+            u32 GetNumAllocations() const;
+            //-------------------------------------------------------
+            /// @return The number of bytes allocated this frame,
+            /// including any alignment padding.
+            //-------------------------------------------------------
+            u32 GetAllocatedBytes() const;
+            
+        private:
+            friend class Application;
+            //-------------------------------------------------------
+            /// A single block of memory allocations are made from.
+            //-------------------------------------------------------
+            struct Page
+            {
+                std::unique_ptr<u8[]> m_data;
+                u32 m_size;
+            };
+            //-------------------------------------------------------
+            /// Factory method for creating a new instance of the
+            /// system. This is called by Application.
+            ///
+            /// @return The new instance.
+            //-------------------------------------------------------
+            static FrameAllocatorUPtr Create();
+            //-------------------------------------------------------
+            /// Private constructor to enforce use of the factory
+            /// method.
+            //-------------------------------------------------------
+            FrameAllocator();
+            //-------------------------------------------------------
+            /// Moves on to the next page, creating a new one if
+            /// there is no page large enough for the given
+            /// allocation.
+            ///
+            /// @param The size of the allocation.
+            /// @param The alignment of the allocation.
+            //-------------------------------------------------------
+            void NextPage(u32 in_size, u32 in_alignment);
+            //-------------------------------------------------------
+            /// Releases all allocations made this frame, merging or
+            /// trimming the pages as needed. This is called by
+            /// Application at the end of each render.
+            //-------------------------------------------------------
+            void Reset();
+            
+            std::vector<Page> m_pages;
+            u32 m_currentPage = 0;
+            u32 m_offset = 0;
+            u32 m_numAllocations = 0;
+            u32 m_allocatedBytes = 0;
+            u32 m_peakFrameBytes = 0;
+            u32 m_framesSinceTrim = 0;
+        };
+        //---------------------------------------------------------------
+        /// An STL compatible allocator which allocates from the frame
+        /// allocator. This allows containers which are only needed for
+        /// the current frame to avoid the general heap. Containers
+        /// using it must be destroyed before the end of the frame.
+        ///
+        /// NOTE: This class syntax mimics STL and therefore does not
+        /// use the CS coding standards.
+        //---------------------------------------------------------------
+        template <typename TType> class FrameAllocatorAdapter
+        {
+        public:
+            using value_type = TType;
+            using pointer = TType*;
+            using const_pointer = const TType*;
+            using reference = TType&;
+            using const_reference = const TType&;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            
+            template <typename TOtherType> struct rebind
+            {
+                using other = FrameAllocatorAdapter<TOtherType>;
+            };
+            //-------------------------------------------------------
+            /// Constructor. This is intentionally not explicit so
+            /// that containers can be constructed directly from the
+            /// frame allocator.
+            ///
+            /// @param The frame allocator.
+            //-------------------------------------------------------
+            FrameAllocatorAdapter(FrameAllocator* in_allocator);
+            //-------------------------------------------------------
+            /// Converting constructor, required for rebinding.
+            ///
+            /// @param The adapter to copy.
+            //-------------------------------------------------------
+            template <typename TOtherType> FrameAllocatorAdapter(const FrameAllocatorAdapter<TOtherType>& in_other);
+            //-------------------------------------------------------
+            /// @param The number of objects to allocate space for.
+            ///
+            /// @return The uninitialised memory.
+            //-------------------------------------------------------
+            pointer allocate(size_type in_count, const void* in_hint = nullptr);
+            //-------------------------------------------------------
+            /// @param The memory to release.
+            /// @param The number of objects it was allocated for.
+            //-------------------------------------------------------
+            void deallocate(pointer in_memory, size_type in_count);
+            //-------------------------------------------------------
+            /// @param The memory to construct in.
+            /// @param The constructor arguments.
+            //-------------------------------------------------------
+            template <typename TOtherType, typename... TArgs> void construct(TOtherType* in_memory, TArgs&&... in_args);
+            //-------------------------------------------------------
+            /// @param The object to destroy.
+            //-------------------------------------------------------
+            template <typename TOtherType> void destroy(TOtherType* in_object);
+            //-------------------------------------------------------
+            /// @return The maximum number of objects that can be
+            /// allocated at once.
+            //-------------------------------------------------------
+            size_type max_size() const;
+            //-------------------------------------------------------
+            /// @param The object.
+            ///
+            /// @return The address of the object.
+            //-------------------------------------------------------
+            pointer address(reference in_object) const;
+            //-------------------------------------------------------
+            /// @param The object.
+            ///
+            /// @return The address of the object.
+            //-------------------------------------------------------
+            const_pointer address(const_reference in_object) const;
+            //-------------------------------------------------------
+            /// @return The frame allocator used by this adapter.
+            //-------------------------------------------------------
+            FrameAllocator* get_allocator() const;
+            
+        private:
+            FrameAllocator* m_allocator;
+        };
+        //---------------------------------------------------------------
+        /// A vector which allocates from the frame allocator.
+        //---------------------------------------------------------------
+        template <typename TType> using FrameVector = std::vector<TType, FrameAllocatorAdapter<TType>>;
+        
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> FrameAllocatorAdapter<TType>::FrameAllocatorAdapter(FrameAllocator* in_allocator)
+            : m_allocator(in_allocator)
+        {
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> template <typename TOtherType> FrameAllocatorAdapter<TType>::FrameAllocatorAdapter(const FrameAllocatorAdapter<TOtherType>& in_other)
+            : m_allocator(in_other.get_allocator())
+        {
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> typename FrameAllocatorAdapter<TType>::pointer FrameAllocatorAdapter<TType>::allocate(size_type in_count, const void* in_hint)
+        {
+            return static_cast<pointer>(m_allocator->Allocate(u32(in_count * sizeof(TType)), u32(alignof(TType))));
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> void FrameAllocatorAdapter<TType>::deallocate(pointer in_memory, size_type in_count)
+        {
+            m_allocator->Deallocate(in_memory, u32(in_count * sizeof(TType)));
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> template <typename TOtherType, typename... TArgs> void FrameAllocatorAdapter<TType>::construct(TOtherType* in_memory, TArgs&&... in_args)
+        {
+            ::new(static_cast<void*>(in_memory)) TOtherType(std::forward<TArgs>(in_args)...);
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> template <typename TOtherType> void FrameAllocatorAdapter<TType>::destroy(TOtherType* in_object)
+        {
+            in_object->~TOtherType();
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> typename FrameAllocatorAdapter<TType>::size_type FrameAllocatorAdapter<TType>::max_size() const
+        {
+            return std::numeric_limits<u32>::max() / sizeof(TType);
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> typename FrameAllocatorAdapter<TType>::pointer FrameAllocatorAdapter<TType>::address(reference in_object) const
+        {
+            return std::addressof(in_object);
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> typename FrameAllocatorAdapter<TType>::const_pointer FrameAllocatorAdapter<TType>::address(const_reference in_object) const
+        {
+            return std::addressof(in_object);
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType> FrameAllocator* FrameAllocatorAdapter<TType>::get_allocator() const
+        {
+            return m_allocator;
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType, typename TOtherType> bool operator==(const FrameAllocatorAdapter<TType>& in_a, const FrameAllocatorAdapter<TOtherType>& in_b)
+        {
+            return in_a.get_allocator() == in_b.get_allocator();
+        }
+        //---------------------------------------------------------------
+        //---------------------------------------------------------------
+        template <typename TType, typename TOtherType> bool operator!=(const FrameAllocatorAdapter<TType>& in_a, const FrameAllocatorAdapter<TOtherType>& in_b)
+        {
+            return in_a.get_allocator() != in_b.get_allocator();
+        }
+    }
+}
+
+#endif
@@ -69,12 +69,93 @@ namespace ChilliSource
     {
         namespace
         {
+            const u32 k_numRecords = 256;
+            const u32 k_recordIndexMask = k_numRecords - 1;
+            const u32 k_maxMessageLength = 1024;
+            const std::chrono::milliseconds k_outputInterval(50);
 #ifdef CS_ENABLE_LOGTOFILE
-            const u32 k_maxLogBufferSize = 2048;
             const std::string k_logFileName = "ChilliSourceLog.txt";
 #endif
+            const s8* k_levelPrefixes[] = { "", "WARNING: ", "ERROR: ", "FATAL: " };
+            
+            const u32 k_numRepeatSlots = 64;
+            const u64 k_freeThreadKey = 0;
+            const u64 k_repeatCountMask = (1ULL << 24) - 1;
+            const u64 k_repeatHashMask = ~k_repeatCountMask;
+            
+            static_assert((k_numRecords & k_recordIndexMask) == 0, "The number of log records must be a power of two.");
+            //----------------------------------------------
+            /// A 64-bit FNV-1a hash of the message and level
+            /// used to detect repeated messages.
+            ///
+            /// @param The logging level.
+            /// @param The message.
+            ///
+            /// @return The hash.
+            //----------------------------------------------
+            u64 HashMessage(u32 in_logLevel, const std::string& in_message)
+            {
+                u64 hash = 14695981039346656037ULL ^ in_logLevel;
+                for (const s8 character : in_message)
+                {
+                    hash ^= (u8)character;
+                    hash *= 1099511628211ULL;
+                }
+                return hash;
+            }
+            //----------------------------------------------
+            /// Builds the message that reports how many times
+            /// a message was repeated.
+            ///
+            /// @param The number of repeats.
+            /// @param The repeated message.
+            ///
+            /// @return The report.
+            //----------------------------------------------
+            std::string BuildRepeatMessage(u32 in_numRepeats, const std::string& in_message)
+            {
+                return "Message repeated " + std::to_string(in_numRepeats) + " times: " + in_message;
+            }
         }
         
+        //-----------------------------------------------
+        /// A single message in the ring buffer. The
+        /// sequence number tells producers and the output
+        /// thread which of them currently owns the record.
+        //-----------------------------------------------
+        struct Logging::LogRecord
+        {
+            std::atomic<u32> m_sequence;
+            LogLevel m_level;
+            u64 m_hash;
+            u32 m_repeatSlotIndex;
+            u64 m_previousRepeatState;
+            f64 m_timestamp;
+            u64 m_threadId;
+            u32 m_length;
+            bool m_isTruncated;
+            s8 m_message[k_maxMessageLength];
+        };
+        //-----------------------------------------------
+        /// The repeat state of a single logging thread.
+        /// The last message hash and repeat count are
+        /// packed into one word so that the logging
+        /// thread and the output thread can update them
+        /// together. The remaining fields describe the
+        /// last message output for the thread and are
+        /// only accessed on the output thread.
+        //-----------------------------------------------
+        struct Logging::RepeatSlot
+        {
+            std::atomic<u64> m_threadKey;
+            std::atomic<u64> m_repeatState;
+            
+            bool m_hasLastMessage;
+            u64 m_lastMessageHash;
+            LogLevel m_lastMessageLevel;
+            std::string m_lastMessage;
+        };
+        
         Logging* Logging::s_logging = nullptr;
         //-----------------------------------------------
         //-----------------------------------------------
@@ -97,10 +178,27 @@ namespace ChilliSource
         //----------------------------------------------
         //----------------------------------------------
         Logging::Logging()
+            : m_records(new LogRecord[k_numRecords]), m_writeIndex(0), m_readIndex(0), m_numDroppedRecords(0), m_repeatSlots(new RepeatSlot[k_numRepeatSlots]),
+            m_startTime(std::chrono::steady_clock::now()), m_flushedIndex(0), m_isFlushRequested(false), m_isOutputting(false), m_isStopping(false)
 #ifdef CS_ENABLE_LOGTOFILE
-            : m_isFirstLog(true)
+            , m_isFirstLog(true), m_isFileOutputEnabled(true)
 #endif
         {
+            for (u32 i = 0; i < k_numRecords; ++i)
+            {
+                m_records[i].m_sequence.store(i, std::memory_order_relaxed);
+            }
+            
+            for (u32 i = 0; i < k_numRepeatSlots; ++i)
+            {
+                m_repeatSlots[i].m_threadKey.store(k_freeThreadKey, std::memory_order_relaxed);
+                m_repeatSlots[i].m_repeatState.store(0, std::memory_order_relaxed);
+                m_repeatSlots[i].m_hasLastMessage = false;
+                m_repeatSlots[i].m_lastMessageHash = 0;
+                m_repeatSlots[i].m_lastMessageLevel = LogLevel::k_verbose;
+            }
+            
+            m_outputThread = std::thread(&Logging::OutputThreadMain, this);
         }
         //----------------------------------------------
         //----------------------------------------------
@@ -115,7 +213,7 @@ namespace ChilliSource
         void Logging::LogWarning(const std::string &in_message)
         {
 #if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING
-            LogMessage(LogLevel::k_warning, "WARNING: " + in_message);
+            LogMessage(LogLevel::k_warning, in_message);
 #endif
         }
         //----------------------------------------------
@@ -123,7 +221,7 @@ namespace ChilliSource
         void Logging::LogError(const std::string &in_message)
         {
 #if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING || defined CS_LOGLEVEL_ERROR
-            LogMessage(LogLevel::k_error, "ERROR: " + in_message);
+            LogMessage(LogLevel::k_error, in_message);
 #endif
         }
         //----------------------------------------------
@@ -131,8 +229,9 @@ namespace ChilliSource
         void Logging::LogFatal(const std::string &in_message)
         {
 #if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING || defined CS_LOGLEVEL_ERROR || defined CS_LOGLEVEL_FATAL
-            LogMessage(LogLevel::k_error, "FATAL: " + in_message);
-            LogMessage(LogLevel::k_error, "Chilli Source is exiting...");
+            LogMessage(LogLevel::k_fatal, in_message);
+            LogMessage(LogLevel::k_fatal, "Chilli Source is exiting...");
+            Flush();
 #endif
 
 #ifdef CS_TARGETPLATFORM_ANDROID
@@ -143,16 +242,335 @@ namespace ChilliSource
 #endif
 #endif
         }
+        //----------------------------------------------
+        //----------------------------------------------
+        void Logging::Flush()
+        {
+            if (std::this_thread::get_id() == m_outputThread.get_id())
+            {
+                return;
+            }
+            
+            std::unique_lock<std::mutex> lock(m_outputMutex);
+            const u32 targetIndex = m_writeIndex.load(std::memory_order_acquire);
+            m_isFlushRequested = true;
+            m_outputCondition.notify_one();
+            m_flushedCondition.wait(lock, [&]()
+            {
+                return (s32)(m_flushedIndex - targetIndex) >= 0;
+            });
+        }
         //-----------------------------------------------------
         //-----------------------------------------------------
         void Logging::Destroy()
         {
+            if (s_logging != nullptr)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(s_logging->m_outputMutex);
+                    s_logging->m_isStopping = true;
+                    s_logging->m_outputCondition.notify_one();
+                }
+                s_logging->m_outputThread.join();
+            }
+            
             CS_SAFEDELETE(s_logging);
         }
         //-----------------------------------------------------
         //-----------------------------------------------------
+        void Logging::DisableFileOutput()
+        {
+#ifdef CS_ENABLE_LOGTOFILE
+            Flush();
+            
+            std::unique_lock<std::mutex> lock(m_outputMutex);
+            m_isFileOutputEnabled = false;
+            
+            //Output started before the flag was cleared may still write to the file, so wait for it to finish.
+            m_flushedCondition.wait(lock, [&]()
+            {
+                return m_isOutputting == false;
+            });
+#endif
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
         void Logging::LogMessage(LogLevel in_logLevel, const std::string& in_message)
         {
+            const u64 hash = HashMessage((u32)in_logLevel, in_message) & k_repeatHashMask;
+            const u32 repeatSlotIndex = GetRepeatSlotIndex();
+            
+            //Repeats are tracked per thread, so the count always belongs to the previous message from the same thread.
+            //Fatal messages are never counted as repeats, but still take the count of the previous message.
+            u64 previousRepeatState = 0;
+            if (repeatSlotIndex < k_numRepeatSlots)
+            {
+                std::atomic<u64>& repeatState = m_repeatSlots[repeatSlotIndex].m_repeatState;
+                u64 state = repeatState.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    if (in_logLevel != LogLevel::k_fatal && (state & k_repeatHashMask) == hash)
+                    {
+                        const u64 newState = ((state & k_repeatCountMask) == k_repeatCountMask) ? state : state + 1;
+                        if (repeatState.compare_exchange_weak(state, newState, std::memory_order_relaxed) == true)
+                        {
+                            return;
+                        }
+                    }
+                    else if (repeatState.compare_exchange_weak(state, hash, std::memory_order_relaxed) == true)
+                    {
+                        previousRepeatState = state;
+                        break;
+                    }
+                }
+            }
+            
+            if (TryPushRecord(in_logLevel, in_message, hash, repeatSlotIndex, previousRepeatState) == false)
+            {
+                //Fatal messages must always be output so wait for space.
+                if (in_logLevel == LogLevel::k_fatal)
+                {
+                    Flush();
+                    if (TryPushRecord(in_logLevel, in_message, hash, repeatSlotIndex, previousRepeatState) == true)
+                    {
+                        return;
+                    }
+                }
+                
+                m_numDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        u32 Logging::GetRepeatSlotIndex()
+        {
+            u64 threadKey = std::hash<std::thread::id>()(std::this_thread::get_id());
+            if (threadKey == k_freeThreadKey)
+            {
+                threadKey = 1;
+            }
+            
+            //Slots are only ever claimed by the thread they belong to, so a thread can't end up with two slots.
+            for (u32 i = 0; i < k_numRepeatSlots; ++i)
+            {
+                const u32 index = (threadKey + i) % k_numRepeatSlots;
+                const u64 slotKey = m_repeatSlots[index].m_threadKey.load(std::memory_order_acquire);
+                if (slotKey == threadKey)
+                {
+                    return index;
+                }
+                else if (slotKey == k_freeThreadKey)
+                {
+                    u64 expectedKey = k_freeThreadKey;
+                    if (m_repeatSlots[index].m_threadKey.compare_exchange_strong(expectedKey, threadKey, std::memory_order_acq_rel) == true)
+                    {
+                        return index;
+                    }
+                }
+            }
+            
+            return k_numRepeatSlots;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool Logging::TryPushRecord(LogLevel in_logLevel, const std::string& in_message, u64 in_hash, u32 in_repeatSlotIndex, u64 in_previousRepeatState)
+        {
+            u32 writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+            LogRecord* record = nullptr;
+            while (true)
+            {
+                record = &m_records[writeIndex & k_recordIndexMask];
+                const s32 difference = (s32)(record->m_sequence.load(std::memory_order_acquire) - writeIndex);
+                if (difference == 0)
+                {
+                    if (m_writeIndex.compare_exchange_weak(writeIndex, writeIndex + 1, std::memory_order_relaxed) == true)
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+                }
+            }
+            
+            record->m_level = in_logLevel;
+            record->m_hash = in_hash;
+            record->m_repeatSlotIndex = in_repeatSlotIndex;
+            record->m_previousRepeatState = in_previousRepeatState;
+            record->m_timestamp = std::chrono::duration<f64>(std::chrono::steady_clock::now() - m_startTime).count();
+            record->m_threadId = std::hash<std::thread::id>()(std::this_thread::get_id());
+            record->m_isTruncated = in_message.size() > k_maxMessageLength;
+            record->m_length = record->m_isTruncated ? k_maxMessageLength : (u32)in_message.size();
+            memcpy(record->m_message, in_message.data(), record->m_length);
+            record->m_sequence.store(writeIndex + 1, std::memory_order_release);
+            
+            //Wake the output thread early if the buffer is filling up.
+            if (writeIndex - m_readIndex.load(std::memory_order_relaxed) >= k_numRecords / 2)
+            {
+                m_outputCondition.notify_one();
+            }
+            
+            return true;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Logging::OutputThreadMain()
+        {
+            std::unique_lock<std::mutex> lock(m_outputMutex);
+            while (true)
+            {
+                m_outputCondition.wait_for(lock, k_outputInterval, [&]()
+                {
+                    return m_isFlushRequested == true || m_isStopping == true;
+                });
+                
+                m_isFlushRequested = false;
+                const bool isStopping = m_isStopping;
+#ifdef CS_ENABLE_LOGTOFILE
+                const bool isFileOutputEnabled = m_isFileOutputEnabled;
+#else
+                const bool isFileOutputEnabled = false;
+#endif
+                
+                //The records are output without the lock held, so that platform output and file IO don't block
+                //threads which are flushing or shutting down the log.
+                m_isOutputting = true;
+                lock.unlock();
+                OutputPendingRecords(isFileOutputEnabled);
+                lock.lock();
+                m_isOutputting = false;
+                
+                m_flushedIndex = m_readIndex.load(std::memory_order_acquire);
+                m_flushedCondition.notify_all();
+                
+                if (isStopping == true)
+                {
+                    break;
+                }
+            }
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Logging::OutputPendingRecords(bool in_isFileOutputEnabled)
+        {
+            std::string message;
+            
+            while (true)
+            {
+                const u32 readIndex = m_readIndex.load(std::memory_order_relaxed);
+                LogRecord& record = m_records[readIndex & k_recordIndexMask];
+                if (record.m_sequence.load(std::memory_order_acquire) != readIndex + 1)
+                {
+                    break;
+                }
+                
+                //The repeats are only reported if the repeated message was output rather than dropped.
+                RepeatSlot* repeatSlot = (record.m_repeatSlotIndex < k_numRepeatSlots) ? &m_repeatSlots[record.m_repeatSlotIndex] : nullptr;
+                const u32 numPreviousRepeats = (u32)(record.m_previousRepeatState & k_repeatCountMask);
+                if (repeatSlot != nullptr && repeatSlot->m_hasLastMessage == true && numPreviousRepeats > 0 && (record.m_previousRepeatState & k_repeatHashMask) == repeatSlot->m_lastMessageHash)
+                {
+                    message = BuildRepeatMessage(numPreviousRepeats, repeatSlot->m_lastMessage);
+                    OutputToPlatform(repeatSlot->m_lastMessageLevel, message);
+#ifdef CS_ENABLE_LOGTOFILE
+                    m_fileBuffer += "\n" + message;
+#endif
+                }
+                
+                message = k_levelPrefixes[(u32)record.m_level];
+                message.append(record.m_message, record.m_length);
+                if (record.m_isTruncated == true)
+                {
+                    message += "...";
+                }
+                OutputToPlatform(record.m_level, message);
+                
+                if (repeatSlot != nullptr)
+                {
+                    repeatSlot->m_hasLastMessage = true;
+                    repeatSlot->m_lastMessageHash = record.m_hash;
+                    repeatSlot->m_lastMessageLevel = record.m_level;
+                    repeatSlot->m_lastMessage = message;
+                }
+                
+#ifdef CS_ENABLE_LOGTOFILE
+                s8 header[64];
+                snprintf(header, sizeof(header), "\n[%.3f][%llx] ", record.m_timestamp, (unsigned long long)record.m_threadId);
+                m_fileBuffer += header;
+                m_fileBuffer += message;
+#endif
+                
+                record.m_sequence.store(readIndex + k_numRecords, std::memory_order_release);
+                m_readIndex.store(readIndex + 1, std::memory_order_release);
+            }
+            
+            //Report the repeats counted so far, so that a message which keeps repeating is still output periodically.
+            //The count is only taken if it belongs to the last message output for the thread; if a newer message
+            //hasn't been output yet its record will report the count instead.
+            for (u32 i = 0; i < k_numRepeatSlots; ++i)
+            {
+                RepeatSlot& repeatSlot = m_repeatSlots[i];
+                if (repeatSlot.m_hasLastMessage == false)
+                {
+                    continue;
+                }
+                
+                u64 state = repeatSlot.m_repeatState.load(std::memory_order_relaxed);
+                while ((state & k_repeatHashMask) == repeatSlot.m_lastMessageHash && (state & k_repeatCountMask) > 0)
+                {
+                    if (repeatSlot.m_repeatState.compare_exchange_weak(state, state & k_repeatHashMask, std::memory_order_relaxed) == true)
+                    {
+                        message = BuildRepeatMessage((u32)(state & k_repeatCountMask), repeatSlot.m_lastMessage);
+                        OutputToPlatform(repeatSlot.m_lastMessageLevel, message);
+#ifdef CS_ENABLE_LOGTOFILE
+                        m_fileBuffer += "\n" + message;
+#endif
+                        break;
+                    }
+                }
+            }
+            
+            const u32 numDropped = m_numDroppedRecords.exchange(0, std::memory_order_relaxed);
+            if (numDropped > 0)
+            {
+                message = "WARNING: " + std::to_string(numDropped) + " log messages were dropped as the log buffer was full.";
+                OutputToPlatform(LogLevel::k_warning, message);
+#ifdef CS_ENABLE_LOGTOFILE
+                m_fileBuffer += "\n" + message;
+#endif
+            }
+            
+#ifdef CS_ENABLE_LOGTOFILE
+            if (m_fileBuffer.empty() == false && in_isFileOutputEnabled == true)
+            {
+                //The file system is created after logging, so hold on to messages until it exists.
+                FileSystem* fileSystem = Application::Get() != nullptr ? Application::Get()->GetFileSystem() : nullptr;
+                if (fileSystem != nullptr)
+                {
+                    FileStreamUPtr stream = fileSystem->CreateFileStream(StorageLocation::k_cache, k_logFileName, m_isFirstLog ? FileMode::k_write : FileMode::k_writeAppend);
+                    if (stream != nullptr)
+                    {
+                        if (m_isFirstLog == true)
+                        {
+                            stream->Write("Chilli Source Log");
+                            m_isFirstLog = false;
+                        }
+                        stream->Write(m_fileBuffer);
+                        stream->Close();
+                    }
+                    m_fileBuffer.clear();
+                }
+            }
+#endif
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Logging::OutputToPlatform(LogLevel in_logLevel, const std::string& in_message)
+        {
 #ifdef CS_TARGETPLATFORM_ANDROID
             switch (in_logLevel)
             {
@@ -163,60 +581,21 @@ namespace ChilliSource
                     CS_ANDROID_LOG_WARNING(in_message.c_str());
                     break;
                 case LogLevel::k_error:
+                case LogLevel::k_fatal:
                     CS_ANDROID_LOG_ERROR(in_message.c_str());
                     break;
                 
             }
 #elif defined (CS_TARGETPLATFORM_IOS)
-            NSString* message = [NSStringUtils newNSStringWithUTF8String:in_message];
-            NSLog(@"[Chilli Source] %@", message);
-            [message release];
+            @autoreleasepool
+            {
+                NSString* message = [NSStringUtils newNSStringWithUTF8String:in_message];
+                NSLog(@"[Chilli Source] %@", message);
+                [message release];
+            }
 #elif defined (CS_TARGETPLATFORM_WINDOWS)
 			OutputDebugString(CSBackend::Windows::WindowsStringUtils::UTF8ToUTF16("[Chilli Source] " + in_message + "\n").c_str());
 #endif
-            
-#ifdef CS_ENABLE_LOGTOFILE
-            LogToFile(in_message);
-#endif
-        }
-        
-#ifdef CS_ENABLE_LOGTOFILE
-        //-----------------------------------------------
-        //-----------------------------------------------
-        void Logging::CreateLogFile()
-        {
-            FileStreamUPtr stream = Application::Get()->GetFileSystem()->CreateFileStream(StorageLocation::k_cache, k_logFileName, Core::FileMode::k_write);
-            stream->Write("Chilli Source Log");
-            stream->Close();
-        }
-        //-----------------------------------------------
-        //-----------------------------------------------
-        void Logging::LogToFile(const std::string& in_message)
-        {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_logBuffer += "\n" + in_message;
-            
-            FileSystem* fileSystem = Application::Get()->GetFileSystem();
-            if(fileSystem != nullptr && m_logBuffer.length() > k_maxLogBufferSize)
-            {
-                if (m_isFirstLog == true)
-                {
-                    FileStreamUPtr stream = Application::Get()->GetFileSystem()->CreateFileStream(StorageLocation::k_cache, k_logFileName, Core::FileMode::k_write);
-                    stream->Write("Chilli Source Log");
-                    stream->Write(m_logBuffer);
-                    stream->Close();
-                    m_logBuffer.clear();
-                    m_isFirstLog = false;
-                }
-                else
-                {
-                    FileStreamUPtr stream = Application::Get()->GetFileSystem()->CreateFileStream(StorageLocation::k_cache, k_logFileName, Core::FileMode::k_writeAppend);
-                    stream->Write(m_logBuffer);
-                    stream->Close();
-                    m_logBuffer.clear();
-                }
-            }
         }
-#endif
     }
 }
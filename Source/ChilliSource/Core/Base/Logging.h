@@ -31,11 +31,13 @@
 
 #include <ChilliSource/ChilliSource.h>
 
-#include <string>
-
-#ifdef CS_ENABLE_LOGTOFILE
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
-#endif
+#include <string>
+#include <thread>
 
 namespace ChilliSource
 {
@@ -47,6 +49,16 @@ namespace ChilliSource
         /// implements the singleton pattern but does not inherit
         /// from singleton. This is because singleton uses Logging.
         ///
+        /// Messages are copied into a fixed size ring buffer and
+        /// output on a background thread, so logging does not
+        /// block the calling thread on platform output or file
+        /// IO. Consecutive repeats of the same message on a
+        /// thread are collapsed into a repeat count which is
+        /// reported periodically, and if the ring buffer is full
+        /// messages are dropped and the number dropped is
+        /// reported. Fatal messages flush all pending
+        /// messages before the application exits.
+        ///
         /// @author S Downie
         //------------------------------------------------------------
         class Logging final
@@ -110,6 +122,12 @@ namespace ChilliSource
             /// @param The message to log.
             //-----------------------------------------------------
             void LogFatal(const std::string& in_message);
+            //-----------------------------------------------------
+            /// Blocks until all messages logged prior to the call
+            /// have been output. This is a no-op if called from
+            /// within the logging output.
+            //-----------------------------------------------------
+            void Flush();
         private:
             friend class Application;
             
@@ -122,8 +140,12 @@ namespace ChilliSource
             {
                 k_verbose,
                 k_warning,
-                k_error
+                k_error,
+                k_fatal
             };
+            
+            struct LogRecord;
+            struct RepeatSlot;
             //-----------------------------------------------------
             /// Creates the singleton instance of the Logger.
             ///
@@ -133,20 +155,29 @@ namespace ChilliSource
             //-----------------------------------------------------
             static void Create();
             //-----------------------------------------------------
-            /// Destroys the Logger.
+            /// Destroys the Logger. Any pending messages are
+            /// output before the background thread exits.
             ///
             /// @author Ian Copland
             //-----------------------------------------------------
             static void Destroy();
             //-----------------------------------------------------
-            /// Constructor.
+            /// Constructor. Starts the background output thread.
             ///
             /// @author Ian Copland
             //-----------------------------------------------------
             Logging();
             //-----------------------------------------------------
-            /// Logs the given message to file. How this is logged
-            /// is dependant on platform.
+            /// Flushes any pending messages and stops writing
+            /// to the log file. This must be called prior to the
+            /// file system being destroyed.
+            //-----------------------------------------------------
+            void DisableFileOutput();
+            //-----------------------------------------------------
+            /// Queues the given message for output on the
+            /// background thread. Repeats of the previous message
+            /// logged on the calling thread are counted rather
+            /// than queued.
             ///
             /// @author Ian Copland
             ///
@@ -154,25 +185,79 @@ namespace ChilliSource
             /// @param The message to log.
             //-----------------------------------------------------
             void LogMessage(LogLevel in_logLevel, const std::string& in_message);
-#ifdef CS_ENABLE_LOGTOFILE
             //-----------------------------------------------------
-            /// Creates a new Log file.
+            /// Copies the message into the next free record in the
+            /// ring buffer. This is safe to call from any number
+            /// of threads at once.
             ///
-            /// @author Ian Copland
+            /// @param The logging level.
+            /// @param The message to log.
+            /// @param The hash of the message used to detect
+            /// repeats.
+            /// @param The index of the repeat slot of the calling
+            /// thread.
+            /// @param The repeat state replaced by the message: the
+            /// hash of the previous message on the calling thread
+            /// and the number of times it was repeated.
+            ///
+            /// @return Whether there was space for the message.
+            //-----------------------------------------------------
+            bool TryPushRecord(LogLevel in_logLevel, const std::string& in_message, u64 in_hash, u32 in_repeatSlotIndex, u64 in_previousRepeatState);
+            //-----------------------------------------------------
+            /// Finds the repeat slot of the calling thread,
+            /// claiming a free one the first time the thread
+            /// logs. This is lock-free.
+            ///
+            /// @return The index of the slot, or the number of
+            /// slots if they are all in use, in which case
+            /// repeats on the thread aren't collapsed.
+            //-----------------------------------------------------
+            u32 GetRepeatSlotIndex();
+            //-----------------------------------------------------
+            /// The entry point of the background output thread.
             //-----------------------------------------------------
-            void CreateLogFile();
+            void OutputThreadMain();
             //-----------------------------------------------------
-            /// Adds the message to to the log file.
+            /// Outputs all complete records in the ring buffer
+            /// along with any pending repeat and dropped message
+            /// counts. This must only be called on the output
+            /// thread, and is called without the output mutex
+            /// held.
+            ///
+            /// @param Whether or not the records should also be
+            /// written to the log file.
+            //-----------------------------------------------------
+            void OutputPendingRecords(bool in_isFileOutputEnabled);
+            //-----------------------------------------------------
+            /// Outputs the given message in the platform specific
+            /// manner.
             ///
             /// @author Ian Copland
             ///
-            /// @param The message to log.
+            /// @param The logging level.
+            /// @param The message including level prefix.
             //-----------------------------------------------------
-            void LogToFile(const std::string& in_message);
+            void OutputToPlatform(LogLevel in_logLevel, const std::string& in_message);
+            
+            std::unique_ptr<LogRecord[]> m_records;
+            std::atomic<u32> m_writeIndex;
+            std::atomic<u32> m_readIndex;
+            std::atomic<u32> m_numDroppedRecords;
+            std::unique_ptr<RepeatSlot[]> m_repeatSlots;
+            std::chrono::steady_clock::time_point m_startTime;
             
+            std::thread m_outputThread;
+            std::mutex m_outputMutex;
+            std::condition_variable m_outputCondition;
+            std::condition_variable m_flushedCondition;
+            u32 m_flushedIndex;
+            bool m_isFlushRequested;
+            bool m_isOutputting;
+            bool m_isStopping;
+#ifdef CS_ENABLE_LOGTOFILE
+            std::string m_fileBuffer;
             bool m_isFirstLog;
-            std::string m_logBuffer;
-            std::mutex m_mutex;
+            bool m_isFileOutputEnabled;
 #endif
             static Logging* s_logging;
         };
@@ -31,9 +31,11 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Container/HashedArray.h>
+#include <ChilliSource/Core/Container/ObjectPool.h>
 #include <ChilliSource/Core/Container/concurrent_vector.h>
 #include <ChilliSource/Core/Container/ParamDictionary.h>
 #include <ChilliSource/Core/Container/ParamDictionarySerialiser.h>
+#include <ChilliSource/Core/Container/rcu_vector.h>
 #include <ChilliSource/Core/Container/WorkerQueue.h>
 
 #endif
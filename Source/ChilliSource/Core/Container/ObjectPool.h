@@ -0,0 +1,365 @@
+//
+//  ObjectPool.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_OBJECTPOOL_H_
+#define _CHILLISOURCE_CORE_CONTAINER_OBJECTPOOL_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+//------------------------------------------------------------------------
+/// Declares class specific new and delete operators which allocate
+/// instances of the class from a type specific object pool. This should
+/// be placed in the public section of the class declaration, and paired
+/// with CS_DEFINE_POOLEDTYPE in the source file.
+///
+/// Derived types which are larger than the pooled type fall back on
+/// the global heap.
+//------------------------------------------------------------------------
+#define CS_DECLARE_POOLEDTYPE(x) \
+    static void* operator new(::std::size_t in_size); \
+    static void operator delete(void* in_object, ::std::size_t in_size); \
+    static ::CSCore::ObjectPool<x>& GetPool();
+
+#define CS_DEFINE_POOLEDTYPE(x) \
+    void* x::operator new(::std::size_t in_size) \
+    { \
+        if (in_size == sizeof(x)) \
+        { \
+            return GetPool().Allocate(); \
+        } \
+        return ::operator new(in_size); \
+    } \
+    void x::operator delete(void* in_object, ::std::size_t in_size) \
+    { \
+        if (in_size == sizeof(x)) \
+        { \
+            GetPool().Deallocate(in_object); \
+            return; \
+        } \
+        ::operator delete(in_object); \
+    } \
+    ::CSCore::ObjectPool<x>& x::GetPool() \
+    { \
+        static ::CSCore::ObjectPool<x>* pool = new ::CSCore::ObjectPool<x>(); \
+        return *pool; \
+    }
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------
+        /// A pool of memory for objects of a single type. Objects are allocated
+        /// from contiguous chunks of slots rather than individually from the
+        /// heap, and freed slots are reused, so creating and destroying many
+        /// objects is cheap and the objects are kept close together in memory.
+        /// The pool is typically used through CS_DECLARE_POOLEDTYPE rather than
+        /// directly.
+        ///
+        /// Each slot carries a generation which changes when its object is
+        /// freed. This allows Handles to be used as non-owning references to
+        /// pooled objects: a handle resolves to null once its object has been
+        /// destroyed, even if the slot has since been reused.
+        ///
+        /// Allocation and deallocation are thread-safe, and a handle can be
+        /// resolved on any thread. However, the object a handle resolves to
+        /// can still be destroyed afterwards by another thread, so handles
+        /// to objects shared between threads need external synchronisation.
+        //------------------------------------------------------------------------
+        template <typename TType> class ObjectPool final
+        {
+        private:
+            struct Slot;
+            
+        public:
+            CS_DECLARE_NOCOPY(ObjectPool);
+            //--------------------------------------------------------------------
+            /// A generation checked, non-owning reference to an object in the
+            /// pool. Handles are small and trivially copyable, and resolve to
+            /// null once the referenced object has been destroyed.
+            //--------------------------------------------------------------------
+            class Handle final
+            {
+            public:
+                //----------------------------------------------------------------
+                /// Constructs a null handle.
+                //----------------------------------------------------------------
+                Handle() = default;
+                //----------------------------------------------------------------
+                /// @return The referenced object, or null if it has been
+                /// destroyed or this is a null handle.
+                //----------------------------------------------------------------
+                TType* Get() const;
+                //----------------------------------------------------------------
+                /// @return Whether or not the referenced object still exists.
+                //----------------------------------------------------------------
+                explicit operator bool() const;
+                //----------------------------------------------------------------
+                /// @param The handle to compare against.
+                ///
+                /// @return Whether or not the handles refer to the same object.
+                //----------------------------------------------------------------
+                bool operator==(const Handle& in_other) const;
+                //----------------------------------------------------------------
+                /// @param The handle to compare against.
+                ///
+                /// @return Whether or not the handles refer to different objects.
+                //----------------------------------------------------------------
+                bool operator!=(const Handle& in_other) const;
+                
+            private:
+                friend class ObjectPool;
+                //----------------------------------------------------------------
+                /// Constructor.
+                ///
+                /// @param The slot the object is in.
+                /// @param The generation of the slot when the handle was made.
+                //----------------------------------------------------------------
+                Handle(const Slot* in_slot, u32 in_generation);
+                
+                const Slot* m_slot = nullptr;
+                u32 m_generation = 0;
+            };
+            //--------------------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @param [Optional] The number of slots in the first chunk. Each
+            /// further chunk is double the size of the last, up to a limit.
+            //--------------------------------------------------------------------
+            ObjectPool(u32 in_initialChunkSize = 32);
+            //--------------------------------------------------------------------
+            /// Allocates uninitialised memory for a single object.
+            ///
+            /// @return The memory.
+            //--------------------------------------------------------------------
+            void* Allocate();
+            //--------------------------------------------------------------------
+            /// Returns memory allocated by this pool. Any handles to the object
+            /// in it will no longer resolve. The object must already have been
+            /// destroyed.
+            ///
+            /// @param The memory.
+            //--------------------------------------------------------------------
+            void Deallocate(void* in_object);
+            //--------------------------------------------------------------------
+            /// @param An object.
+            ///
+            /// @return A handle to the object, or a null handle if the object
+            /// was not allocated from this pool.
+            //--------------------------------------------------------------------
+            Handle GetHandle(const TType* in_object) const;
+            //--------------------------------------------------------------------
+            /// @return The number of objects currently allocated.
+            //--------------------------------------------------------------------
+            u32 GetNumAllocated() const;
+            //--------------------------------------------------------------------
+            /// @return The total number of slots in the pool.
+            //--------------------------------------------------------------------
+            u32 GetCapacity() const;
+            
+        private:
+            //--------------------------------------------------------------------
+            /// A single slot in the pool. The object storage is the first
+            /// member so that an object pointer is also a slot pointer.
+            //--------------------------------------------------------------------
+            struct Slot
+            {
+                typename std::aligned_storage<sizeof(TType), std::alignment_of<TType>::value>::type m_storage;
+                std::atomic<u32> m_generation{0};
+                Slot* m_nextFree = nullptr;
+            };
+            //--------------------------------------------------------------------
+            /// A contiguous block of slots.
+            //--------------------------------------------------------------------
+            struct Chunk
+            {
+                std::unique_ptr<Slot[]> m_slots;
+                u32 m_size;
+            };
+            //--------------------------------------------------------------------
+            /// Adds a new chunk to the pool and puts its slots on the free
+            /// list. The mutex must be locked.
+            //--------------------------------------------------------------------
+            void AddChunk();
+            
+            mutable std::mutex m_mutex;
+            std::vector<Chunk> m_chunks;
+            Slot* m_freeList = nullptr;
+            u32 m_nextChunkSize;
+            u32 m_numAllocated = 0;
+            u32 m_capacity = 0;
+        };
+        
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> ObjectPool<TType>::Handle::Handle(const Slot* in_slot, u32 in_generation)
+            : m_slot(in_slot), m_generation(in_generation)
+        {
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> TType* ObjectPool<TType>::Handle::Get() const
+        {
+            if (m_slot == nullptr || m_slot->m_generation.load(std::memory_order_acquire) != m_generation)
+            {
+                return nullptr;
+            }
+            
+            return reinterpret_cast<TType*>(const_cast<Slot*>(m_slot));
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> ObjectPool<TType>::Handle::operator bool() const
+        {
+            return (Get() != nullptr);
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> bool ObjectPool<TType>::Handle::operator==(const Handle& in_other) const
+        {
+            return (m_slot == in_other.m_slot && m_generation == in_other.m_generation);
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> bool ObjectPool<TType>::Handle::operator!=(const Handle& in_other) const
+        {
+            return !(*this == in_other);
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> ObjectPool<TType>::ObjectPool(u32 in_initialChunkSize)
+            : m_nextChunkSize(in_initialChunkSize)
+        {
+            CS_ASSERT(in_initialChunkSize > 0, "Object pool chunks must contain at least one slot.");
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> void* ObjectPool<TType>::Allocate()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            if (m_freeList == nullptr)
+            {
+                AddChunk();
+            }
+            
+            Slot* slot = m_freeList;
+            m_freeList = slot->m_nextFree;
+            slot->m_nextFree = nullptr;
+            ++m_numAllocated;
+            
+            return &slot->m_storage;
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> void ObjectPool<TType>::Deallocate(void* in_object)
+        {
+            if (in_object == nullptr)
+            {
+                return;
+            }
+            
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            Slot* slot = reinterpret_cast<Slot*>(in_object);
+            slot->m_generation.store(slot->m_generation.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            slot->m_nextFree = m_freeList;
+            m_freeList = slot;
+            --m_numAllocated;
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> typename ObjectPool<TType>::Handle ObjectPool<TType>::GetHandle(const TType* in_object) const
+        {
+            const Slot* slot = reinterpret_cast<const Slot*>(in_object);
+            std::less<const Slot*> isLess;
+            
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            for (const auto& chunk : m_chunks)
+            {
+                const Slot* first = chunk.m_slots.get();
+                const Slot* last = first + chunk.m_size;
+                if (isLess(slot, first) == false && isLess(slot, last) == true)
+                {
+                    return Handle(slot, slot->m_generation.load(std::memory_order_relaxed));
+                }
+            }
+            
+            return Handle();
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> u32 ObjectPool<TType>::GetNumAllocated() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            return m_numAllocated;
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> u32 ObjectPool<TType>::GetCapacity() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            return m_capacity;
+        }
+        //------------------------------------------------------------------------
+        //------------------------------------------------------------------------
+        template <typename TType> void ObjectPool<TType>::AddChunk()
+        {
+            const u32 k_maxChunkSize = 1024;
+            
+            Chunk chunk;
+            chunk.m_size = m_nextChunkSize;
+            chunk.m_slots.reset(new Slot[chunk.m_size]);
+            
+            //Push in reverse so that the slots are handed out in address order.
+            for (u32 i = chunk.m_size; i > 0; --i)
+            {
+                Slot* slot = &chunk.m_slots[i - 1];
+                slot->m_nextFree = m_freeList;
+                m_freeList = slot;
+            }
+            
+            m_capacity += chunk.m_size;
+            m_chunks.push_back(std::move(chunk));
+            
+            m_nextChunkSize = std::min(m_nextChunkSize * 2, std::max(k_maxChunkSize, m_nextChunkSize));
+        }
+    }
+}
+
+#endif
@@ -34,6 +34,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <utility>
 
 namespace ChilliSource
 {
@@ -57,7 +58,7 @@ namespace ChilliSource
                 std::unique_lock<std::mutex> QueueLock(mQueueMutex);
                 
                 //Push the object onto the queue
-                mQueue.push(inObject);
+                mQueue.push(std::move(inObject));
                 
                 //Make sure when we wake the thread up it's not blocked
                 QueueLock.unlock();
@@ -96,6 +97,29 @@ namespace ChilliSource
                 return mQueue.front();
             }
             //-----------------------------------------------------------
+            /// Thread safe method that moves the front object out of
+            /// the queue and pops it in a single operation, so that
+            /// two threads cannot take the same object.
+            ///
+            /// @param [Out] The front object. This is untouched if the
+            /// queue is empty.
+            ///
+            /// @return Whether or not an object was popped.
+            //-----------------------------------------------------------
+            bool try_pop(T& out_object)
+            {
+                std::unique_lock<std::mutex> QueueLock(mQueueMutex);
+                
+                if (mQueue.empty())
+                {
+                    return false;
+                }
+                
+                out_object = std::move(mQueue.front());
+                mQueue.pop();
+                return true;
+            }
+            //-----------------------------------------------------------
             /// Thread safe method that locks the queue while it pops
             /// the top object.
             ///
@@ -0,0 +1,523 @@
+//
+//  rcu_vector.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_RCUVECTOR_H_
+#define _CHILLISOURCE_CORE_CONTAINER_RCUVECTOR_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <initializer_list>
+#include <mutex>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------
+        /// A thread safe dynamic array using read-copy-update. Readers acquire
+        /// an immutable snapshot of the array and iterate it without locking,
+        /// while writers copy the array, modify the copy and publish it as the
+        /// new version. Old versions are reclaimed once every reader that could
+        /// be using them has released its snapshot.
+        ///
+        /// This is intended for lists which are iterated far more often than
+        /// they are modified, such as event listener lists. Unlike
+        /// concurrent_vector there is no need to lock around iteration, and
+        /// modifying the array while iterating, including from within the loop,
+        /// is safe; the change is seen by the next snapshot.
+        ///
+        /// Acquiring a snapshot is lock-free and iterating it is wait-free.
+        /// Writers are serialised with each other but never wait for readers.
+        ///
+        /// Readers are tracked with a pair of counters indexed by an epoch.
+        /// When old versions are to be reclaimed the epoch is flipped so that
+        /// new readers use the other counter, and the versions are deleted once
+        /// the counter for the previous epoch reaches zero.
+        ///
+        /// NOTE: This class syntax mimics STL and therefore does not use the CS
+        /// coding standards.
+        //------------------------------------------------------------------------
+        template <typename TType> class rcu_vector final
+        {
+        public:
+            CS_DECLARE_NOCOPY(rcu_vector);
+            
+            using const_iterator = typename std::vector<TType>::const_iterator;
+            using const_reverse_iterator = typename std::vector<TType>::const_reverse_iterator;
+            
+            //--------------------------------------------------------------------
+            /// An immutable view of the array at the time it was acquired. The
+            /// contents are guaranteed to remain valid for the lifetime of the
+            /// snapshot, so snapshots should be short lived to allow old
+            /// versions to be reclaimed.
+            //--------------------------------------------------------------------
+            class snapshot final
+            {
+            public:
+                CS_DECLARE_NOCOPY(snapshot);
+                //----------------------------------------------------------------
+                /// Move constructor
+                ///
+                /// @param The snapshot to move.
+                //----------------------------------------------------------------
+                snapshot(snapshot&& in_toMove);
+                //----------------------------------------------------------------
+                /// @return Iterator pointing to the beginning of the snapshot
+                //----------------------------------------------------------------
+                const_iterator begin() const;
+                //----------------------------------------------------------------
+                /// @return Iterator pointing to the end of the snapshot
+                //----------------------------------------------------------------
+                const_iterator end() const;
+                //----------------------------------------------------------------
+                /// @return Iterator pointing to the last element of the snapshot
+                //----------------------------------------------------------------
+                const_reverse_iterator rbegin() const;
+                //----------------------------------------------------------------
+                /// @return Iterator pointing to before the first element of the
+                /// snapshot
+                //----------------------------------------------------------------
+                const_reverse_iterator rend() const;
+                //----------------------------------------------------------------
+                /// @param Index
+                ///
+                /// @return The object at the given index (undefined if out of
+                /// bounds)
+                //----------------------------------------------------------------
+                const TType& operator[](u32 in_index) const;
+                //----------------------------------------------------------------
+                /// @return The number of items in the snapshot
+                //----------------------------------------------------------------
+                u32 size() const;
+                //----------------------------------------------------------------
+                /// @return Whether the snapshot is empty or not
+                //----------------------------------------------------------------
+                bool empty() const;
+                //----------------------------------------------------------------
+                /// Destructor. Releases the snapshot.
+                //----------------------------------------------------------------
+                ~snapshot();
+                
+            private:
+                friend class rcu_vector;
+                //----------------------------------------------------------------
+                /// Constructor
+                ///
+                /// @param The reader counter this snapshot is registered with.
+                /// @param The version of the array.
+                //----------------------------------------------------------------
+                snapshot(std::atomic<u32>* in_readerCount, const std::vector<TType>* in_objects);
+                
+                std::atomic<u32>* m_readerCount;
+                const std::vector<TType>* m_objects;
+            };
+            
+            //--------------------------------------------------------------------
+            /// Constructor default
+            //--------------------------------------------------------------------
+            rcu_vector();
+            //--------------------------------------------------------------------
+            /// Construct from initialiser list
+            ///
+            /// @param Initialiser list
+            //--------------------------------------------------------------------
+            rcu_vector(std::initializer_list<TType> in_initialObjects);
+            //--------------------------------------------------------------------
+            /// Acquires a snapshot of the current contents of the array. This
+            /// can be called from any thread, including from within a loop
+            /// over another snapshot.
+            ///
+            /// @return The snapshot.
+            //--------------------------------------------------------------------
+            snapshot read() const;
+            //--------------------------------------------------------------------
+            /// Push the object onto the back of the array. This does not affect
+            /// existing snapshots.
+            ///
+            /// @param Object to add
+            //--------------------------------------------------------------------
+            void push_back(const TType& in_object);
+            //--------------------------------------------------------------------
+            /// Push the object onto the back of the array. This does not affect
+            /// existing snapshots.
+            ///
+            /// @param Object to add
+            //--------------------------------------------------------------------
+            void push_back(TType&& in_object);
+            //--------------------------------------------------------------------
+            /// Removes the first object equal to the given object. This does not
+            /// affect existing snapshots.
+            ///
+            /// @param The object to remove
+            ///
+            /// @return Whether or not an object was removed.
+            //--------------------------------------------------------------------
+            bool erase(const TType& in_object);
+            //--------------------------------------------------------------------
+            /// Removes all objects for which the given predicate returns true.
+            /// This does not affect existing snapshots.
+            ///
+            /// @param The predicate.
+            ///
+            /// @return The number of objects removed.
+            //--------------------------------------------------------------------
+            template <typename TPredicate> u32 remove_if(TPredicate in_predicate);
+            //--------------------------------------------------------------------
+            /// Applies an arbitrary modification to the array. The given
+            /// function is passed a copy of the current contents which it can
+            /// modify freely, and the result is published as a single new
+            /// version. Writers are serialised so the function sees the result
+            /// of all previous modifications. The function must not modify this
+            /// array itself.
+            ///
+            /// @param The function, which takes a std::vector<TType>&.
+            //--------------------------------------------------------------------
+            template <typename TFunction> void update(TFunction in_function);
+            //--------------------------------------------------------------------
+            /// Clears the array. This does not affect existing snapshots.
+            //--------------------------------------------------------------------
+            void clear();
+            //--------------------------------------------------------------------
+            /// @return The number of items currently in the array
+            //--------------------------------------------------------------------
+            u32 size() const;
+            //--------------------------------------------------------------------
+            /// @return Whether the array is empty or not
+            //--------------------------------------------------------------------
+            bool empty() const;
+            //--------------------------------------------------------------------
+            /// Deletes any old versions which are no longer in use by a reader.
+            /// This is performed automatically after every modification, so
+            /// only needs to be called to release memory promptly when the
+            /// array is not modified again for some time.
+            //--------------------------------------------------------------------
+            void reclaim();
+            //--------------------------------------------------------------------
+            /// Destructor. There must be no outstanding snapshots.
+            //--------------------------------------------------------------------
+            ~rcu_vector();
+            
+        private:
+            //--------------------------------------------------------------------
+            /// Publishes a new version of the array and retires the previous
+            /// version. The writer mutex must be held.
+            ///
+            /// @param The new version.
+            //--------------------------------------------------------------------
+            void publish(std::vector<TType>* in_objects);
+            //--------------------------------------------------------------------
+            /// Deletes the old versions if the readers of the previous epoch
+            /// have finished, and flips the epoch for any versions retired
+            /// since. The writer mutex must be held.
+            //--------------------------------------------------------------------
+            void reclaim_locked();
+            //--------------------------------------------------------------------
+            /// Deletes all of the given versions.
+            ///
+            /// @param [Out] The versions to delete. This is cleared.
+            //--------------------------------------------------------------------
+            static void delete_versions(std::vector<std::vector<TType>*>& out_versions);
+            
+            std::atomic<std::vector<TType>*> m_objects;
+            std::atomic<u32> m_epoch;
+            mutable std::atomic<u32> m_readerCounts[2];
+            
+            std::mutex m_writeMutex;
+            std::vector<std::vector<TType>*> m_retiredVersions;
+            std::vector<std::vector<TType>*> m_flippedVersions;
+        };
+        
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> rcu_vector<TType>::snapshot::snapshot(std::atomic<u32>* in_readerCount, const std::vector<TType>* in_objects)
+            : m_readerCount(in_readerCount), m_objects(in_objects)
+        {
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> rcu_vector<TType>::snapshot::snapshot(snapshot&& in_toMove)
+            : m_readerCount(in_toMove.m_readerCount), m_objects(in_toMove.m_objects)
+        {
+            in_toMove.m_readerCount = nullptr;
+            in_toMove.m_objects = nullptr;
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> typename rcu_vector<TType>::const_iterator rcu_vector<TType>::snapshot::begin() const
+        {
+            return m_objects->begin();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> typename rcu_vector<TType>::const_iterator rcu_vector<TType>::snapshot::end() const
+        {
+            return m_objects->end();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> typename rcu_vector<TType>::const_reverse_iterator rcu_vector<TType>::snapshot::rbegin() const
+        {
+            return m_objects->rbegin();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> typename rcu_vector<TType>::const_reverse_iterator rcu_vector<TType>::snapshot::rend() const
+        {
+            return m_objects->rend();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> const TType& rcu_vector<TType>::snapshot::operator[](u32 in_index) const
+        {
+            return (*m_objects)[in_index];
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> u32 rcu_vector<TType>::snapshot::size() const
+        {
+            return u32(m_objects->size());
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> bool rcu_vector<TType>::snapshot::empty() const
+        {
+            return m_objects->empty();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> rcu_vector<TType>::snapshot::~snapshot()
+        {
+            if (m_readerCount != nullptr)
+            {
+                m_readerCount->fetch_sub(1, std::memory_order_release);
+            }
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> rcu_vector<TType>::rcu_vector()
+            : m_objects(new std::vector<TType>()), m_epoch(0)
+        {
+            m_readerCounts[0] = 0;
+            m_readerCounts[1] = 0;
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> rcu_vector<TType>::rcu_vector(std::initializer_list<TType> in_initialObjects)
+            : m_objects(new std::vector<TType>(in_initialObjects)), m_epoch(0)
+        {
+            m_readerCounts[0] = 0;
+            m_readerCounts[1] = 0;
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> typename rcu_vector<TType>::snapshot rcu_vector<TType>::read() const
+        {
+            //The reader is registered against the current epoch, and the epoch is checked again
+            //afterwards. If it has changed the writer may already have checked the counter, so
+            //the reader must register against the new epoch instead.
+            while (true)
+            {
+                const u32 epoch = m_epoch.load();
+                std::atomic<u32>* readerCount = &m_readerCounts[epoch & 1];
+                readerCount->fetch_add(1);
+                
+                if (m_epoch.load() == epoch)
+                {
+                    return snapshot(readerCount, m_objects.load());
+                }
+                
+                readerCount->fetch_sub(1);
+            }
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> void rcu_vector<TType>::push_back(const TType& in_object)
+        {
+            std::unique_lock<std::mutex> lock(m_writeMutex);
+            
+            std::vector<TType>* objects = new std::vector<TType>();
+            objects->reserve(m_objects.load()->size() + 1);
+            *objects = *m_objects.load();
+            objects->push_back(in_object);
+            publish(objects);
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> void rcu_vector<TType>::push_back(TType&& in_object)
+        {
+            std::unique_lock<std::mutex> lock(m_writeMutex);
+            
+            std::vector<TType>* objects = new std::vector<TType>();
+            objects->reserve(m_objects.load()->size() + 1);
+            *objects = *m_objects.load();
+            objects->push_back(std::move(in_object));
+            publish(objects);
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> bool rcu_vector<TType>::erase(const TType& in_object)
+        {
+            bool erased = false;
+            remove_if([&erased, &in_object](const TType& in_candidate)
+            {
+                if (erased == false && in_candidate == in_object)
+                {
+                    erased = true;
+                    return true;
+                }
+                return false;
+            });
+            return erased;
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> template <typename TPredicate> u32 rcu_vector<TType>::remove_if(TPredicate in_predicate)
+        {
+            std::unique_lock<std::mutex> lock(m_writeMutex);
+            
+            const std::vector<TType>* current = m_objects.load();
+            std::vector<TType>* objects = new std::vector<TType>();
+            objects->reserve(current->size());
+            for (const auto& object : *current)
+            {
+                if (in_predicate(object) == false)
+                {
+                    objects->push_back(object);
+                }
+            }
+            
+            const u32 numRemoved = u32(current->size() - objects->size());
+            if (numRemoved == 0)
+            {
+                delete objects;
+                return 0;
+            }
+            
+            publish(objects);
+            return numRemoved;
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> template <typename TFunction> void rcu_vector<TType>::update(TFunction in_function)
+        {
+            std::unique_lock<std::mutex> lock(m_writeMutex);
+            
+            std::vector<TType>* objects = new std::vector<TType>(*m_objects.load());
+            in_function(*objects);
+            publish(objects);
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> void rcu_vector<TType>::clear()
+        {
+            std::unique_lock<std::mutex> lock(m_writeMutex);
+            
+            if (m_objects.load()->empty() == false)
+            {
+                publish(new std::vector<TType>());
+            }
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> u32 rcu_vector<TType>::size() const
+        {
+            return read().size();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> bool rcu_vector<TType>::empty() const
+        {
+            return read().empty();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> void rcu_vector<TType>::reclaim()
+        {
+            std::unique_lock<std::mutex> lock(m_writeMutex);
+            reclaim_locked();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> void rcu_vector<TType>::publish(std::vector<TType>* in_objects)
+        {
+            m_retiredVersions.push_back(m_objects.exchange(in_objects));
+            reclaim_locked();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> void rcu_vector<TType>::reclaim_locked()
+        {
+            //Versions that were retired before the last flip can be deleted once every reader
+            //registered against the previous epoch has finished. Until then the epoch cannot be
+            //flipped again.
+            if (m_flippedVersions.empty() == false)
+            {
+                if (m_readerCounts[(m_epoch.load() - 1) & 1].load(std::memory_order_acquire) != 0)
+                {
+                    return;
+                }
+                
+                delete_versions(m_flippedVersions);
+            }
+            
+            if (m_retiredVersions.empty() == false)
+            {
+                m_flippedVersions.swap(m_retiredVersions);
+                const u32 previousEpoch = m_epoch.fetch_add(1);
+                
+                if (m_readerCounts[previousEpoch & 1].load(std::memory_order_acquire) == 0)
+                {
+                    delete_versions(m_flippedVersions);
+                }
+            }
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> void rcu_vector<TType>::delete_versions(std::vector<std::vector<TType>*>& out_versions)
+        {
+            for (auto version : out_versions)
+            {
+                delete version;
+            }
+            out_versions.clear();
+        }
+        //--------------------------------------------------------------------
+        //--------------------------------------------------------------------
+        template <typename TType> rcu_vector<TType>::~rcu_vector()
+        {
+            CS_ASSERT(m_readerCounts[0] == 0 && m_readerCounts[1] == 0, "Cannot destroy an rcu_vector while snapshots of it exist.");
+            
+            delete_versions(m_retiredVersions);
+            delete_versions(m_flippedVersions);
+            delete m_objects.load();
+        }
+    }
+}
+
+#endif
@@ -28,6 +28,12 @@
 
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
 
+#include <cstring>
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
 namespace ChilliSource
 {
     namespace Core
@@ -65,6 +71,110 @@ namespace ChilliSource
                     2847714899u, 3736837829u, 1202900863u, 817233897u, 3183342108u, 3401237130u, 1404277552u, 615818150u, 3134207493u,3453421203u,
                     1423857449u, 601450431u, 3009837614u, 3294710456u, 1567103746u, 711928724u, 3020668471u, 3272380065u, 1510334235u, 755167117u
                 };
+                
+                //-------------------------------------------------------------
+                /// The lookup tables used to process 8 bytes per iteration.
+                /// The first table is the standard byte-wise lookup table and
+                /// each subsequent table advances a byte through one more
+                /// zero byte.
+                //-------------------------------------------------------------
+                struct SlicingTables
+                {
+                    u32 m_tables[8][256];
+                    
+                    SlicingTables()
+                    {
+                        for(u32 i = 0; i < 256; ++i)
+                        {
+                            m_tables[0][i] = kaudwCRC32Lookup[i];
+                        }
+                        
+                        for(u32 i = 0; i < 256; ++i)
+                        {
+                            for(u32 j = 1; j < 8; ++j)
+                            {
+                                u32 udwPrevious = m_tables[j - 1][i];
+                                m_tables[j][i] = (udwPrevious >> 8) ^ kaudwCRC32Lookup[udwPrevious & 0xFF];
+                            }
+                        }
+                    }
+                };
+                //-------------------------------------------------------------
+                /// @return The slicing-by-8 lookup tables. These are built on
+                /// first use so they are safe to use during static
+                /// initialisation.
+                //-------------------------------------------------------------
+                const SlicingTables& GetSlicingTables()
+                {
+                    static const SlicingTables k_slicingTables;
+                    return k_slicingTables;
+                }
+                //-------------------------------------------------------------
+                /// Updates the CRC register with the given data. The register
+                /// is not inverted before or after, so the caller is
+                /// responsible for doing so. The ARMv8 CRC32 instructions are
+                /// used where available; otherwise the data is processed 8
+                /// bytes at a time using slicing-by-8. SSE4.2 is not used as
+                /// its CRC32 instruction uses the Castagnoli polynomial,
+                /// which would produce different hash codes.
+                ///
+                /// @param The CRC register.
+                /// @param The data.
+                /// @param The size of the data in bytes.
+                ///
+                /// @return The updated CRC register.
+                //-------------------------------------------------------------
+                u32 UpdateRegister(u32 in_register, const u8* in_data, u32 in_sizeInBytes)
+                {
+                    u32 udwRegister = in_register;
+                    const u8* pubyData = in_data;
+                    u32 udwRemaining = in_sizeInBytes;
+                    
+#if defined(__ARM_FEATURE_CRC32)
+                    while(udwRemaining >= 8)
+                    {
+                        u64 uddwNext;
+                        memcpy(&uddwNext, pubyData, sizeof(u64));
+                        udwRegister = __crc32d(udwRegister, uddwNext);
+                        pubyData += 8;
+                        udwRemaining -= 8;
+                    }
+                    
+                    while(udwRemaining > 0)
+                    {
+                        udwRegister = __crc32b(udwRegister, *pubyData++);
+                        --udwRemaining;
+                    }
+#else
+                    if(udwRemaining >= 16)
+                    {
+                        const SlicingTables& tables = GetSlicingTables();
+                        while(udwRemaining >= 8)
+                        {
+                            u32 udwLow, udwHigh;
+                            memcpy(&udwLow, pubyData, sizeof(u32));
+                            memcpy(&udwHigh, pubyData + 4, sizeof(u32));
+                            udwLow ^= udwRegister;
+                            
+                            udwRegister = tables.m_tables[7][udwLow & 0xFF] ^ tables.m_tables[6][(udwLow >> 8) & 0xFF] ^
+                                tables.m_tables[5][(udwLow >> 16) & 0xFF] ^ tables.m_tables[4][udwLow >> 24] ^
+                                tables.m_tables[3][udwHigh & 0xFF] ^ tables.m_tables[2][(udwHigh >> 8) & 0xFF] ^
+                                tables.m_tables[1][(udwHigh >> 16) & 0xFF] ^ tables.m_tables[0][udwHigh >> 24];
+                            
+                            pubyData += 8;
+                            udwRemaining -= 8;
+                        }
+                    }
+                    
+                    while(udwRemaining > 0)
+                    {
+                        udwRegister = (udwRegister >> 8) ^ kaudwCRC32Lookup[(udwRegister & 0xFF) ^ *pubyData++];
+                        --udwRemaining;
+                    }
+#endif
+                    
+                    return udwRegister;
+                }
             }
             //-------------------------------------------------------------
             /// Generate Hash Code
@@ -84,17 +194,7 @@ namespace ChilliSource
             //-------------------------------------------------------------
             u32 GenerateHashCode(const s8* instrVal)
             {
-                u32 Result		= 0xffffffff;
-                u16 Index		= 0;
-                u8	NextChar	= 0;
-                
-                while(instrVal[Index] != '\0')
-                {
-                    NextChar = instrVal[Index++];
-                    Result = (Result >> 8) ^ kaudwCRC32Lookup[(Result & 0xFF) ^ NextChar];
-                }
-                
-                return ~Result;
+                return GenerateHashCode(instrVal, (u32)strlen(instrVal));
             }
             //-------------------------------------------------------------
             /// Generate Hash Code
@@ -105,15 +205,19 @@ namespace ChilliSource
             //-------------------------------------------------------------
             u32 GenerateHashCode(const s8* inbyVal, u32 inudwSizeInBytes)
             {
-                u32 Result = 0xffffffff;
-                
-                for(u32 i=0; i<inudwSizeInBytes; ++i)
-                {
-                    u8 byNextByte = inbyVal[i];
-                    Result = (Result >> 8) ^ kaudwCRC32Lookup[(Result & 0xFF) ^ byNextByte];
-                }
-                
-                return ~Result;
+                return UpdateHashCode(0, inbyVal, inudwSizeInBytes);
+            }
+            //-------------------------------------------------------------
+            /// Update Hash Code
+            ///
+            /// @param Hash code of the preceding data
+            /// @param Data to hash
+            /// @param Size of data in bytes
+            /// @return CRC 32 hash code
+            //-------------------------------------------------------------
+            u32 UpdateHashCode(u32 inudwHashCode, const s8* inbyVal, u32 inudwSizeInBytes)
+            {
+                return ~UpdateRegister(~inudwHashCode, reinterpret_cast<const u8*>(inbyVal), inudwSizeInBytes);
             }
         }
     }
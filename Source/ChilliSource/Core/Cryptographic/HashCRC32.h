@@ -59,6 +59,19 @@ namespace ChilliSource
             /// @return CRC 32 hash code
             //-------------------------------------------------------------
             u32 GenerateHashCode(const s8* inbyVal, u32 inudwSizeInBytes);
+            //-------------------------------------------------------------
+            /// Update Hash Code
+            ///
+            /// Continues a hash code with further data, allowing data to
+            /// be hashed in blocks. Passing 0 as the hash code is the
+            /// same as calling GenerateHashCode().
+            ///
+            /// @param Hash code of the preceding data
+            /// @param Data to hash
+            /// @param Size of data in bytes
+            /// @return CRC 32 hash code
+            //-------------------------------------------------------------
+            u32 UpdateHashCode(u32 inudwHashCode, const s8* inbyVal, u32 inudwSizeInBytes);
         }
     }
 }
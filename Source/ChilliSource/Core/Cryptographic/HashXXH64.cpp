@@ -0,0 +1,192 @@
+//
+//  HashXXH64.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Cryptographic/HashXXH64.h>
+
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace HashXXH64
+        {
+            namespace
+            {
+                const u64 k_prime1 = 11400714785074694791ULL;
+                const u64 k_prime2 = 14029467366897019727ULL;
+                const u64 k_prime3 = 1609587929392839161ULL;
+                const u64 k_prime4 = 9650029242287828579ULL;
+                const u64 k_prime5 = 2870177450012600261ULL;
+                
+                //-------------------------------------------------------------
+                /// @param The value to rotate.
+                /// @param The number of bits to rotate left by.
+                ///
+                /// @return The rotated value.
+                //-------------------------------------------------------------
+                inline u64 RotateLeft(u64 in_value, u32 in_bits)
+                {
+                    return (in_value << in_bits) | (in_value >> (64 - in_bits));
+                }
+                //-------------------------------------------------------------
+                /// @param The data to read from. This need not be aligned.
+                ///
+                /// @return The little endian 64-bit value at the data.
+                //-------------------------------------------------------------
+                inline u64 Read64(const u8* in_data)
+                {
+                    u64 value;
+                    memcpy(&value, in_data, sizeof(u64));
+                    return value;
+                }
+                //-------------------------------------------------------------
+                /// @param The data to read from. This need not be aligned.
+                ///
+                /// @return The little endian 32-bit value at the data.
+                //-------------------------------------------------------------
+                inline u32 Read32(const u8* in_data)
+                {
+                    u32 value;
+                    memcpy(&value, in_data, sizeof(u32));
+                    return value;
+                }
+                //-------------------------------------------------------------
+                /// Mixes 8 bytes of input into an accumulator.
+                ///
+                /// @param The accumulator.
+                /// @param The input.
+                ///
+                /// @return The new accumulator.
+                //-------------------------------------------------------------
+                inline u64 Round(u64 in_accumulator, u64 in_input)
+                {
+                    in_accumulator += in_input * k_prime2;
+                    in_accumulator = RotateLeft(in_accumulator, 31);
+                    return in_accumulator * k_prime1;
+                }
+                //-------------------------------------------------------------
+                /// Merges one of the four lane accumulators into the hash.
+                ///
+                /// @param The hash.
+                /// @param The lane accumulator.
+                ///
+                /// @return The new hash.
+                //-------------------------------------------------------------
+                inline u64 MergeRound(u64 in_hash, u64 in_accumulator)
+                {
+                    in_hash ^= Round(0, in_accumulator);
+                    return in_hash * k_prime1 + k_prime4;
+                }
+            }
+            //-------------------------------------------------------------
+            //-------------------------------------------------------------
+            u64 GenerateHashCode(const std::string& in_value, u64 in_seed)
+            {
+                return GenerateHashCode(in_value.c_str(), (u32)in_value.size(), in_seed);
+            }
+            //-------------------------------------------------------------
+            //-------------------------------------------------------------
+            u64 GenerateHashCodeCString(const s8* in_value, u64 in_seed)
+            {
+                return GenerateHashCode(in_value, (u32)strlen(in_value), in_seed);
+            }
+            //-------------------------------------------------------------
+            //-------------------------------------------------------------
+            u64 GenerateHashCode(const s8* in_value, u32 in_size, u64 in_seed)
+            {
+                const u8* data = reinterpret_cast<const u8*>(in_value);
+                const u8* end = data + in_size;
+                u64 hash = 0;
+                
+                if (in_size >= 32)
+                {
+                    //Process the input in 32 byte stripes across four independent lanes
+                    const u8* limit = end - 32;
+                    u64 lane1 = in_seed + k_prime1 + k_prime2;
+                    u64 lane2 = in_seed + k_prime2;
+                    u64 lane3 = in_seed;
+                    u64 lane4 = in_seed - k_prime1;
+                    
+                    do
+                    {
+                        lane1 = Round(lane1, Read64(data));
+                        lane2 = Round(lane2, Read64(data + 8));
+                        lane3 = Round(lane3, Read64(data + 16));
+                        lane4 = Round(lane4, Read64(data + 24));
+                        data += 32;
+                    }
+                    while (data <= limit);
+                    
+                    hash = RotateLeft(lane1, 1) + RotateLeft(lane2, 7) + RotateLeft(lane3, 12) + RotateLeft(lane4, 18);
+                    hash = MergeRound(hash, lane1);
+                    hash = MergeRound(hash, lane2);
+                    hash = MergeRound(hash, lane3);
+                    hash = MergeRound(hash, lane4);
+                }
+                else
+                {
+                    hash = in_seed + k_prime5;
+                }
+                
+                hash += (u64)in_size;
+                
+                //Process the remaining bytes
+                while (data + 8 <= end)
+                {
+                    hash ^= Round(0, Read64(data));
+                    hash = RotateLeft(hash, 27) * k_prime1 + k_prime4;
+                    data += 8;
+                }
+                
+                if (data + 4 <= end)
+                {
+                    hash ^= (u64)(Read32(data)) * k_prime1;
+                    hash = RotateLeft(hash, 23) * k_prime2 + k_prime3;
+                    data += 4;
+                }
+                
+                while (data < end)
+                {
+                    hash ^= (*data) * k_prime5;
+                    hash = RotateLeft(hash, 11) * k_prime1;
+                    ++data;
+                }
+                
+                //Avalanche
+                hash ^= hash >> 33;
+                hash *= k_prime2;
+                hash ^= hash >> 29;
+                hash *= k_prime3;
+                hash ^= hash >> 32;
+                
+                return hash;
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+//
+//  HashXXH64.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_CRYPTOGRAPHIC_HASHXXH64_H_
+#define _CHILLISOURCE_CORE_CRYPTOGRAPHIC_HASHXXH64_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //-------------------------------------------------------------
+        /// A fast 64-bit non-cryptographic hash, using the xxHash64
+        /// algorithm. This is considerably faster than CRC32 for large
+        /// inputs and far less likely to produce collisions, making it
+        /// suitable for generating ids such as resource ids. It should
+        /// not be used where a cryptographic hash is required.
+        //-------------------------------------------------------------
+        namespace HashXXH64
+        {
+            //-------------------------------------------------------------
+            /// @param String to hash
+            /// @param [Optional] Seed. Defaults to 0.
+            ///
+            /// @return 64-bit hash code
+            //-------------------------------------------------------------
+            u64 GenerateHashCode(const std::string& in_value, u64 in_seed = 0);
+            //-------------------------------------------------------------
+            /// Named differently to the binary data overload so that a
+            /// size is never mistaken for a seed.
+            ///
+            /// @param Null terminated string to hash
+            /// @param [Optional] Seed. Defaults to 0.
+            ///
+            /// @return 64-bit hash code
+            //-------------------------------------------------------------
+            u64 GenerateHashCodeCString(const s8* in_value, u64 in_seed = 0);
+            //-------------------------------------------------------------
+            /// @param Block of binary data
+            /// @param Size of data in bytes
+            /// @param [Optional] Seed. Defaults to 0.
+            ///
+            /// @return 64-bit hash code
+            //-------------------------------------------------------------
+            u64 GenerateHashCode(const s8* in_value, u32 in_size, u64 in_seed = 0);
+        }
+    }
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Delegate/ConnectableDelegate.h>
 #include <ChilliSource/Core/Delegate/DelegateConnection.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
 #include <ChilliSource/Core/Delegate/MakeConnectableDelegate.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 
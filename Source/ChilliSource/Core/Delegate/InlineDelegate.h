@@ -0,0 +1,443 @@
+//
+//  InlineDelegate.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_DELEGATE_INLINEDELEGATE_H_
+#define _CHILLISOURCE_CORE_DELEGATE_INLINEDELEGATE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        template <typename TSignature, u32 TBufferSize = 4 * sizeof(void*), bool TIsCopyable = true> class InlineDelegate;
+        //------------------------------------------------------------------
+        /// A move only version of InlineDelegate. This can hold callables
+        /// which cannot be copied, such as lambdas capturing a unique_ptr,
+        /// and is never copied when passed through queues.
+        //------------------------------------------------------------------
+        template <typename TSignature, u32 TBufferSize = 4 * sizeof(void*)> using UniqueDelegate = InlineDelegate<TSignature, TBufferSize, false>;
+        //------------------------------------------------------------------
+        /// A delegate which stores its callable in a fixed size buffer
+        /// inside the delegate itself rather than on the heap. This can be
+        /// used in place of std::function where a delegate is created or
+        /// copied frequently, such as event connections and tasks.
+        ///
+        /// Any callable which fits in the buffer and can be moved without
+        /// throwing is stored inline, and creating, copying and moving the
+        /// delegate will not allocate. The default buffer size is large
+        /// enough for the delegates returned by MakeDelegate(). Larger
+        /// callables are still supported, but are stored on the heap.
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> class InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable> final
+        {
+        public:
+            //------------------------------------------------------------------
+            /// Constructor. Creates an empty delegate.
+            //------------------------------------------------------------------
+            InlineDelegate();
+            //------------------------------------------------------------------
+            /// Constructor null. Creates an empty delegate.
+            ///
+            /// @param Null ptr
+            //------------------------------------------------------------------
+            InlineDelegate(std::nullptr_t in_null);
+            //------------------------------------------------------------------
+            /// Constructor. Wraps the given callable. If the callable is a
+            /// null function pointer or empty std::function the delegate
+            /// will be empty.
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TCallable, typename = typename std::enable_if<std::is_same<typename std::decay<TCallable>::type, InlineDelegate>::value == false>::type>
+            InlineDelegate(TCallable&& in_callable);
+            //------------------------------------------------------------------
+            /// Copy constructor. This is only available if the delegate is
+            /// copyable.
+            ///
+            /// @param The delegate to copy.
+            //------------------------------------------------------------------
+            InlineDelegate(const InlineDelegate& in_toCopy);
+            //------------------------------------------------------------------
+            /// Move constructor
+            ///
+            /// @param The delegate to move.
+            //------------------------------------------------------------------
+            InlineDelegate(InlineDelegate&& in_toMove) noexcept;
+            //------------------------------------------------------------------
+            /// Copy assignment. This is only available if the delegate is
+            /// copyable.
+            ///
+            /// @param The delegate to copy.
+            ///
+            /// @return This
+            //------------------------------------------------------------------
+            InlineDelegate& operator=(const InlineDelegate& in_toCopy);
+            //------------------------------------------------------------------
+            /// Move assignment
+            ///
+            /// @param The delegate to move.
+            ///
+            /// @return This
+            //------------------------------------------------------------------
+            InlineDelegate& operator=(InlineDelegate&& in_toMove) noexcept;
+            //------------------------------------------------------------------
+            /// Clears the delegate.
+            ///
+            /// @param Null ptr
+            ///
+            /// @return This
+            //------------------------------------------------------------------
+            InlineDelegate& operator=(std::nullptr_t in_null);
+            //------------------------------------------------------------------
+            /// Invokes the delegate. The delegate must not be empty.
+            ///
+            /// @param Variadic
+            ///
+            /// @return TReturnType
+            //------------------------------------------------------------------
+            TReturnType operator()(TArgTypes... in_args) const;
+            //------------------------------------------------------------------
+            /// @return Whether or not the delegate is not empty.
+            //------------------------------------------------------------------
+            explicit operator bool() const;
+            //------------------------------------------------------------------
+            /// @return Whether or not the callable is stored in the inline
+            /// buffer. This is false if the delegate is empty.
+            //------------------------------------------------------------------
+            bool IsInline() const;
+            //------------------------------------------------------------------
+            /// Destructor
+            //------------------------------------------------------------------
+            ~InlineDelegate();
+            
+        private:
+            using Buffer = typename std::aligned_storage<TBufferSize>::type;
+            using CopyFunction = void (*)(void*, const void*);
+            //------------------------------------------------------------------
+            /// The functions used to manage a specific type of callable.
+            //------------------------------------------------------------------
+            struct Operations
+            {
+                TReturnType (*m_invoke)(void*, TArgTypes...);
+                CopyFunction m_copy;
+                void (*m_move)(void*, void*);
+                void (*m_destroy)(void*);
+                bool m_isInline;
+            };
+            //------------------------------------------------------------------
+            /// Manages callables stored in the inline buffer.
+            //------------------------------------------------------------------
+            template <typename TCallable> struct InlineOperations
+            {
+                static TReturnType Invoke(void* in_buffer, TArgTypes... in_args)
+                {
+                    return (*static_cast<TCallable*>(in_buffer))(std::forward<TArgTypes>(in_args)...);
+                }
+                static void Copy(void* out_buffer, const void* in_buffer)
+                {
+                    new (out_buffer) TCallable(*static_cast<const TCallable*>(in_buffer));
+                }
+                static void Move(void* out_buffer, void* in_buffer)
+                {
+                    new (out_buffer) TCallable(std::move(*static_cast<TCallable*>(in_buffer)));
+                    static_cast<TCallable*>(in_buffer)->~TCallable();
+                }
+                static void Destroy(void* in_buffer)
+                {
+                    static_cast<TCallable*>(in_buffer)->~TCallable();
+                }
+            };
+            //------------------------------------------------------------------
+            /// Manages callables that are too large for the inline buffer. The
+            /// buffer holds a pointer to the callable.
+            //------------------------------------------------------------------
+            template <typename TCallable> struct HeapOperations
+            {
+                static TReturnType Invoke(void* in_buffer, TArgTypes... in_args)
+                {
+                    return (**static_cast<TCallable**>(in_buffer))(std::forward<TArgTypes>(in_args)...);
+                }
+                static void Copy(void* out_buffer, const void* in_buffer)
+                {
+                    new (out_buffer) TCallable*(new TCallable(**static_cast<TCallable* const*>(in_buffer)));
+                }
+                static void Move(void* out_buffer, void* in_buffer)
+                {
+                    new (out_buffer) TCallable*(*static_cast<TCallable**>(in_buffer));
+                }
+                static void Destroy(void* in_buffer)
+                {
+                    delete *static_cast<TCallable**>(in_buffer);
+                }
+            };
+            //------------------------------------------------------------------
+            /// @return Whether or not the given callable type can be stored
+            /// in the inline buffer.
+            //------------------------------------------------------------------
+            template <typename TCallable> static constexpr bool FitsInline()
+            {
+                return sizeof(TCallable) <= sizeof(Buffer) && alignof(TCallable) <= alignof(Buffer) && std::is_nothrow_move_constructible<TCallable>::value;
+            }
+            //------------------------------------------------------------------
+            /// @return The copy function for the given operations, or null if
+            /// the delegate is not copyable. This avoids requiring move only
+            /// callables to be copyable.
+            //------------------------------------------------------------------
+            template <typename TOperations> static constexpr CopyFunction GetCopyFunction(std::true_type in_isCopyable)
+            {
+                return &TOperations::Copy;
+            }
+            template <typename TOperations> static constexpr CopyFunction GetCopyFunction(std::false_type in_isCopyable)
+            {
+                return nullptr;
+            }
+            //------------------------------------------------------------------
+            /// @return The operations for the given callable type.
+            //------------------------------------------------------------------
+            template <typename TCallable> static const Operations* GetOperations(std::true_type in_fitsInline)
+            {
+                using TOperations = InlineOperations<TCallable>;
+                static const Operations k_operations = { &TOperations::Invoke, GetCopyFunction<TOperations>(std::integral_constant<bool, TIsCopyable>()), &TOperations::Move, &TOperations::Destroy, true };
+                return &k_operations;
+            }
+            template <typename TCallable> static const Operations* GetOperations(std::false_type in_fitsInline)
+            {
+                using TOperations = HeapOperations<TCallable>;
+                static const Operations k_operations = { &TOperations::Invoke, GetCopyFunction<TOperations>(std::integral_constant<bool, TIsCopyable>()), &TOperations::Move, &TOperations::Destroy, false };
+                return &k_operations;
+            }
+            //------------------------------------------------------------------
+            /// Stores the given callable inline.
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TCallable, typename TArg> void Store(TArg&& in_callable, std::true_type in_fitsInline)
+            {
+                new (&m_buffer) TCallable(std::forward<TArg>(in_callable));
+            }
+            //------------------------------------------------------------------
+            /// Stores the given callable on the heap.
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TCallable, typename TArg> void Store(TArg&& in_callable, std::false_type in_fitsInline)
+            {
+                new (&m_buffer) TCallable*(new TCallable(std::forward<TArg>(in_callable)));
+            }
+            //------------------------------------------------------------------
+            /// The following return whether the given callable is null, in
+            /// which case the delegate will be empty.
+            //------------------------------------------------------------------
+            template <typename TCallable> static bool IsNull(const TCallable& in_callable)
+            {
+                return false;
+            }
+            template <typename TCallable> static bool IsNull(TCallable* in_callable)
+            {
+                return in_callable == nullptr;
+            }
+            template <typename TClass, typename TMember> static bool IsNull(TMember TClass::* in_callable)
+            {
+                return in_callable == nullptr;
+            }
+            template <typename TSignature> static bool IsNull(const std::function<TSignature>& in_callable)
+            {
+                return in_callable == nullptr;
+            }
+            template <typename TSignature, u32 TOtherBufferSize, bool TOtherIsCopyable> static bool IsNull(const InlineDelegate<TSignature, TOtherBufferSize, TOtherIsCopyable>& in_callable)
+            {
+                return in_callable == nullptr;
+            }
+            
+            static_assert(sizeof(void*) <= TBufferSize, "The inline delegate buffer must be large enough to hold a pointer.");
+            
+            const Operations* m_operations = nullptr;
+            mutable Buffer m_buffer;
+        };
+        
+        //------------------------------------------------------------------
+        /// @param The delegate.
+        /// @param Null ptr
+        ///
+        /// @return Whether or not the delegate is empty.
+        //------------------------------------------------------------------
+        template <typename TSignature, u32 TBufferSize, bool TIsCopyable> bool operator==(const InlineDelegate<TSignature, TBufferSize, TIsCopyable>& in_delegate, std::nullptr_t in_null)
+        {
+            return static_cast<bool>(in_delegate) == false;
+        }
+        template <typename TSignature, u32 TBufferSize, bool TIsCopyable> bool operator==(std::nullptr_t in_null, const InlineDelegate<TSignature, TBufferSize, TIsCopyable>& in_delegate)
+        {
+            return static_cast<bool>(in_delegate) == false;
+        }
+        //------------------------------------------------------------------
+        /// @param The delegate.
+        /// @param Null ptr
+        ///
+        /// @return Whether or not the delegate is not empty.
+        //------------------------------------------------------------------
+        template <typename TSignature, u32 TBufferSize, bool TIsCopyable> bool operator!=(const InlineDelegate<TSignature, TBufferSize, TIsCopyable>& in_delegate, std::nullptr_t in_null)
+        {
+            return static_cast<bool>(in_delegate);
+        }
+        template <typename TSignature, u32 TBufferSize, bool TIsCopyable> bool operator!=(std::nullptr_t in_null, const InlineDelegate<TSignature, TBufferSize, TIsCopyable>& in_delegate)
+        {
+            return static_cast<bool>(in_delegate);
+        }
+        
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::InlineDelegate()
+        {
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::InlineDelegate(std::nullptr_t in_null)
+        {
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> template <typename TCallable, typename>
+        InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::InlineDelegate(TCallable&& in_callable)
+        {
+            using Callable = typename std::decay<TCallable>::type;
+            using IsInline = std::integral_constant<bool, FitsInline<Callable>()>;
+            
+            if (IsNull(in_callable) == false)
+            {
+                Store<Callable>(std::forward<TCallable>(in_callable), IsInline());
+                m_operations = GetOperations<Callable>(IsInline());
+            }
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::InlineDelegate(const InlineDelegate& in_toCopy)
+            : m_operations(in_toCopy.m_operations)
+        {
+            static_assert(TIsCopyable, "A UniqueDelegate cannot be copied.");
+            
+            if (m_operations != nullptr)
+            {
+                m_operations->m_copy(&m_buffer, &in_toCopy.m_buffer);
+            }
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::InlineDelegate(InlineDelegate&& in_toMove) noexcept
+            : m_operations(in_toMove.m_operations)
+        {
+            if (m_operations != nullptr)
+            {
+                m_operations->m_move(&m_buffer, &in_toMove.m_buffer);
+                in_toMove.m_operations = nullptr;
+            }
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable>
+        InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>& InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::operator=(const InlineDelegate& in_toCopy)
+        {
+            static_assert(TIsCopyable, "A UniqueDelegate cannot be copied.");
+            
+            if (this != &in_toCopy)
+            {
+                *this = nullptr;
+                
+                if (in_toCopy.m_operations != nullptr)
+                {
+                    in_toCopy.m_operations->m_copy(&m_buffer, &in_toCopy.m_buffer);
+                    m_operations = in_toCopy.m_operations;
+                }
+            }
+            
+            return *this;
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable>
+        InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>& InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::operator=(InlineDelegate&& in_toMove) noexcept
+        {
+            if (this != &in_toMove)
+            {
+                *this = nullptr;
+                
+                if (in_toMove.m_operations != nullptr)
+                {
+                    in_toMove.m_operations->m_move(&m_buffer, &in_toMove.m_buffer);
+                    m_operations = in_toMove.m_operations;
+                    in_toMove.m_operations = nullptr;
+                }
+            }
+            
+            return *this;
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable>
+        InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>& InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::operator=(std::nullptr_t in_null)
+        {
+            if (m_operations != nullptr)
+            {
+                m_operations->m_destroy(&m_buffer);
+                m_operations = nullptr;
+            }
+            
+            return *this;
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> TReturnType InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::operator()(TArgTypes... in_args) const
+        {
+            CS_ASSERT(m_operations != nullptr, "Cannot invoke an empty delegate.");
+            return m_operations->m_invoke(&m_buffer, std::forward<TArgTypes>(in_args)...);
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::operator bool() const
+        {
+            return m_operations != nullptr;
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> bool InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::IsInline() const
+        {
+            return m_operations != nullptr && m_operations->m_isInline == true;
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes, u32 TBufferSize, bool TIsCopyable> InlineDelegate<TReturnType(TArgTypes...), TBufferSize, TIsCopyable>::~InlineDelegate()
+        {
+            *this = nullptr;
+        }
+    }
+}
+
+#endif
@@ -29,6 +29,9 @@
 #ifndef _CHILLISOURCE_CORE_DELEGATE_MAKEDELEGATE_H_
 #define _CHILLISOURCE_CORE_DELEGATE_MAKEDELEGATE_H_
 
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
+
 #include <functional>
 
 namespace ChilliSource
@@ -67,7 +70,9 @@ namespace ChilliSource
         }
         //------------------------------------------------------------------
         /// Constructs a delegate to a member function with a signature that
-        /// matches the given return and parameter types.
+        /// matches the given return and parameter types. The delegate is
+        /// stored inline so creating it does not allocate; it can also be
+        /// assigned to a std::function.
         ///
         /// @author S Downie
         ///
@@ -77,13 +82,15 @@ namespace ChilliSource
         /// @return Delegate
         //------------------------------------------------------------------
         template <typename TDelegate, typename TSender, typename TReturnType, typename... TArgTypes>
-        std::function<TReturnType(TArgTypes...)> MakeDelegate(TSender* in_sender, TReturnType (TDelegate::*in_func)(TArgTypes...))
+        InlineDelegate<TReturnType(TArgTypes...)> MakeDelegate(TSender* in_sender, TReturnType (TDelegate::*in_func)(TArgTypes...))
         {
             return [=](TArgTypes... in_args) -> TReturnType { return (in_sender->*in_func)(in_args...); };
         }
         //------------------------------------------------------------------
         /// Constructs a delegate to a const member function with a signature
-        /// that matches the given return and parameter types.
+        /// that matches the given return and parameter types. The delegate is
+        /// stored inline so creating it does not allocate; it can also be
+        /// assigned to a std::function.
         ///
         /// @author S Downie
         ///
@@ -93,7 +100,7 @@ namespace ChilliSource
         /// @return Delegate
         //------------------------------------------------------------------
         template <typename TDelegate, typename TSender, typename TReturnType, typename... TArgTypes>
-        std::function<TReturnType(TArgTypes...)> MakeDelegate(TSender* in_sender, TReturnType (TDelegate::*in_func)(TArgTypes...) const)
+        InlineDelegate<TReturnType(TArgTypes...)> MakeDelegate(TSender* in_sender, TReturnType (TDelegate::*in_func)(TArgTypes...) const)
         {
             return [=](TArgTypes... in_args) -> TReturnType { return (in_sender->*in_func)(in_args...); };
         }
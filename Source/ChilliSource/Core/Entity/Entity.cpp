@@ -42,6 +42,8 @@ namespace ChilliSource
             const ComponentSPtr ComponentNullPtr;
         }
         
+        CS_DEFINE_POOLEDTYPE(Entity);
+        
         //------------------------------------------------------------------
 		//------------------------------------------------------------------
 		EntityUPtr Entity::Create()
@@ -205,6 +207,7 @@ namespace ChilliSource
             if(GetScene() != nullptr)
             {
                 in_component->OnAddedToScene();
+                GetScene()->OnComponentAddedToScene(in_component.get());
                 if (m_appActive == true)
                 {
                     in_component->OnResume();
@@ -236,6 +239,7 @@ namespace ChilliSource
                             }
                             in_component->OnSuspend();
                         }
+                        GetScene()->OnComponentRemovedFromScene(in_component);
                         in_component->OnRemovedFromScene();
                     }
                     
@@ -266,6 +270,7 @@ namespace ChilliSource
                         }
                         component->OnSuspend();
                     }
+                    GetScene()->OnComponentRemovedFromScene(component);
                     component->OnRemovedFromScene();
                 }
                 
@@ -377,6 +382,7 @@ namespace ChilliSource
             for (u32 i = 0; i < m_components.size(); ++i)
             {
                 m_components[i]->OnAddedToScene();
+                m_scene->OnComponentAddedToScene(m_components[i].get());
             }
             
             for (u32 i = 0; i < m_children.size(); ++i)
@@ -419,6 +425,7 @@ namespace ChilliSource
             
             for (s32 i = m_components.size() - 1; i >= 0; --i)
             {
+                m_scene->OnComponentRemovedFromScene(m_components[i].get());
                 m_components[i]->OnRemovedFromScene();
             }
 		}
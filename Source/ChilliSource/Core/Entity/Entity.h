@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_CORE_ENTITY_ENTITY_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/ObjectPool.h>
 #include <ChilliSource/Core/Entity/Component.h>
 #include <ChilliSource/Core/Entity/Transform.h>
 
@@ -60,6 +61,7 @@ namespace ChilliSource
 		{	
 		public:
             CS_DECLARE_NOCOPY(Entity);
+            CS_DECLARE_POOLEDTYPE(Entity);
             //------------------------------------------------------------------
             /// Factory method to create an empty entity
             ///
@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_CORE_TRANSFORM_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Vector3.h>
@@ -44,7 +45,7 @@ namespace ChilliSource
         class Transform
         {
         public:
-            typedef std::function<void()> TransformChangedDelegate;
+            typedef InlineDelegate<void()> TransformChangedDelegate;
             
             Transform();
             //----------------------------------------------------------
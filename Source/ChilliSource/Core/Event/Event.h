@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
 #include <ChilliSource/Core/Event/IDisconnectableEvent.h>
 
+#include <algorithm>
 #include <vector>
 
 namespace ChilliSource
@@ -47,6 +48,13 @@ namespace ChilliSource
         /// Objects should though expose the IConnectableEvent interface
         /// to prevent other objects invoking the event.
         ///
+        /// Delegates are stored by value alongside their connection, so
+        /// using an InlineDelegate as the delegate type means that
+        /// connections do not allocate beyond the connection object.
+        /// Connections opened while the event is being notified are held
+        /// separately until notification has finished, so the delegate
+        /// being invoked is never moved.
+        ///
         /// @author S Downie
         //-----------------------------------------------------------------
         template <typename TDelegateType> class Event final : public IConnectableEvent<TDelegateType>, public IDisconnectableEvent
@@ -88,12 +96,11 @@ namespace ChilliSource
 			{
 				CloseAllConnections();
 
-				m_isNotifying = in_moveFrom.m_isNotifying;
+				m_notifyDepth = in_moveFrom.m_notifyDepth;
 				m_connections = std::move(in_moveFrom.m_connections);
-				for (auto& connectionContainer : m_connections)
-				{
-					connectionContainer.m_connection->SetOwningEvent(this);
-				}
+				m_pendingConnections = std::move(in_moveFrom.m_pendingConnections);
+				SetOwningEvent(m_connections, this);
+				SetOwningEvent(m_pendingConnections, this);
 			}
 			//-------------------------------------------------------------
 			/// Although we don't want events to be copyable, we do want
@@ -110,12 +117,11 @@ namespace ChilliSource
 			{
 				CloseAllConnections();
 
-				m_isNotifying = in_moveFrom.m_isNotifying;
+				m_notifyDepth = in_moveFrom.m_notifyDepth;
 				m_connections = std::move(in_moveFrom.m_connections);
-				for (auto& connectionContainer : m_connections)
-				{
-					connectionContainer.m_connection->SetOwningEvent(this);
-				}
+				m_pendingConnections = std::move(in_moveFrom.m_pendingConnections);
+				SetOwningEvent(m_connections, this);
+				SetOwningEvent(m_pendingConnections, this);
 
 				return *this;
 			}
@@ -137,7 +143,15 @@ namespace ChilliSource
                 ConnectionDesc desc;
                 desc.m_delegate = in_delegate;
                 desc.m_connection = connection.get();
-                m_connections.push_back(desc);
+                
+                if (m_notifyDepth == 0)
+                {
+                    m_connections.push_back(std::move(desc));
+                }
+                else
+                {
+                    m_pendingConnections.push_back(std::move(desc));
+                }
             
                 return connection;
             }
@@ -156,7 +170,7 @@ namespace ChilliSource
                     ConnectionDesc& desc = m_connections[i];
                     if(desc.m_connection == in_connection)
                     {
-                        if(m_isNotifying == false)
+                        if(m_notifyDepth == 0)
                         {
                             m_connections.erase(m_connections.begin() + i);
                         }
@@ -168,6 +182,15 @@ namespace ChilliSource
                         return;
                     }
                 }
+                
+                for(u32 i=0; i<m_pendingConnections.size(); ++i)
+                {
+                    if(m_pendingConnections[i].m_connection == in_connection)
+                    {
+                        m_pendingConnections.erase(m_pendingConnections.begin() + i);
+                        return;
+                    }
+                }
             }
             //-------------------------------------------------------------
             /// Notify connections that the event has occurred
@@ -178,12 +201,11 @@ namespace ChilliSource
             //-------------------------------------------------------------
             template <typename... TArgTypes> void NotifyConnections(TArgTypes&&... in_args)
             {
-                m_isNotifying = true;
+                ++m_notifyDepth;
                 
-                //Take a snapshot of the number of delegates so any new ones added
-                //during the notify loop aren't notified themseleves.
-                u32 numConnections = m_connections.size();
-                for(u32 i=0; i<numConnections; ++i)
+                //Connections opened during the notify loop are added to the pending list
+                //so they aren't notified themselves and the list is never resized.
+                for(u32 i=0; i<m_connections.size(); ++i)
                 {
                     if(m_connections[i].m_connection != nullptr)
                     {
@@ -191,9 +213,12 @@ namespace ChilliSource
                     }
                 }
                 
-                m_isNotifying = false;
+                --m_notifyDepth;
                 
-                RemoveClosedConnections();
+                if(m_notifyDepth == 0)
+                {
+                    RemoveClosedConnections();
+                }
             }
             //-------------------------------------------------------------
             /// Closes all the currently open connections
@@ -202,51 +227,76 @@ namespace ChilliSource
             //-------------------------------------------------------------
             void CloseAllConnections()
             {
-                for(u32 i=0; i<m_connections.size(); ++i)
+                SetOwningEvent(m_connections, nullptr);
+                SetOwningEvent(m_pendingConnections, nullptr);
+                
+                m_pendingConnections.clear();
+                
+                if(m_notifyDepth == 0)
                 {
-                    if(m_connections[i].m_connection != nullptr)
+                    m_connections.clear();
+                }
+                else
+                {
+                    for(auto& desc : m_connections)
                     {
-                        m_connections[i].m_connection->SetOwningEvent(nullptr);
+                        desc.m_connection = nullptr;
                     }
                 }
-                
-                m_connections.clear();
             }
     
         private:
     
+            struct ConnectionDesc
+            {
+                TDelegateType m_delegate;
+                EventConnection* m_connection = nullptr;
+            };
+    
+            typedef std::vector<ConnectionDesc> ConnectionList;
+            
             //-------------------------------------------------------------------------
             /// Remove from the list any connections that have been flagged as closed
+            /// and add any connections that were opened during notification.
             ///
             /// @author S Downie
             //-------------------------------------------------------------------------
             void RemoveClosedConnections()
             {
-                for(typename ConnectionList::iterator it = m_connections.begin(); it != m_connections.end(); )
+                m_connections.erase(std::remove_if(m_connections.begin(), m_connections.end(), [](const ConnectionDesc& in_desc)
                 {
-                    if(it->m_connection == nullptr)
-                    {
-                        it = m_connections.erase(it);
-                    }
-                    else
+                    return in_desc.m_connection == nullptr;
+                }), m_connections.end());
+                
+                for(auto& desc : m_pendingConnections)
+                {
+                    m_connections.push_back(std::move(desc));
+                }
+                m_pendingConnections.clear();
+            }
+            //-------------------------------------------------------------------------
+            /// Sets the owning event of all open connections in the given list.
+            ///
+            /// @param The connection list.
+            /// @param The owning event.
+            //-------------------------------------------------------------------------
+            void SetOwningEvent(const ConnectionList& in_connections, IDisconnectableEvent* in_owningEvent)
+            {
+                for(const auto& desc : in_connections)
+                {
+                    if(desc.m_connection != nullptr)
                     {
-                        ++it;
+                        desc.m_connection->SetOwningEvent(in_owningEvent);
                     }
                 }
             }
     
         private:
-                                    
-            struct ConnectionDesc
-            {
-                TDelegateType m_delegate;
-                EventConnection* m_connection = nullptr;
-            };
-    
-            typedef std::vector<ConnectionDesc> ConnectionList;
+            
             ConnectionList m_connections;
+            ConnectionList m_pendingConnections;
         
-            bool m_isNotifying = false;
+            u32 m_notifyDepth = 0;
         };
     }
 }
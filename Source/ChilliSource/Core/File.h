@@ -31,8 +31,11 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/File/AppDataStore.h>
+#include <ChilliSource/Core/File/BinaryReader.h>
+#include <ChilliSource/Core/File/BinaryWriter.h>
 #include <ChilliSource/Core/File/FileStream.h>
 #include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/MemoryMappedFileStream.h>
 #include <ChilliSource/Core/File/StorageLocation.h>
 #include <ChilliSource/Core/File/TaggedFilePathResolver.h>
 
@@ -0,0 +1,150 @@
+//
+//  BinaryReader.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/File/BinaryReader.h>
+
+#include <ChilliSource/Core/File/FileStream.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        BinaryReader::BinaryReader(const FileStreamSPtr& in_stream)
+            : m_stream(in_stream)
+        {
+            if (m_stream == nullptr || m_stream->IsOpen() == false || m_stream->IsBad() == true)
+            {
+                m_isBad = true;
+                return;
+            }
+
+            s32 start = m_stream->TellG();
+            if (start < 0)
+            {
+                m_isBad = true;
+                return;
+            }
+
+            const s8* view = nullptr;
+            u32 viewSize = 0;
+            if (m_stream->TryGetView(view, viewSize) == true && u32(start) <= viewSize)
+            {
+                m_data = view + start;
+                m_size = viewSize - u32(start);
+                return;
+            }
+
+            m_stream->SeekG(0, SeekDir::k_end);
+            s32 end = m_stream->TellG();
+            m_stream->SeekG(start, SeekDir::k_beginning);
+
+            if (end < start)
+            {
+                m_isBad = true;
+                return;
+            }
+
+            m_size = u32(end - start);
+            if (m_size > 0)
+            {
+                m_ownedData.reset(new s8[m_size]);
+                m_stream->Read(m_ownedData.get(), m_size);
+                m_data = m_ownedData.get();
+                m_isBad = m_stream->IsBad();
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        BinaryReader::BinaryReader(const s8* in_data, u32 in_size)
+            : m_data(in_data), m_size(in_size)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::string BinaryReader::ReadString()
+        {
+            if (m_isBad == true || m_position >= m_size)
+            {
+                m_isBad = true;
+                return "";
+            }
+
+            const s8* start = m_data + m_position;
+            const void* terminator = memchr(start, 0, m_size - m_position);
+            if (terminator == nullptr)
+            {
+                m_position = m_size;
+                m_isBad = true;
+                return "";
+            }
+
+            u32 length = u32(reinterpret_cast<const s8*>(terminator) - start);
+            m_position += length + 1;
+            return std::string(start, length);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        const s8* BinaryReader::ReadView(u32 in_size)
+        {
+            if (m_isBad == true || in_size > m_size - m_position)
+            {
+                m_isBad = true;
+                return nullptr;
+            }
+
+            const s8* data = m_data + m_position;
+            m_position += in_size;
+            return data;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BinaryReader::Skip(u32 in_size)
+        {
+            ReadView(in_size);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 BinaryReader::GetPosition() const
+        {
+            return m_position;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 BinaryReader::GetRemaining() const
+        {
+            return m_size - m_position;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool BinaryReader::IsBad() const
+        {
+            return m_isBad;
+        }
+    }
+}
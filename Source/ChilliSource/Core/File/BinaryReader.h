@@ -0,0 +1,158 @@
+//
+//  BinaryReader.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_FILE_BINARYREADER_H_
+#define _CHILLISOURCE_CORE_FILE_BINARYREADER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <cstring>
+#include <memory>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //--------------------------------------------------------------
+        /// Reads values from a contiguous block of binary data. This
+        /// is intended for parsing binary resource files: rather than
+        /// making a stream call for every field, the file contents are
+        /// acquired once, either as a zero copy view from the stream or
+        /// with a single bulk read, and then parsed from memory.
+        ///
+        /// Reading past the end of the data does not read out of bounds;
+        /// instead zero is returned and the reader is flagged as bad.
+        /// Parsers should check IsBad() once they have finished.
+        //--------------------------------------------------------------
+        class BinaryReader final
+        {
+        public:
+            CS_DECLARE_NOCOPY(BinaryReader);
+            //--------------------------------------------------------------
+            /// Creates a reader over the remainder of the given stream,
+            /// starting at its current get position. If the stream can
+            /// provide a view of its contents no data is copied, otherwise
+            /// the remainder of the file is read in a single call.
+            ///
+            /// @param The open file stream. This is kept alive for the
+            /// lifetime of the reader.
+            //--------------------------------------------------------------
+            BinaryReader(const FileStreamSPtr& in_stream);
+            //--------------------------------------------------------------
+            /// Creates a reader over the given data. The data is not
+            /// copied so must outlive the reader.
+            ///
+            /// @param The data.
+            /// @param The size of the data in bytes.
+            //--------------------------------------------------------------
+            BinaryReader(const s8* in_data, u32 in_size);
+            //--------------------------------------------------------------
+            /// Reads a single value of the given trivially copyable type.
+            ///
+            /// @return The value, or zero if there is not enough data left.
+            //--------------------------------------------------------------
+            template <typename TType> TType Read();
+            //--------------------------------------------------------------
+            /// Reads an array of values of the given trivially copyable
+            /// type in a single copy.
+            ///
+            /// @param The number of values to read.
+            /// @param [Out] The output buffer. This is left untouched if
+            /// there is not enough data left.
+            //--------------------------------------------------------------
+            template <typename TType> void Read(u32 in_count, TType* out_values);
+            //--------------------------------------------------------------
+            /// Reads a null terminated string.
+            ///
+            /// @return The string, excluding the null terminator.
+            //--------------------------------------------------------------
+            std::string ReadString();
+            //--------------------------------------------------------------
+            /// Provides direct access to the next block of data and moves
+            /// past it. The returned pointer has no alignment guarantees,
+            /// so multi-byte values should be copied out with memcpy.
+            ///
+            /// @param The size of the block in bytes.
+            ///
+            /// @return Pointer to the block, or null if there is not
+            /// enough data left.
+            //--------------------------------------------------------------
+            const s8* ReadView(u32 in_size);
+            //--------------------------------------------------------------
+            /// Moves the read position forward.
+            ///
+            /// @param The number of bytes to skip.
+            //--------------------------------------------------------------
+            void Skip(u32 in_size);
+            //--------------------------------------------------------------
+            /// @return The current read position in bytes.
+            //--------------------------------------------------------------
+            u32 GetPosition() const;
+            //--------------------------------------------------------------
+            /// @return The number of bytes left to read.
+            //--------------------------------------------------------------
+            u32 GetRemaining() const;
+            //--------------------------------------------------------------
+            /// @return Whether the data could not be acquired or a read has
+            /// run past the end of the data.
+            //--------------------------------------------------------------
+            bool IsBad() const;
+
+        private:
+            FileStreamSPtr m_stream;
+            std::unique_ptr<s8[]> m_ownedData;
+            const s8* m_data = nullptr;
+            u32 m_size = 0;
+            u32 m_position = 0;
+            bool m_isBad = false;
+        };
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        template <typename TType> TType BinaryReader::Read()
+        {
+            TType value = TType();
+            const s8* data = ReadView(sizeof(TType));
+            if (data != nullptr)
+            {
+                memcpy(&value, data, sizeof(TType));
+            }
+            return value;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        template <typename TType> void BinaryReader::Read(u32 in_count, TType* out_values)
+        {
+            const s8* data = ReadView(sizeof(TType) * in_count);
+            if (data != nullptr)
+            {
+                memcpy(out_values, data, sizeof(TType) * in_count);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,64 @@
+//
+//  BinaryWriter.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/File/BinaryWriter.h>
+
+#include <ChilliSource/Core/File/FileStream.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        BinaryWriter::BinaryWriter(const FileStreamSPtr& in_stream)
+            : m_stream(in_stream)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BinaryWriter::WriteString(const std::string& in_string)
+        {
+            WriteData(in_string.c_str(), u32(in_string.size() + 1));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool BinaryWriter::IsBad() const
+        {
+            return (m_stream == nullptr || m_stream->IsOpen() == false || m_stream->IsBad() == true);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BinaryWriter::WriteData(const s8* in_data, u32 in_size)
+        {
+            if (IsBad() == false && in_size > 0)
+            {
+                m_stream->Write(in_data, s32(in_size));
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  BinaryWriter.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_FILE_BINARYWRITER_H_
+#define _CHILLISOURCE_CORE_FILE_BINARYWRITER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //--------------------------------------------------------------
+        /// Writes values to a binary file stream. This is the
+        /// counterpart to BinaryReader and is used when converting
+        /// resources to their cooked binary formats. Values are written
+        /// in native byte order with no padding; strings are null
+        /// terminated.
+        //--------------------------------------------------------------
+        class BinaryWriter final
+        {
+        public:
+            CS_DECLARE_NOCOPY(BinaryWriter);
+            //--------------------------------------------------------------
+            /// Creates a writer which writes from the current put position
+            /// of the given stream.
+            ///
+            /// @param The open file stream. This is kept alive for the
+            /// lifetime of the writer.
+            //--------------------------------------------------------------
+            BinaryWriter(const FileStreamSPtr& in_stream);
+            //--------------------------------------------------------------
+            /// Writes a single value of the given trivially copyable type.
+            ///
+            /// @param The value.
+            //--------------------------------------------------------------
+            template <typename TType> void Write(TType in_value);
+            //--------------------------------------------------------------
+            /// Writes an array of values of the given trivially copyable
+            /// type in a single call.
+            ///
+            /// @param The number of values to write.
+            /// @param The values.
+            //--------------------------------------------------------------
+            template <typename TType> void Write(u32 in_count, const TType* in_values);
+            //--------------------------------------------------------------
+            /// Writes a string followed by a null terminator.
+            ///
+            /// @param The string.
+            //--------------------------------------------------------------
+            void WriteString(const std::string& in_string);
+            //--------------------------------------------------------------
+            /// @return Whether the stream could not be opened or a write
+            /// has failed.
+            //--------------------------------------------------------------
+            bool IsBad() const;
+
+        private:
+            //--------------------------------------------------------------
+            /// Writes a block of raw data to the stream.
+            ///
+            /// @param The data.
+            /// @param The size of the data in bytes.
+            //--------------------------------------------------------------
+            void WriteData(const s8* in_data, u32 in_size);
+
+            FileStreamSPtr m_stream;
+        };
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        template <typename TType> void BinaryWriter::Write(TType in_value)
+        {
+            WriteData(reinterpret_cast<const s8*>(&in_value), sizeof(TType));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        template <typename TType> void BinaryWriter::Write(u32 in_count, const TType* in_values)
+        {
+            WriteData(reinterpret_cast<const s8*>(in_values), sizeof(TType) * in_count);
+        }
+    }
+}
+
+#endif
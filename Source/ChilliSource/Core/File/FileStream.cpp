@@ -31,6 +31,7 @@
 #include <md5/md5.h>
 #include <SHA1/SHA1.h>
 
+#include <memory>
 #include <sstream>
 
 #ifdef CS_TARGETPLATFORM_WINDOWS
@@ -50,19 +51,29 @@ namespace ChilliSource
         //--------------------------------------------------------------
         std::string FileStream::GetMD5Checksum()
         {
+            const s8* pbyView = nullptr;
+            u32 udwViewSize = 0;
+            if(TryGetView(pbyView, udwViewSize) == true)
+            {
+                MD5 Hash;
+                Hash.update(pbyView, udwViewSize);
+                Hash.finalize();
+                return Hash.binarydigest();
+            }
+            
             s32 dwCurrentPos = TellG();
             SeekG(0);
             
-            const u32 kudwChunkSize = 256;
-            s8 byData[kudwChunkSize];
+            const u32 kudwChunkSize = 64 * 1024;
+            std::unique_ptr<s8[]> byData(new s8[kudwChunkSize]);
             
             MD5 Hash;
             s32 dwSize = kudwChunkSize;
             
             while(dwSize != 0)
             {
-                dwSize = ReadSome(byData, kudwChunkSize);
-                Hash.update(byData, dwSize);
+                dwSize = ReadSome(byData.get(), kudwChunkSize);
+                Hash.update(byData.get(), dwSize);
             }
             
             SeekG(dwCurrentPos);
@@ -75,23 +86,32 @@ namespace ChilliSource
         //--------------------------------------------------------------
         std::string FileStream::GetSHA1Checksum(CSHA1::REPORT_TYPE ineReportType)
         {
-            s32 dwCurrentPos = TellG();
-            SeekG(0);
-            
-            const u32 kudwChunkSize = 256;
-            s8 byData[kudwChunkSize];
-            
             CSHA1 Hash;
             Hash.Reset();
-            s32 dwSize = kudwChunkSize;
             
-            while(dwSize != 0)
+            const s8* pbyView = nullptr;
+            u32 udwViewSize = 0;
+            if(TryGetView(pbyView, udwViewSize) == true)
             {
-                dwSize = ReadSome(byData, kudwChunkSize);
-                Hash.Update(reinterpret_cast<u8*>(byData), dwSize);
+                Hash.Update(reinterpret_cast<const u8*>(pbyView), udwViewSize);
+            }
+            else
+            {
+                s32 dwCurrentPos = TellG();
+                SeekG(0);
+                
+                const u32 kudwChunkSize = 64 * 1024;
+                std::unique_ptr<s8[]> byData(new s8[kudwChunkSize]);
+                
+                s32 dwSize = kudwChunkSize;
+                while(dwSize != 0)
+                {
+                    dwSize = ReadSome(byData.get(), kudwChunkSize);
+                    Hash.Update(reinterpret_cast<u8*>(byData.get()), dwSize);
+                }
+                
+                SeekG(dwCurrentPos);
             }
-            
-            SeekG(dwCurrentPos);
             
             Hash.Final();
             
@@ -362,6 +382,12 @@ namespace ChilliSource
 		{
 			mFileStream.flush();
 		}
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        bool FileStream::TryGetView(const s8*& out_data, u32& out_size) const
+        {
+            return false;
+        }
         //--------------------------------------------------------------------------------------------------
 		/// Get File Mode
 		//--------------------------------------------------------------------------------------------------
@@ -341,6 +341,20 @@ namespace ChilliSource
 			/// Synchronises the associated buffer with the stream.
 			//--------------------------------------------------------------------------------------------------
 			virtual void Flush();
+            //--------------------------------------------------------------------------------------------------
+            /// Try Get View
+            ///
+            /// Provides read only access to the entire contents of the file without copying it, if the
+            /// stream holds the file in memory. The view is independent of the get pointer and remains
+            /// valid until the stream is closed or destroyed. Streams that read from disk on demand do not
+            /// provide a view, in which case the file must be read through the stream instead.
+            ///
+            /// @param [Out] Pointer to the start of the file data.
+            /// @param [Out] The size of the file data in bytes.
+            ///
+            /// @return Whether or not a view could be provided.
+            //--------------------------------------------------------------------------------------------------
+            virtual bool TryGetView(const s8*& out_data, u32& out_size) const;
             //--------------------------------------------------------------
             /// Get MD5 Checksum 
             ///
@@ -47,6 +47,7 @@
 #include <md5/md5.h>
 
 #include <algorithm>
+#include <memory>
 
 namespace ChilliSource
 {
@@ -174,8 +175,8 @@ namespace ChilliSource
         //--------------------------------------------------------------
         std::string FileSystem::GetFileChecksumMD5(StorageLocation in_storageLocation, const std::string& in_filePath) const
         {
-            const u32 k_chunkSize = 256;
-            s8 data[k_chunkSize];
+            const u32 k_chunkSize = 64 * 1024;
+            std::unique_ptr<s8[]> data(new s8[k_chunkSize]);
             
             MD5 hash;
             s32 size = k_chunkSize;
@@ -189,8 +190,8 @@ namespace ChilliSource
             
             while(size != 0)
             {
-                size = file->ReadSome(data, k_chunkSize);
-                hash.update(data, size);
+                size = file->ReadSome(data.get(), k_chunkSize);
+                hash.update(data.get(), size);
             }
             
             hash.finalize();
@@ -241,18 +242,15 @@ namespace ChilliSource
 			FileStreamUPtr file = CreateFileStream(in_storageLocation, in_filePath, FileMode::k_readBinary);
 			if (file != nullptr && file->IsOpen() == true && file->IsBad() == false)
 			{
-				//get the length of the file
-				file->SeekG(0, SeekDir::k_end);
-				s32 length = file->TellG();
-				file->SeekG(0, SeekDir::k_beginning);
-
-				//read contents of file
-				s8* contents = new s8[length];
-				file->Read(contents, length);
+				//hash the file in blocks rather than reading it all into memory
+				const u32 k_chunkSize = 64 * 1024;
+				std::unique_ptr<s8[]> data(new s8[k_chunkSize]);
 
-				//get the hash
-				output = HashCRC32::GenerateHashCode(contents, length);
-				CS_SAFEDELETE_ARRAY(contents);
+				s32 size = 0;
+				while ((size = file->ReadSome(data.get(), k_chunkSize)) > 0)
+				{
+					output = HashCRC32::UpdateHashCode(output, data.get(), size);
+				}
 			}
 			return output;
 		}
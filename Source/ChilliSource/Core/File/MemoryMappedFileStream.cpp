@@ -0,0 +1,403 @@
+//
+//  MemoryMappedFileStream.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID
+
+#include <ChilliSource/Core/File/MemoryMappedFileStream.h>
+
+#include <fcntl.h>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            //--------------------------------------------------------------
+            /// A read only stream buffer over a fixed block of memory. The
+            /// get area is the whole block so the istream reads directly
+            /// from it without any intermediate copies.
+            //--------------------------------------------------------------
+            class MemoryStreamBuffer final : public std::streambuf
+            {
+            public:
+                //--------------------------------------------------------------
+                /// Constructor
+                ///
+                /// @param The start of the memory block.
+                /// @param The size of the memory block.
+                //--------------------------------------------------------------
+                MemoryStreamBuffer(const s8* in_data, u32 in_size)
+                {
+                    s8* data = const_cast<s8*>(in_data);
+                    setg(data, data, data + in_size);
+                }
+
+            protected:
+                //--------------------------------------------------------------
+                /// Moves the get pointer relative to the given position.
+                //--------------------------------------------------------------
+                pos_type seekoff(off_type in_offset, std::ios_base::seekdir in_dir, std::ios_base::openmode in_which) override
+                {
+                    if ((in_which & std::ios_base::in) == 0)
+                    {
+                        return pos_type(off_type(-1));
+                    }
+
+                    off_type base = 0;
+                    switch (in_dir)
+                    {
+                        case std::ios_base::cur:
+                            base = gptr() - eback();
+                            break;
+                        case std::ios_base::end:
+                            base = egptr() - eback();
+                            break;
+                        default:
+                            break;
+                    }
+
+                    off_type position = base + in_offset;
+                    if (position < 0 || position > egptr() - eback())
+                    {
+                        return pos_type(off_type(-1));
+                    }
+
+                    setg(eback(), eback() + position, egptr());
+                    return pos_type(position);
+                }
+                //--------------------------------------------------------------
+                /// Moves the get pointer to the given absolute position.
+                //--------------------------------------------------------------
+                pos_type seekpos(pos_type in_position, std::ios_base::openmode in_which) override
+                {
+                    return seekoff(off_type(in_position), std::ios_base::beg, in_which);
+                }
+            };
+            //--------------------------------------------------------------
+            /// @param The seek direction.
+            ///
+            /// @return The equivalent std seek direction.
+            //--------------------------------------------------------------
+            std::ios_base::seekdir ToStdSeekDir(SeekDir in_dir)
+            {
+                switch (in_dir)
+                {
+                    case SeekDir::k_current:
+                        return std::ios_base::cur;
+                    case SeekDir::k_end:
+                        return std::ios_base::end;
+                    case SeekDir::k_beginning:
+                    default:
+                        return std::ios_base::beg;
+                }
+            }
+        }
+
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        MemoryMappedFileStream::MemoryMappedFileStream()
+            : m_stream(nullptr)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Open(const std::string& in_filePath, FileMode in_fileMode)
+        {
+            CS_ASSERT(m_isOpen == false, "Memory mapped file stream is already open.");
+            CS_ASSERT(in_fileMode == FileMode::k_readBinary, "Memory mapped file streams only support binary read mode.");
+
+            mstrFilename = in_filePath;
+            meFileMode = in_fileMode;
+            m_isBad = true;
+
+            s32 fileDescriptor = open(in_filePath.c_str(), O_RDONLY);
+            if (fileDescriptor < 0)
+            {
+                return;
+            }
+
+            struct stat fileStats;
+            if (fstat(fileDescriptor, &fileStats) != 0 || S_ISREG(fileStats.st_mode) == false)
+            {
+                close(fileDescriptor);
+                return;
+            }
+
+            m_mappedSize = u32(fileStats.st_size);
+
+            //mmap() does not accept a zero length so empty files are simply left unmapped.
+            if (m_mappedSize > 0)
+            {
+                void* mappedData = mmap(nullptr, m_mappedSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                if (mappedData == MAP_FAILED)
+                {
+                    close(fileDescriptor);
+                    m_mappedSize = 0;
+                    return;
+                }
+
+                //Most resources are parsed front to back, so ask for aggressive read ahead.
+                madvise(mappedData, m_mappedSize, MADV_SEQUENTIAL);
+                m_mappedData = mappedData;
+            }
+
+            //the mapping holds its own reference to the file so the descriptor is no longer needed.
+            close(fileDescriptor);
+
+            m_buffer.reset(new MemoryStreamBuffer(reinterpret_cast<const s8*>(m_mappedData), m_mappedSize));
+            m_stream.rdbuf(m_buffer.get());
+            m_stream.clear();
+
+            m_isOpen = true;
+            m_isBad = false;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool MemoryMappedFileStream::IsOpen()
+        {
+            return m_isOpen;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool MemoryMappedFileStream::IsBad()
+        {
+            return m_isBad == true || m_stream.fail() == true || m_stream.bad() == true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool MemoryMappedFileStream::EndOfFile()
+        {
+            return m_stream.eof();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Close()
+        {
+            m_stream.rdbuf(nullptr);
+            m_buffer.reset();
+
+            if (m_mappedData != nullptr)
+            {
+                munmap(m_mappedData, m_mappedSize);
+                m_mappedData = nullptr;
+            }
+
+            m_mappedSize = 0;
+            m_isOpen = false;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 MemoryMappedFileStream::Get()
+        {
+            return m_stream.get();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Get(s8& out_char)
+        {
+            m_stream.get(out_char);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Get(s8* out_string, s32 in_size)
+        {
+            m_stream.get(out_string, in_size);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Get(s8* out_string, s32 in_size, s8 in_delim)
+        {
+            m_stream.get(out_string, in_size, in_delim);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::GetLine(std::string& out_string)
+        {
+            m_stream >> out_string;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::GetAll(std::string& out_string)
+        {
+            s32 position = TellG();
+            if (position < 0 || u32(position) >= m_mappedSize)
+            {
+                out_string.clear();
+                return;
+            }
+
+            out_string.assign(reinterpret_cast<const s8*>(m_mappedData) + position, m_mappedSize - u32(position));
+            SeekG(0, SeekDir::k_end);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Get(std::stringstream& out_stringStream)
+        {
+            out_stringStream << m_stream.rdbuf();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::GetLine(s8* out_string, s32 in_size)
+        {
+            m_stream.getline(out_string, in_size);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::GetLine(s8* out_string, s32 in_size, s8 in_delim)
+        {
+            m_stream.getline(out_string, in_size, in_delim);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Ignore(s32 in_size, s8 in_delim)
+        {
+            m_stream.ignore(in_size, in_delim);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 MemoryMappedFileStream::Peek()
+        {
+            return m_stream.peek();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Read(s8* out_buffer, s32 in_size)
+        {
+            m_stream.read(out_buffer, in_size);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 MemoryMappedFileStream::ReadSome(s8* out_buffer, s32 in_size)
+        {
+            return s32(m_stream.readsome(out_buffer, in_size));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::PutBack(s8 in_char)
+        {
+            m_stream.putback(in_char);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Unget()
+        {
+            m_stream.unget();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 MemoryMappedFileStream::TellG()
+        {
+            return s32(m_stream.tellg());
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::SeekG(s32 in_position)
+        {
+            m_stream.seekg(in_position, std::ios_base::beg);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::SeekG(s32 in_position, SeekDir in_dir)
+        {
+            m_stream.seekg(in_position, ToStdSeekDir(in_dir));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 MemoryMappedFileStream::Sync()
+        {
+            return m_stream.sync();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Put(s8 in_char)
+        {
+            CS_LOG_ERROR("Cannot write to a memory mapped file stream.");
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Write(const s8* in_data, s32 in_size)
+        {
+            CS_LOG_ERROR("Cannot write to a memory mapped file stream.");
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Write(const std::string& in_string)
+        {
+            CS_LOG_ERROR("Cannot write to a memory mapped file stream.");
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 MemoryMappedFileStream::TellP()
+        {
+            CS_LOG_ERROR("Cannot write to a memory mapped file stream.");
+            return -1;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::SeekP(s32 in_position)
+        {
+            CS_LOG_ERROR("Cannot write to a memory mapped file stream.");
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::SeekP(s32 in_position, SeekDir in_dir)
+        {
+            CS_LOG_ERROR("Cannot write to a memory mapped file stream.");
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void MemoryMappedFileStream::Flush()
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool MemoryMappedFileStream::TryGetView(const s8*& out_data, u32& out_size) const
+        {
+            if (m_isOpen == false)
+            {
+                return false;
+            }
+
+            out_data = reinterpret_cast<const s8*>(m_mappedData);
+            out_size = m_mappedSize;
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        MemoryMappedFileStream::~MemoryMappedFileStream()
+        {
+            Close();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,149 @@
+//
+//  MemoryMappedFileStream.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID
+
+#ifndef _CHILLISOURCE_CORE_FILE_MEMORYMAPPEDFILESTREAM_H_
+#define _CHILLISOURCE_CORE_FILE_MEMORYMAPPEDFILESTREAM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/FileStream.h>
+
+#include <istream>
+#include <memory>
+#include <streambuf>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //--------------------------------------------------------------
+        /// A read only file stream which maps the file into memory
+        /// rather than reading it through a buffered fstream. Reads
+        /// are served directly from the mapped pages and the full
+        /// contents of the file can be accessed without copying
+        /// through TryGetView(). Only binary read mode is supported.
+        ///
+        /// This is only available on platforms that support POSIX
+        /// mmap. It is created by the file system when opening a file
+        /// for binary reading; if the file cannot be mapped the file
+        /// system falls back to a standard FileStream.
+        //--------------------------------------------------------------
+        class MemoryMappedFileStream final : public FileStream
+        {
+        public:
+            CS_DECLARE_NOCOPY(MemoryMappedFileStream);
+            //--------------------------------------------------------------
+            /// Constructor
+            //--------------------------------------------------------------
+            MemoryMappedFileStream();
+            //--------------------------------------------------------------
+            /// Opens the given file and maps it into memory. The file mode
+            /// must be k_readBinary.
+            ///
+            /// @param The absolute path to the file.
+            /// @param The file mode.
+            //--------------------------------------------------------------
+            void Open(const std::string& in_filePath, FileMode in_fileMode) override;
+            //--------------------------------------------------------------
+            /// @return Whether or not the file is open and mapped.
+            //--------------------------------------------------------------
+            bool IsOpen() override;
+            //--------------------------------------------------------------
+            /// @return Whether the file could not be mapped or a previous
+            /// read failed.
+            //--------------------------------------------------------------
+            bool IsBad() override;
+            //--------------------------------------------------------------
+            /// @return Whether the end of the file has been reached.
+            //--------------------------------------------------------------
+            bool EndOfFile() override;
+            //--------------------------------------------------------------
+            /// Unmaps the file.
+            //--------------------------------------------------------------
+            void Close() override;
+            //--------------------------------------------------------------
+            /// The following mirror the equivalent FileStream methods, but
+            /// read from the mapped memory.
+            //--------------------------------------------------------------
+            s32 Get() override;
+            void Get(s8& out_char) override;
+            void Get(s8* out_string, s32 in_size) override;
+            void Get(s8* out_string, s32 in_size, s8 in_delim) override;
+            void GetLine(std::string& out_string) override;
+            void GetAll(std::string& out_string) override;
+            void Get(std::stringstream& out_stringStream) override;
+            void GetLine(s8* out_string, s32 in_size) override;
+            void GetLine(s8* out_string, s32 in_size, s8 in_delim) override;
+            void Ignore(s32 in_size = 1, s8 in_delim = EOF) override;
+            s32 Peek() override;
+            void Read(s8* out_buffer, s32 in_size) override;
+            s32 ReadSome(s8* out_buffer, s32 in_size) override;
+            void PutBack(s8 in_char) override;
+            void Unget() override;
+            s32 TellG() override;
+            void SeekG(s32 in_position) override;
+            void SeekG(s32 in_position, SeekDir in_dir) override;
+            s32 Sync() override;
+            //--------------------------------------------------------------
+            /// The stream is read only so all of the following will log
+            /// an error.
+            //--------------------------------------------------------------
+            void Put(s8 in_char) override;
+            void Write(const s8* in_data, s32 in_size) override;
+            void Write(const std::string& in_string) override;
+            s32 TellP() override;
+            void SeekP(s32 in_position) override;
+            void SeekP(s32 in_position, SeekDir in_dir) override;
+            void Flush() override;
+            //--------------------------------------------------------------
+            /// @param [Out] Pointer to the start of the mapped file.
+            /// @param [Out] The size of the file in bytes.
+            ///
+            /// @return Whether or not the file is mapped.
+            //--------------------------------------------------------------
+            bool TryGetView(const s8*& out_data, u32& out_size) const override;
+            //--------------------------------------------------------------
+            /// Destructor. Unmaps the file if it is still open.
+            //--------------------------------------------------------------
+            ~MemoryMappedFileStream();
+
+        private:
+            void* m_mappedData = nullptr;
+            u32 m_mappedSize = 0;
+            bool m_isOpen = false;
+            bool m_isBad = false;
+
+            std::unique_ptr<std::streambuf> m_buffer;
+            std::istream m_stream;
+        };
+    }
+}
+
+#endif
+
+#endif
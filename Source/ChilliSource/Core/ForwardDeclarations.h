@@ -43,6 +43,8 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(Application);
         CS_FORWARDDECLARE_CLASS(Colour);
         CS_FORWARDDECLARE_CLASS(Device);
+        CS_FORWARDDECLARE_CLASS(FrameAllocator);
+        template <typename TType> class FrameAllocatorAdapter;
         CS_FORWARDDECLARE_CLASS(IInformationProvider);
         CS_FORWARDDECLARE_CLASS(Logging);
         CS_FORWARDDECLARE_CLASS(PlatformSystem);
@@ -57,6 +59,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(ParamDictionary);
         template <typename T> class WorkerQueue;
         template <typename TType> class concurrent_vector;
+        template <typename TType> class rcu_vector;
         //---------------------------------------------------------
         /// Delegate
         //---------------------------------------------------------
@@ -82,8 +85,11 @@ namespace ChilliSource
         //---------------------------------------------------------
         /// File
         //---------------------------------------------------------
+        CS_FORWARDDECLARE_CLASS(BinaryReader);
+        CS_FORWARDDECLARE_CLASS(BinaryWriter);
         CS_FORWARDDECLARE_CLASS(FileStream);
         CS_FORWARDDECLARE_CLASS(FileSystem);
+        CS_FORWARDDECLARE_CLASS(MemoryMappedFileStream);
         CS_FORWARDDECLARE_CLASS(AppDataStore);
         CS_FORWARDDECLARE_CLASS(TaggedFilePathResolver);
         enum class StorageLocation;
@@ -199,6 +205,7 @@ namespace ChilliSource
         //---------------------------------------------------------
         /// Volume
         //---------------------------------------------------------
+        CS_FORWARDDECLARE_CLASS(BoundingVolumeHierarchy);
         CS_FORWARDDECLARE_CLASS(VolumeComponent);
         //---------------------------------------------------------
         /// XML
@@ -37,6 +37,8 @@
 
 #include <minizip/unzip.h>
 
+#include <memory>
+
 namespace ChilliSource
 {
     namespace Core
@@ -148,10 +150,24 @@ namespace ChilliSource
                 u8* pubyBitmapData = nullptr;
                 if(sHeader.m_compression != 0)
                 {
-                    // Allocated memory needed for the compressed image data
-                    u8* pubyCompressedData = (u8*)malloc(sHeader.m_compressedDataSize);
-                    in_stream->Read((s8*)pubyCompressedData, sHeader.m_compressedDataSize);
-                    in_stream->Close();
+                    // Inflate straight from the file data if the stream holds it in memory, otherwise read
+                    // the compressed data into a temporary buffer.
+                    const u8* pubyCompressedData = nullptr;
+                    std::unique_ptr<u8[]> pubyCompressedDataCopy;
+                    
+                    const s8* pbyView = nullptr;
+                    u32 udwViewSize = 0;
+                    s32 dwDataOffset = in_stream->TellG();
+                    if(in_stream->TryGetView(pbyView, udwViewSize) == true && dwDataOffset >= 0 && u32(dwDataOffset) + sHeader.m_compressedDataSize <= udwViewSize)
+                    {
+                        pubyCompressedData = (const u8*)(pbyView + dwDataOffset);
+                    }
+                    else
+                    {
+                        pubyCompressedDataCopy.reset(new u8[sHeader.m_compressedDataSize]);
+                        in_stream->Read((s8*)pubyCompressedDataCopy.get(), sHeader.m_compressedDataSize);
+                        pubyCompressedData = pubyCompressedDataCopy.get();
+                    }
                     
                     // Allocated memory need for for the bitmap context
                     pubyBitmapData = new u8[sHeader.m_originalDataSize];
@@ -169,6 +185,7 @@ namespace ChilliSource
                     inflateInit(&infstream);
                     inflate(&infstream, Z_FINISH);
                     inflateEnd(&infstream);
+                    in_stream->Close();
                     
                     // Checksum test
                     u32 udwInflatedChecksum = HashCRC32::GenerateHashCode((const s8*)pubyBitmapData, sHeader.m_originalDataSize);
@@ -176,8 +193,7 @@ namespace ChilliSource
                     {
                         CS_LOG_ERROR("CSImage checksum of "+ToString(udwInflatedChecksum)+" does not match expected checksum "+ToString(sHeader.m_checksum));
                     }
-                    
-                    free(pubyCompressedData);
+
                 }
                 else
                 {
@@ -202,10 +202,18 @@ namespace ChilliSource
                     return;
                 }
                 
+                //parse directly from the file data if the stream holds it in memory, otherwise read it all first.
+                const s8* pbyData = nullptr;
+                u32 udwDataSize = 0;
                 std::string abyData;
-                pImageFile->GetAll(abyData);
+                if(pImageFile->TryGetView(pbyData, udwDataSize) == false)
+                {
+                    pImageFile->GetAll(abyData);
+                    pbyData = abyData.data();
+                    udwDataSize = abyData.size();
+                }
                 
-                CreatePVRImageFromFile(abyData.data(), abyData.size(), (Core::Image*)out_resource.get());
+                CreatePVRImageFromFile(pbyData, udwDataSize, (Core::Image*)out_resource.get());
                 
                 out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
                 if(in_delegate != nullptr)
@@ -30,6 +30,7 @@
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
 
+#include <cmath>
 #include <limits>
 #include <algorithm>
 
@@ -752,6 +753,33 @@ namespace ChilliSource
 			if(ShapeIntersection::Intersects(inBoundingSphere, mFarClipPlane) == ShapeIntersection::Result::k_outside)
                 return false;
 
+			return true;
+		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool Frustum::OOBBCullTest(const OOBB& in_boundingBox) const
+		{
+			const Plane* planes[6] = { &mLeftClipPlane, &mRightClipPlane, &mTopClipPlane, &mBottomClipPlane, &mNearClipPlane, &mFarClipPlane };
+
+			//the box axes in world space are the rows of its transform, scaled by the half size.
+			const Matrix4& transform = in_boundingBox.GetTransform();
+			Vector3 halfSize = in_boundingBox.GetSize() * 0.5f;
+			Vector3 axisX(transform.m[0] * halfSize.x, transform.m[1] * halfSize.x, transform.m[2] * halfSize.x);
+			Vector3 axisY(transform.m[4] * halfSize.y, transform.m[5] * halfSize.y, transform.m[6] * halfSize.y);
+			Vector3 axisZ(transform.m[8] * halfSize.z, transform.m[9] * halfSize.z, transform.m[10] * halfSize.z);
+			Vector3 centre = in_boundingBox.GetOrigin() * transform;
+
+			for (const Plane* plane : planes)
+			{
+				//the box is outside if even its furthest extent along the plane normal is behind the plane.
+				const Vector3& normal = plane->mvNormal;
+				f32 extent = std::abs(Vector3::DotProduct(normal, axisX)) + std::abs(Vector3::DotProduct(normal, axisY)) + std::abs(Vector3::DotProduct(normal, axisZ));
+				if (Vector3::DotProduct(centre, normal) + plane->mfD < -extent)
+				{
+					return false;
+				}
+			}
+
 			return true;
 		}
 	}
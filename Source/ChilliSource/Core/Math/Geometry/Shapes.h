@@ -536,6 +536,17 @@ namespace ChilliSource
 			/// @return Whether it lies within the bounds
 			//-----------------------------------------------------------
 			bool SphereCullTest(const Sphere& inBoundingSphere) const;
+			//----------------------------------------------------------
+			/// Test if the oriented bounding box lies within the
+			/// frustum and determine whether it should be culled. This
+			/// is tighter than the sphere test for flat objects such as
+			/// sprites and accounts for their rotation and scale.
+			///
+			/// @param The oriented bounding box.
+			///
+			/// @return Whether it lies within the bounds.
+			//-----------------------------------------------------------
+			bool OOBBCullTest(const OOBB& in_boundingBox) const;
 
 		public:
 
@@ -55,7 +55,7 @@ namespace ChilliSource
 		{
 		public:
             
-            using ResourceId = u32;
+            using ResourceId = u64;
             
             CS_DECLARE_NOCOPY(Resource);
             
@@ -28,6 +28,7 @@
 
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 
+#include <ChilliSource/Core/Cryptographic/HashXXH64.h>
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
 
 namespace ChilliSource
@@ -91,24 +92,23 @@ namespace ChilliSource
         //------------------------------------------------------------------------------------
         Resource::ResourceId ResourcePool::GenerateResourceId(const std::string& in_uniqueId) const
         {
-            return HashCRC32::GenerateHashCode(in_uniqueId);
+            return HashXXH64::GenerateHashCode(in_uniqueId);
         }
         //------------------------------------------------------------------------------------
+        /// The options hash is used as the seed for the path hash so that the same file
+        /// loaded with different options gets a different id.
         //------------------------------------------------------------------------------------
         Resource::ResourceId ResourcePool::GenerateResourceId(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options) const
         {
             std::string combined(ToString((u32)in_location) + in_filePath);
-            u32 fileHash = HashCRC32::GenerateHashCode(combined);
             
-            if(in_options == nullptr)
+            u64 optionsHash = 0;
+            if(in_options != nullptr)
             {
-                return fileHash;
+                optionsHash = in_options->GenerateHash();
             }
             
-            u32 optionsHash = in_options->GenerateHash();
-            
-            u64 combinedHash = fileHash + ((u64)(optionsHash) << 32);
-            return HashCRC32::GenerateHashCode((const s8*)&combinedHash, sizeof(u64));
+            return HashXXH64::GenerateHashCode(combined, optionsHash);
         }
         //-------------------------------------------------------------------------------------
         /// Resources often have references to other resources and therefore multiple release passes
@@ -170,6 +170,14 @@ namespace ChilliSource
             //-------------------------------------------------------------------------------------
             template <typename TResourceType> void RefreshResources();
             //------------------------------------------------------------------------------------
+            /// Force the reload of the resources of the given type that are currently cached
+            /// and were loaded from file. Each resource is reloaded through the async path of
+            /// its provider, so reading and decoding of the files is spread across the task
+            /// scheduler. The resources will be in the loading state until they are rebuilt.
+            /// whether successfully or not. Note: Always called on the main thread.
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> void RefreshResourcesAsync(const std::function<void()>& in_delegate);
+            //------------------------------------------------------------------------------------
             /// Load the resource of given type from the file location. If the resource at this
             /// location has previously been loaded then the cached version will be returned in the
             /// delegate.
@@ -558,6 +566,81 @@ namespace ChilliSource
                 }
             }
         }
+        //------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> void ResourcePool::RefreshResourcesAsync(const std::function<void()>& in_delegate)
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be refreshed on the main thread");
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+            if(itDescriptor == m_descriptors.end())
+            {
+                lock.unlock();
+                if(in_delegate != nullptr)
+                {
+                    in_delegate();
+                }
+                return;
+            }
+            
+            PoolDesc& desc(itDescriptor->second);
+            
+            //Gather the resources first so the providers are not called while the pool is locked.
+            std::vector<std::pair<ResourceProvider*, ResourceSPtr>> resourcesToRefresh;
+            for(auto& resourceEntry : desc.m_cachedResources)
+            {
+                const ResourceSPtr& resource(resourceEntry.second);
+                
+                if(resource->GetStorageLocation() != CSCore::StorageLocation::k_none)
+                {
+                    ResourceProvider* provider = FindProvider(resource->GetFilePath(), desc);
+                    if(provider == nullptr)
+                    {
+                        CS_LOG_ERROR("Failed to find resource provider for " + resource->GetName());
+                        continue;
+                    }
+                    
+                    resourcesToRefresh.push_back(std::make_pair(provider, resource));
+                }
+            }
+            
+            lock.unlock();
+            
+            if(resourcesToRefresh.empty() == true)
+            {
+                if(in_delegate != nullptr)
+                {
+                    in_delegate();
+                }
+                return;
+            }
+            
+            //The provider delegates are always called on the main thread so the count doesn't need to be atomic.
+            auto numRemaining = std::make_shared<u32>(resourcesToRefresh.size());
+            ResourceProvider::AsyncLoadDelegate completionDelegate([=](const ResourceSPtr& in_resource)
+            {
+                if(in_resource->GetLoadState() != Resource::LoadState::k_loaded)
+                {
+                    CS_LOG_ERROR("Failed to refresh resource for " + in_resource->GetName());
+                }
+                
+                CS_ASSERT(*numRemaining > 0, "Too many resource refresh completions.");
+                if(--(*numRemaining) == 0 && in_delegate != nullptr)
+                {
+                    in_delegate();
+                }
+            });
+            
+            for(auto& resourceEntry : resourcesToRefresh)
+            {
+                const ResourceSPtr& resource(resourceEntry.second);
+                
+                resource->SetLoadState(Resource::LoadState::k_loading);
+                std::string deviceFilePath = Application::Get()->GetTaggedFilePathResolver()->ResolveFilePath(resource->GetStorageLocation(), resource->GetFilePath());
+                resourceEntry.first->CreateResourceFromFileAsync(resource->GetStorageLocation(), deviceFilePath, resource->GetOptions(), completionDelegate, resource);
+            }
+        }
         //-------------------------------------------------------------------------------------
         //-------------------------------------------------------------------------------------
         template <typename TResourceType> void ResourcePool::LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
@@ -28,6 +28,7 @@
 
 #include <ChilliSource/Core/Scene/Scene.h>
 
+#include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
 #include <ChilliSource/GUI/Base/Window.h>
 
 #include <algorithm>
@@ -36,6 +37,46 @@ namespace ChilliSource
 {
 	namespace Core
 	{
+        namespace
+        {
+            //-------------------------------------------------------
+            /// Calculates the bounds used for a volume in the bounding
+            /// volume hierarchy. Queries test the AABB, OOBB and bounding
+            /// sphere, which do not necessarily contain each other, so
+            /// the bounds enclose all three.
+            ///
+            /// @param The volume component.
+            ///
+            /// @return The world space bounds.
+            //-------------------------------------------------------
+            AABB CalculateHierarchyBounds(VolumeComponent* in_volume)
+            {
+                const AABB& aabb = in_volume->GetAABB();
+                Vector3 minimum = aabb.GetMin();
+                Vector3 maximum = aabb.GetMax();
+                
+                const Sphere& sphere = in_volume->GetBoundingSphere();
+                Vector3 radius(sphere.fRadius, sphere.fRadius, sphere.fRadius);
+                minimum = Vector3::Min(minimum, sphere.vOrigin - radius);
+                maximum = Vector3::Max(maximum, sphere.vOrigin + radius);
+                
+                const OOBB& oobb = in_volume->GetOOBB();
+                const Matrix4& transform = oobb.GetTransform();
+                Vector3 halfSize = oobb.GetSize() * 0.5f;
+                for (u32 i = 0; i < 8; ++i)
+                {
+                    Vector3 corner(oobb.GetOrigin().x + ((i & 1) ? halfSize.x : -halfSize.x),
+                                   oobb.GetOrigin().y + ((i & 2) ? halfSize.y : -halfSize.y),
+                                   oobb.GetOrigin().z + ((i & 4) ? halfSize.z : -halfSize.z));
+                    corner = corner * transform;
+                    minimum = Vector3::Min(minimum, corner);
+                    maximum = Vector3::Max(maximum, corner);
+                }
+                
+                return AABB((minimum + maximum) * 0.5f, maximum - minimum);
+            }
+        }
+        
         CS_DEFINE_NAMEDTYPE(Scene);
         
         //-------------------------------------------------------
@@ -210,10 +251,12 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		void Scene::QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents)
 		{
+            UpdateVolumeHierarchy();
+            
 			std::vector<VolumeComponent*> intersectableComponents;
-			QuerySceneForComponents(intersectableComponents);
+            m_volumeHierarchy.QueryRay(in_ray, intersectableComponents);
 			
-			//Loop through the render components and check for intersection
+			//Loop through the components whose bounds may be hit and check for intersection
 			//If any intersect then add them to the intersect list
 			for(std::vector<VolumeComponent*>::iterator it = intersectableComponents.begin(); it != intersectableComponents.end(); ++it)
 			{
@@ -231,6 +274,46 @@ namespace ChilliSource
 		}
         //--------------------------------------------------------------------------------------------------
         //--------------------------------------------------------------------------------------------------
+        void Scene::QuerySceneForIntersection(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumeComponents)
+        {
+            UpdateVolumeHierarchy();
+            
+            u32 firstCandidate = out_volumeComponents.size();
+            m_volumeHierarchy.QueryFrustum(in_frustum, out_volumeComponents);
+            
+            //filter the candidates in place
+            auto end = std::remove_if(out_volumeComponents.begin() + firstCandidate, out_volumeComponents.end(), [&](VolumeComponent* in_component)
+            {
+                return in_frustum.SphereCullTest(in_component->GetBoundingSphere()) == false;
+            });
+            out_volumeComponents.erase(end, out_volumeComponents.end());
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::QuerySceneForPotentialIntersection(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumeComponents)
+        {
+            UpdateVolumeHierarchy();
+            
+            m_volumeHierarchy.QueryFrustum(in_frustum, out_volumeComponents);
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::QuerySceneForIntersection(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumeComponents)
+        {
+            UpdateVolumeHierarchy();
+            
+            u32 firstCandidate = out_volumeComponents.size();
+            m_volumeHierarchy.QuerySphere(in_sphere, out_volumeComponents);
+            
+            //filter the candidates in place
+            auto end = std::remove_if(out_volumeComponents.begin() + firstCandidate, out_volumeComponents.end(), [&](VolumeComponent* in_component)
+            {
+                return ShapeIntersection::Intersects(in_sphere, in_component->GetBoundingSphere()) == false;
+            });
+            out_volumeComponents.erase(end, out_volumeComponents.end());
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
         GUI::Window* Scene::GetWindow()
         {
             return m_rootWindow.get();
@@ -265,6 +348,92 @@ namespace ChilliSource
                 it->swap(m_entities.back());
                 m_entities.pop_back();
             }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::OnComponentAddedToScene(Component* in_component)
+        {
+            if (in_component->IsA(VolumeComponent::InterfaceID) == false)
+            {
+                return;
+            }
+            
+            VolumeComponent* volume = static_cast<VolumeComponent*>(in_component);
+            CS_ASSERT(m_volumeProxies.find(volume) == m_volumeProxies.end(), "Volume component has already been added to the scene.");
+            
+            //the volume is inserted into the hierarchy lazily, the next time the scene is queried, as its bounds may not yet be available.
+            VolumeProxy& proxy = m_volumeProxies[volume];
+            proxy.m_transformChangedConnection = volume->GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection([=]()
+            {
+                InvalidateVolume(volume);
+            });
+            InvalidateVolume(volume);
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::OnComponentRemovedFromScene(Component* in_component)
+        {
+            if (in_component->IsA(VolumeComponent::InterfaceID) == false)
+            {
+                return;
+            }
+            
+            VolumeComponent* volume = static_cast<VolumeComponent*>(in_component);
+            auto it = m_volumeProxies.find(volume);
+            if (it == m_volumeProxies.end())
+            {
+                return;
+            }
+            
+            if (it->second.m_proxyId != BoundingVolumeHierarchy::k_nullProxy)
+            {
+                m_volumeHierarchy.Remove(it->second.m_proxyId);
+            }
+            
+            if (it->second.m_isDirty == true)
+            {
+                m_dirtyVolumes.erase(std::remove(m_dirtyVolumes.begin(), m_dirtyVolumes.end(), volume), m_dirtyVolumes.end());
+            }
+            
+            m_volumeProxies.erase(it);
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::InvalidateVolume(VolumeComponent* in_volume)
+        {
+            auto it = m_volumeProxies.find(in_volume);
+            if (it != m_volumeProxies.end() && it->second.m_isDirty == false)
+            {
+                it->second.m_isDirty = true;
+                m_dirtyVolumes.push_back(in_volume);
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::UpdateVolumeHierarchy()
+        {
+            //calculating bounds can cause a volume to be invalidated again, so work from a copy of the list.
+            std::vector<VolumeComponent*> dirtyVolumes;
+            dirtyVolumes.swap(m_dirtyVolumes);
+            
+            for (VolumeComponent* volume : dirtyVolumes)
+            {
+                auto it = m_volumeProxies.find(volume);
+                CS_ASSERT(it != m_volumeProxies.end(), "Invalidated volume is not in the scene.");
+                
+                VolumeProxy& proxy = it->second;
+                proxy.m_isDirty = false;
+                
+                AABB bounds = CalculateHierarchyBounds(volume);
+                if (proxy.m_proxyId == BoundingVolumeHierarchy::k_nullProxy)
+                {
+                    proxy.m_proxyId = m_volumeHierarchy.Add(volume, bounds);
+                }
+                else
+                {
+                    m_volumeHierarchy.Update(proxy.m_proxyId, bounds);
+                }
+            }
         }
 		//--------------------------------------------------------------------------------------------------
 		//--------------------------------------------------------------------------------------------------
@@ -33,9 +33,13 @@
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Event/EventConnection.h>
 #include <ChilliSource/Core/System/StateSystem.h>
+#include <ChilliSource/Core/Volume/BoundingVolumeHierarchy.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 
+#include <unordered_map>
+
 namespace ChilliSource
 {
 	namespace Core
@@ -184,6 +188,32 @@ namespace ChilliSource
 			/// @param [Out] Container to fill with intersecting components
 			//--------------------------------------------------------------------------------------------------
 			void QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents);
+            //--------------------------------------------------------------------------------------------------
+            /// Adds any volume components whose bounding sphere lies at least partially within the frustum
+            /// to the list. The list order is undefined.
+            ///
+            /// @param Frustum to check intersection
+            /// @param [Out] Container to fill with intersecting components
+            //--------------------------------------------------------------------------------------------------
+            void QuerySceneForIntersection(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumeComponents);
+            //--------------------------------------------------------------------------------------------------
+            /// Adds any volume components which might lie within the frustum to the list, without testing
+            /// the components themselves. This is a superset of the components whose bounding sphere, box or
+            /// oriented box lie within the frustum, for use by callers which perform their own exact test.
+            /// The list order is undefined.
+            ///
+            /// @param Frustum to check intersection
+            /// @param [Out] Container to fill with candidate components
+            //--------------------------------------------------------------------------------------------------
+            void QuerySceneForPotentialIntersection(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumeComponents);
+            //--------------------------------------------------------------------------------------------------
+            /// Adds any volume components whose bounding sphere intersects the given sphere to the list.
+            /// The list order is undefined.
+            ///
+            /// @param Sphere to check intersection
+            /// @param [Out] Container to fill with intersecting components
+            //--------------------------------------------------------------------------------------------------
+            void QuerySceneForIntersection(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumeComponents);
             //--------------------------------------------------------------------------------------------------
 			/// Traverse the scene for the given component type and fill the list with those components
             ///
@@ -241,6 +271,18 @@ namespace ChilliSource
             
         private:
             friend class Entity;
+            friend class VolumeComponent;
+            
+            //-------------------------------------------------------
+            /// The entry for a volume component in the bounding
+            /// volume hierarchy.
+            //-------------------------------------------------------
+            struct VolumeProxy
+            {
+                s32 m_proxyId = BoundingVolumeHierarchy::k_nullProxy;
+                EventConnectionUPtr m_transformChangedConnection;
+                bool m_isDirty = false;
+            };
             
             //-------------------------------------------------------
             /// Private to enforce use of factory method
@@ -256,11 +298,45 @@ namespace ChilliSource
             /// @param Entity
             //-------------------------------------------------------
             void Remove(Entity* inpEntity);
+            //-------------------------------------------------------
+            /// Called by entities when a component is added to the
+            /// scene. Volume components are added to the bounding
+            /// volume hierarchy.
+            ///
+            /// @param The component.
+            //-------------------------------------------------------
+            void OnComponentAddedToScene(Component* in_component);
+            //-------------------------------------------------------
+            /// Called by entities when a component is removed from
+            /// the scene. Volume components are removed from the
+            /// bounding volume hierarchy.
+            ///
+            /// @param The component.
+            //-------------------------------------------------------
+            void OnComponentRemovedFromScene(Component* in_component);
+            //-------------------------------------------------------
+            /// Flags the bounds of the given volume as changed. The
+            /// hierarchy is refitted lazily before the next query.
+            /// This is called automatically when the volume's entity
+            /// transform changes; volume components should also call
+            /// it if their bounds change for any other reason.
+            ///
+            /// @param The volume component.
+            //-------------------------------------------------------
+            void InvalidateVolume(VolumeComponent* in_volume);
+            //-------------------------------------------------------
+            /// Refits any volumes whose bounds have changed since
+            /// the last query.
+            //-------------------------------------------------------
+            void UpdateVolumeHierarchy();
             
 		private:
 			
 			GUI::WindowUPtr m_rootWindow;
 			SharedEntityList m_entities;
+            BoundingVolumeHierarchy m_volumeHierarchy;
+            std::unordered_map<VolumeComponent*, VolumeProxy> m_volumeProxies;
+            std::vector<VolumeComponent*> m_dirtyVolumes;
             Colour m_clearColour;
             bool m_entitiesActive = false;
             bool m_entitiesForegrounded = false;
@@ -32,6 +32,8 @@
 #include <ChilliSource/Rendering/Base/SurfaceFormat.h>
 
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <string>
 
 namespace ChilliSource
@@ -40,33 +42,231 @@ namespace ChilliSource
     {
         namespace
         {
+            //the maximum number of significant digits that can be accumulated without overflowing a u64.
+            const u32 k_maxMantissaDigits = 19;
+            //the largest integer that can be represented exactly by a double.
+            const u64 k_maxExactMantissa = u64(1) << 53;
+            //the largest power of 10 that can be represented exactly by a double.
+            const s32 k_maxExactExponent = 22;
+            const f64 k_exactPowersOfTen[k_maxExactExponent + 1] =
+            {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+            };
             //------------------------------------------------------------
-            /// Helper function to count items in a string seperated by a
-            /// space ' ' character.
+            /// @param The character.
             ///
+            /// @return Whether or not the character separates items in a
+            /// list.
+            //------------------------------------------------------------
+            inline bool IsSeparator(s8 in_char)
+            {
+                return (in_char == ' ' || in_char == '\t' || in_char == '\n' || in_char == '\r');
+            }
+            //------------------------------------------------------------
             /// @author Ian Copland
             ///
-            /// @param The string list.
+            /// @param The character.
             ///
-            /// @return The number of items.
+            /// @return Whether or not the character is a decimal digit.
             //------------------------------------------------------------
-            static const u32 EnumerateItems(const std::string& in_stringList)
+            inline bool IsDigit(s8 in_char)
             {
-                u32 itemCount = 0;
-                u32 i = 0;
-                const u32 size = in_stringList.size();
-                while(i < size)
+                return (in_char >= '0' && in_char <= '9');
+            }
+            //------------------------------------------------------------
+            /// Parses a floating point number from the start of the given
+            /// range, in the same format as strtod(). Up to 19 significant
+            /// digits are accumulated into an integer mantissa. If the
+            /// mantissa fits in the 53 bits of a double, which is always
+            /// the case for 15 or fewer significant digits, and the
+            /// exponent is small, the value is converted exactly with a
+            /// single multiply or divide by an exactly representable power
+            /// of ten. Anything else, such as longer mantissas, large
+            /// exponents, hexadecimal values, infinities and NaNs, falls
+            /// back to strtod().
+            ///
+            /// @param The start of the range.
+            /// @param The end of the range.
+            /// @param [Out] The value, or 0 if no number could be parsed.
+            ///
+            /// @return The position after the number, or the start of
+            /// the range if no number could be parsed.
+            //------------------------------------------------------------
+            const s8* ParseDouble(const s8* in_begin, const s8* in_end, f64& out_value)
+            {
+                out_value = 0.0;
+                
+                const s8* position = in_begin;
+                while (position != in_end && IsSeparator(*position) == true)
                 {
-                    if(in_stringList[i] != ' ')
+                    ++position;
+                }
+                const s8* numberStart = position;
+                
+                bool isNegative = false;
+                if (position != in_end && (*position == '-' || *position == '+'))
+                {
+                    isNegative = (*position == '-');
+                    ++position;
+                }
+                
+                //hexadecimal values are left to the fallback. Only the leading '0' is consumed below.
+                const bool isHex = (in_end - position >= 2 && position[0] == '0' && (position[1] == 'x' || position[1] == 'X'));
+                
+                u64 mantissa = 0;
+                u32 numSignificantDigits = 0;
+                u32 numDigits = 0;
+                s32 exponent = 0;
+                bool isTruncated = isHex;
+                
+                while (position != in_end && IsDigit(*position) == true)
+                {
+                    if (numSignificantDigits < k_maxMantissaDigits)
+                    {
+                        mantissa = mantissa * 10 + u64(*position - '0');
+                        numSignificantDigits += (mantissa != 0) ? 1 : 0;
+                    }
+                    else
                     {
-                        itemCount++;
-                        while(in_stringList[i] != ' ' &&  i < size)i++;
+                        isTruncated = true;
+                        ++exponent;
+                    }
+                    ++numDigits;
+                    ++position;
+                }
+                
+                if (position != in_end && *position == '.')
+                {
+                    ++position;
+                    while (position != in_end && IsDigit(*position) == true)
+                    {
+                        if (numSignificantDigits < k_maxMantissaDigits)
+                        {
+                            mantissa = mantissa * 10 + u64(*position - '0');
+                            numSignificantDigits += (mantissa != 0) ? 1 : 0;
+                            --exponent;
+                        }
+                        else
+                        {
+                            isTruncated = true;
+                        }
+                        ++numDigits;
+                        ++position;
+                    }
+                }
+                
+                if (numDigits == 0)
+                {
+                    //this might still be an infinity or NaN, which are left to the fallback.
+                    isTruncated = true;
+                }
+                else if (position != in_end && (*position == 'e' || *position == 'E'))
+                {
+                    //the exponent is only consumed if it contains at least one digit.
+                    const s8* exponentPosition = position + 1;
+                    bool isExponentNegative = false;
+                    if (exponentPosition != in_end && (*exponentPosition == '-' || *exponentPosition == '+'))
+                    {
+                        isExponentNegative = (*exponentPosition == '-');
+                        ++exponentPosition;
                     }
                     
-                    while(in_stringList[i] == ' ' &&  i < size)i++;
+                    if (exponentPosition != in_end && IsDigit(*exponentPosition) == true)
+                    {
+                        s32 explicitExponent = 0;
+                        while (exponentPosition != in_end && IsDigit(*exponentPosition) == true)
+                        {
+                            if (explicitExponent < 10000)
+                            {
+                                explicitExponent = explicitExponent * 10 + s32(*exponentPosition - '0');
+                            }
+                            ++exponentPosition;
+                        }
+                        
+                        exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+                        position = exponentPosition;
+                    }
+                }
+                
+                if (isTruncated == false && mantissa <= k_maxExactMantissa && exponent >= -k_maxExactExponent && exponent <= k_maxExactExponent)
+                {
+                    f64 value = f64(mantissa);
+                    value = (exponent < 0) ? value / k_exactPowersOfTen[-exponent] : value * k_exactPowersOfTen[exponent];
+                    out_value = isNegative ? -value : value;
+                    return position;
+                }
+                
+                //strtod() requires a null terminated string, so copy the number out. Numbers long enough
+                //to not fit on the stack are rare enough that the allocation doesn't matter.
+                const s8* fallbackEnd = position;
+                while ((numDigits == 0 || isHex == true) && fallbackEnd != in_end && IsSeparator(*fallbackEnd) == false)
+                {
+                    ++fallbackEnd;
+                }
+                u32 length = u32(fallbackEnd - numberStart);
+                
+                const u32 k_bufferSize = 64;
+                s8 buffer[k_bufferSize];
+                std::string longNumber;
+                const s8* number = buffer;
+                if (length < k_bufferSize)
+                {
+                    memcpy(buffer, numberStart, length);
+                    buffer[length] = '\0';
+                }
+                else
+                {
+                    longNumber.assign(numberStart, length);
+                    number = longNumber.c_str();
                 }
                 
-                return itemCount;
+                s8* parseEnd = nullptr;
+                out_value = strtod(number, &parseEnd);
+                if (parseEnd == number)
+                {
+                    out_value = 0.0;
+                    return in_begin;
+                }
+                return numberStart + (parseEnd - number);
+            }
+            //------------------------------------------------------------
+            /// Parses an integer from the given string. If the magnitude
+            /// is too large to fit in a u64 it is clamped.
+            ///
+            /// @param The string.
+            /// @param [Out] Whether or not the value is negative.
+            ///
+            /// @return The magnitude of the value, or 0 if no integer
+            /// could be parsed.
+            //------------------------------------------------------------
+            u64 ParseInteger(const std::string& in_string, bool& out_isNegative)
+            {
+                const s8* position = in_string.data();
+                const s8* end = position + in_string.size();
+                
+                while (position != end && IsSeparator(*position) == true)
+                {
+                    ++position;
+                }
+                
+                out_isNegative = false;
+                if (position != end && (*position == '-' || *position == '+'))
+                {
+                    out_isNegative = (*position == '-');
+                    ++position;
+                }
+                
+                const u64 k_maxValue = std::numeric_limits<u64>::max();
+                
+                u64 value = 0;
+                while (position != end && IsDigit(*position) == true)
+                {
+                    const u64 digit = u64(*position - '0');
+                    value = (value > (k_maxValue - digit) / 10) ? k_maxValue : value * 10 + digit;
+                    ++position;
+                }
+                return value;
             }
         }
         
@@ -74,7 +274,9 @@ namespace ChilliSource
         //------------------------------------------------------------
         f32 ParseF32(const std::string& in_string)
         {
-            return (f32)strtod(in_string.c_str(), nullptr);
+            f64 value = 0.0;
+            ParseDouble(in_string.data(), in_string.data() + in_string.size(), value);
+            return (f32)value;
         }
         //------------------------------------------------------------
         //------------------------------------------------------------
@@ -92,19 +294,24 @@ namespace ChilliSource
         //------------------------------------------------------------
         s64 ParseS64(const std::string& in_string)
         {
-            std::istringstream str(in_string);
-			long ret = 0;
-			str >> ret;
-			return ret;
+            bool isNegative = false;
+            u64 magnitude = ParseInteger(in_string, isNegative);
+            
+            //values outside of the range of an s64 are clamped.
+            const u64 k_maxPositive = u64(std::numeric_limits<s64>::max());
+            if (isNegative == true)
+            {
+                return (magnitude > k_maxPositive) ? std::numeric_limits<s64>::min() : -s64(magnitude);
+            }
+            return (magnitude > k_maxPositive) ? std::numeric_limits<s64>::max() : s64(magnitude);
         }
         //------------------------------------------------------------
         //------------------------------------------------------------
         u64 ParseU64(const std::string& in_string)
         {
-            std::istringstream str(in_string);
-			unsigned long ret = 0;
-			str >> ret;
-			return ret;
+            bool isNegative = false;
+            u64 magnitude = ParseInteger(in_string, isNegative);
+            return isNegative ? 0 - magnitude : magnitude;
         }
         //------------------------------------------------------------
         //------------------------------------------------------------
@@ -114,9 +321,48 @@ namespace ChilliSource
         }
         //------------------------------------------------------------
         //------------------------------------------------------------
+        u32 ParseF32List(const std::string& in_string, u32 in_maxValues, f32* out_values)
+        {
+            const s8* position = in_string.data();
+            const s8* end = position + in_string.size();
+            
+            u32 itemCount = 0;
+            while (true)
+            {
+                while (position != end && IsSeparator(*position) == true)
+                {
+                    ++position;
+                }
+                
+                if (position == end)
+                {
+                    break;
+                }
+                
+                f64 value = 0.0;
+                position = ParseDouble(position, end, value);
+                
+                //skip anything left over in the item, such as a trailing 'f'.
+                while (position != end && IsSeparator(*position) == false)
+                {
+                    ++position;
+                }
+                
+                if (itemCount < in_maxValues)
+                {
+                    out_values[itemCount] = (f32)value;
+                }
+                ++itemCount;
+            }
+            
+            return itemCount;
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
         Vector2 ParseVector2(const std::string& in_string)
         {
-            u32 udwSize = EnumerateItems(in_string);
+            f32 values[2];
+            u32 udwSize = ParseF32List(in_string, 2, values);
             CS_ASSERT((udwSize == 2), "Invalid number of elements for Vector2.");
             
 			if (udwSize != 2)
@@ -125,16 +371,15 @@ namespace ChilliSource
 			}
 			else
 			{
-                Vector2 vRet;
-				CS_SSCANF(in_string.c_str(), "%f %f", &vRet.x, &vRet.y);
-				return vRet;
+				return Vector2(values[0], values[1]);
 			}
         }
         //------------------------------------------------------------
         //------------------------------------------------------------
         Vector3 ParseVector3(const std::string& in_string)
         {
-            u32 udwSize = EnumerateItems(in_string);
+            f32 values[3];
+            u32 udwSize = ParseF32List(in_string, 3, values);
             CS_ASSERT((udwSize == 3), "Invalid number of elements for Vector3.");
             
 			if (udwSize != 3)
@@ -143,16 +388,15 @@ namespace ChilliSource
 			}
 			else
 			{
-				Vector3 vRet;
-				CS_SSCANF(in_string.c_str(), "%f %f %f", &vRet.x, &vRet.y, &vRet.z);
-				return vRet;
+				return Vector3(values[0], values[1], values[2]);
 			}
         }
         //------------------------------------------------------------
         //------------------------------------------------------------
         Vector4 ParseVector4(const std::string& in_string)
         {
-            u32 udwSize = EnumerateItems(in_string);
+            f32 values[4];
+            u32 udwSize = ParseF32List(in_string, 4, values);
             CS_ASSERT((udwSize == 4), "Invalid number of elements for Vector4.");
             
 			if (udwSize != 4)
@@ -161,16 +405,15 @@ namespace ChilliSource
 			}
 			else
 			{
-				Vector4 vRet;
-				CS_SSCANF(in_string.c_str(), "%f %f %f %f", &vRet.x, &vRet.y, &vRet.z, &vRet.w);
-				return vRet;
+				return Vector4(values[0], values[1], values[2], values[3]);
 			}
         }
         //------------------------------------------------------------
         //------------------------------------------------------------
         Matrix3 ParseMatrix3(const std::string& in_string)
         {
-            u32 udwSize = EnumerateItems(in_string);
+            Matrix3 matRet;
+            u32 udwSize = ParseF32List(in_string, 9, matRet.m);
             CS_ASSERT((udwSize == 9), "Invalid number of elements for Matrix3.");
             
 			if (udwSize != 9)
@@ -179,13 +422,6 @@ namespace ChilliSource
 			}
 			else
 			{
-                Matrix3 matRet;
-                
-				CS_SSCANF(in_string.c_str(), "%f %f %f %f %f %f %f %f %f",
-                          &matRet.m[0], &matRet.m[1], &matRet.m[2],
-                          &matRet.m[3], &matRet.m[4], &matRet.m[5],
-                          &matRet.m[6], &matRet.m[7], &matRet.m[8]);
-                
                 return matRet;
 			}
         }
@@ -193,7 +429,8 @@ namespace ChilliSource
         //------------------------------------------------------------
         Matrix4 ParseMatrix4(const std::string& in_string)
         {
-            u32 udwSize = EnumerateItems(in_string);
+            Matrix4 matRet;
+            u32 udwSize = ParseF32List(in_string, 16, matRet.m);
             CS_ASSERT((udwSize == 16), "Invalid number of elements for Matrix4.");
             
 			if (udwSize != 16)
@@ -202,23 +439,15 @@ namespace ChilliSource
 			}
 			else
 			{
-                Matrix4 matRet;
-                
-				CS_SSCANF(in_string.c_str(), "%f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f ",
-						&matRet.m[0], &matRet.m[1], &matRet.m[2], &matRet.m[3],
-						&matRet.m[4], &matRet.m[5], &matRet.m[6], &matRet.m[7],
-						&matRet.m[8], &matRet.m[9], &matRet.m[10], &matRet.m[11],
-						&matRet.m[12], &matRet.m[13], &matRet.m[14], &matRet.m[15]);
-                
                 return matRet;
-                
 			}
         }
         //------------------------------------------------------------
         //------------------------------------------------------------
         Quaternion ParseQuaternion(const std::string& in_string)
         {
-            u32 udwSize = EnumerateItems(in_string);
+            f32 values[4];
+            u32 udwSize = ParseF32List(in_string, 4, values);
             CS_ASSERT((udwSize == 4), "Invalid number of elements for Quaternion.");
             
 			if (udwSize != 4)
@@ -228,7 +457,10 @@ namespace ChilliSource
 			else
 			{
                 Quaternion qRet;
-				CS_SSCANF(in_string.c_str(), "%f %f %f %f", &qRet.w, &qRet.x, &qRet.y, &qRet.z);
+                qRet.w = values[0];
+                qRet.x = values[1];
+                qRet.y = values[2];
+                qRet.z = values[3];
                 return qRet;
 			}
         }
@@ -236,18 +468,21 @@ namespace ChilliSource
         //------------------------------------------------------------
         Colour ParseColour(const std::string& in_string)
         {
-            u32 udwSize = EnumerateItems(in_string);
+            f32 values[4];
+            u32 udwSize = ParseF32List(in_string, 4, values);
             CS_ASSERT((udwSize == 3 || udwSize == 4), "Invalid number of elements for Colour.");
             
 			Colour cRet(Colour::k_black);
             
-			if (udwSize == 4)
-			{
-				CS_SSCANF(in_string.c_str(), "%f %f %f %f", &cRet.r, &cRet.g, &cRet.b, &cRet.a);
-			}
-			else if (udwSize == 3)
+			if (udwSize == 4 || udwSize == 3)
 			{
-                CS_SSCANF(in_string.c_str(), "%f %f %f", &cRet.r, &cRet.g, &cRet.b);
+                cRet.r = values[0];
+                cRet.g = values[1];
+                cRet.b = values[2];
+                if (udwSize == 4)
+                {
+                    cRet.a = values[3];
+                }
 			}
             return cRet;
         }
@@ -44,7 +44,10 @@ namespace ChilliSource
     {
         //------------------------------------------------------------
         /// Parse a string to a 32 bit float. If the string cannot be
-        /// be parsed this will return 0.
+        /// be parsed this will return 0. Parsing does not allocate and
+        /// always uses '.' as the decimal point, regardless of the
+        /// current locale. Hexadecimal values, infinities and NaNs
+        /// are accepted in the same format as strtod().
         ///
         /// @author Ian Copland
         ///
@@ -77,7 +80,8 @@ namespace ChilliSource
         u32 ParseU32(const std::string& in_string);
         //------------------------------------------------------------
         /// Parse a string to a 64 bit signed integer. If the string
-        /// cannot be be parsed this will return 0.
+        /// cannot be be parsed this will return 0. Values outside of
+        /// the range of an s64 are clamped to the nearest limit.
         ///
         /// @author Ian Copland
         ///
@@ -87,8 +91,9 @@ namespace ChilliSource
         //------------------------------------------------------------
         s64 ParseS64(const std::string& in_string);
         //------------------------------------------------------------
-        /// Parse a string to a 32 bit unsigned integer. If the string
-        /// cannot be be parsed this will return 0.
+        /// Parse a string to a 64 bit unsigned integer. If the string
+        /// cannot be be parsed this will return 0. Values too large
+        /// for a u64 are clamped to the maximum.
         ///
         /// @author Ian Copland
         ///
@@ -110,6 +115,23 @@ namespace ChilliSource
         //------------------------------------------------------------
         bool ParseBool(const std::string& in_string);
         //------------------------------------------------------------
+        /// Parse a list of 32 bit floats in the format "a b c ...",
+        /// i.e F32 values, whitespace delimited. This is used by all of
+        /// the vector, matrix and colour parsing methods, and can be
+        /// used directly to parse other multi-value attributes without
+        /// tokenising the string. Items which cannot be parsed are
+        /// treated as 0.
+        ///
+        /// @param The string.
+        /// @param The maximum number of values to write.
+        /// @param [Out] The output buffer. This must be large enough
+        /// to hold the maximum number of values.
+        ///
+        /// @return The number of items in the string. This may be
+        /// larger than the number of values written.
+        //------------------------------------------------------------
+        u32 ParseF32List(const std::string& in_string, u32 in_maxValues, f32* out_values);
+        //------------------------------------------------------------
         /// Parse a string to a 2 component vector. The vector must be
         /// in the format "x y", i.e F32 values, space delimited. Failure
         /// to parse will result in a zero vector.
@@ -35,30 +35,113 @@
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Core/String/StringParser.h>
 
+#include <cstdio>
 #include <sstream>
 
 namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            //enough for any value printed with %g at the maximum fast path precision.
+            const u32 k_numberBufferSize = 32;
+            const u16 k_maxFastPathPrecision = 17;
+            //the precision used by std::ostream by default, which covers most authored values.
+            const u32 k_defaultPrecision = 6;
+            //the number of significant digits needed to round trip any 32 bit float.
+            const u32 k_maxF32Precision = 9;
+            
+            //---------------------------------------------------------
+            /// Formats a value with printf() and ensures the decimal
+            /// point is always '.', regardless of the current locale.
+            ///
+            /// @param The value.
+            /// @param The precision.
+            /// @param [Out] The output buffer.
+            ///
+            /// @return The length of the formatted string.
+            //---------------------------------------------------------
+            u32 FormatDouble(f64 in_value, u32 in_precision, s8 (&out_buffer)[k_numberBufferSize])
+            {
+                s32 length = CS_SPRINTF(out_buffer, "%.*g", s32(in_precision), in_value);
+                for (s32 i = 0; i < length; ++i)
+                {
+                    if (out_buffer[i] == ',')
+                    {
+                        out_buffer[i] = '.';
+                    }
+                }
+                return u32(length);
+            }
+            //---------------------------------------------------------
+            /// Appends the shortest representation of the given float
+            /// which parses back to exactly the same value. Values
+            /// which can be represented in the default stream
+            /// precision, which is the majority of authored values,
+            /// are formatted once.
+            ///
+            /// @param The value.
+            /// @param [Out] The string to append to.
+            //---------------------------------------------------------
+            void AppendShortest(f32 in_value, std::string& out_string)
+            {
+                s8 buffer[k_numberBufferSize];
+                u32 length = 0;
+                for (u32 precision = k_defaultPrecision; precision <= k_maxF32Precision; ++precision)
+                {
+                    length = FormatDouble(in_value, precision, buffer);
+                    if (ParseF32(std::string(buffer, length)) == in_value)
+                    {
+                        break;
+                    }
+                }
+                out_string.append(buffer, length);
+            }
+            //---------------------------------------------------------
+            /// Converts a list of floats to a space delimited string.
+            ///
+            /// @param The values.
+            /// @param The number of values.
+            ///
+            /// @return The string.
+            //---------------------------------------------------------
+            std::string JoinValues(const f32* in_values, u32 in_numValues)
+            {
+                std::string output;
+                output.reserve(in_numValues * 12);
+                for (u32 i = 0; i < in_numValues; ++i)
+                {
+                    if (i > 0)
+                    {
+                        output += ' ';
+                    }
+                    AppendShortest(in_values[i], output);
+                }
+                return output;
+            }
+        }
+        
         //---------------------------------------------------------
         //---------------------------------------------------------
         std::string ToString(f32 in_value, u16 in_precision, u16 in_width, s8 in_fill, std::ios::fmtflags in_flags)
         {
-            std::stringstream stream;
-			stream.precision(in_precision);
-			stream.width(in_width);
-			stream.fill(in_fill);
-			if (in_flags)
-				stream.setf(in_flags);
-			stream << in_value;
-			return stream.str();
+            return ToString(f64(in_value), in_precision, in_width, in_fill, in_flags);
         }
         //---------------------------------------------------------
         //---------------------------------------------------------
         std::string ToString(f64 in_value, u16 in_precision, u16 in_width, s8 in_fill, std::ios::fmtflags in_flags)
         {
+            //the common case of no formatting options doesn't need a stream.
+            if (in_width == 0 && in_flags == std::ios::fmtflags(0) && in_precision <= k_maxFastPathPrecision)
+            {
+                s8 buffer[k_numberBufferSize];
+                u32 length = FormatDouble(in_value, in_precision, buffer);
+                return std::string(buffer, length);
+            }
+            
             std::stringstream stream;
 			stream.precision(in_precision);
 			stream.width(in_width);
@@ -72,6 +155,11 @@ namespace ChilliSource
         //---------------------------------------------------------
         std::string ToString(s32 in_value, u16 in_width, s8 in_fill, std::ios::fmtflags in_flags)
         {
+            if (in_width == 0 && in_flags == std::ios::fmtflags(0))
+            {
+                return ToString(in_value);
+            }
+            
             std::stringstream stream;
 			stream.width(in_width);
 			stream.fill(in_fill);
@@ -92,6 +180,11 @@ namespace ChilliSource
         //---------------------------------------------------------
         std::string ToString(u32 in_value, u16 in_width, s8 in_fill, std::ios::fmtflags in_flags)
         {
+            if (in_width == 0 && in_flags == std::ios::fmtflags(0))
+            {
+                return ToString(in_value);
+            }
+            
             std::stringstream stream;
 			stream.width(in_width);
 			stream.fill(in_fill);
@@ -105,13 +198,20 @@ namespace ChilliSource
         std::string ToString(u32 in_value)
         {
             s8 buffer[16];
-			u32 size = CS_SPRINTF(buffer, "%d", in_value);
+			u32 size = CS_SPRINTF(buffer, "%u", in_value);
             return std::string(buffer, buffer + size);
         }
         //---------------------------------------------------------
         //---------------------------------------------------------
         std::string ToString(s64 in_value, u16 in_width, s8 in_fill, std::ios::fmtflags in_flags)
         {
+            if (in_width == 0 && in_flags == std::ios::fmtflags(0))
+            {
+                s8 buffer[k_numberBufferSize];
+                u32 size = CS_SPRINTF(buffer, "%lld", (long long)in_value);
+                return std::string(buffer, buffer + size);
+            }
+            
             std::stringstream stream;
 			stream.width(in_width);
 			stream.fill(in_fill);
@@ -124,6 +224,13 @@ namespace ChilliSource
         //---------------------------------------------------------
         std::string ToString(u64 in_value, u16 in_width, s8 in_fill, std::ios::fmtflags in_flags)
         {
+            if (in_width == 0 && in_flags == std::ios::fmtflags(0))
+            {
+                s8 buffer[k_numberBufferSize];
+                u32 size = CS_SPRINTF(buffer, "%llu", (unsigned long long)in_value);
+                return std::string(buffer, buffer + size);
+            }
+            
             std::stringstream stream;
 			stream.width(in_width);
 			stream.fill(in_fill);
@@ -163,64 +270,42 @@ namespace ChilliSource
         //---------------------------------------------------------
         std::string ToString(const Vector2& in_value)
         {
-            std::stringstream stream;
-			stream << in_value.x << " " << in_value.y;
-			return stream.str();
+            const f32 values[2] = { in_value.x, in_value.y };
+            return JoinValues(values, 2);
         }
         //---------------------------------------------------------
         //---------------------------------------------------------
         std::string ToString(const Vector3& in_value)
         {
-            std::stringstream stream;
-			stream << in_value.x << " " << in_value.y << " " << in_value.z;
-			return stream.str();
+            const f32 values[3] = { in_value.x, in_value.y, in_value.z };
+            return JoinValues(values, 3);
         }
         //---------------------------------------------------------
         //---------------------------------------------------------
         std::string ToString(const Vector4& in_value)
         {
-            std::stringstream stream;
-			stream << in_value.x << " " << in_value.y << " " << in_value.z << " " << in_value.w;
-			return stream.str();
+            const f32 values[4] = { in_value.x, in_value.y, in_value.z, in_value.w };
+            return JoinValues(values, 4);
         }
         //---------------------------------------------------------
         //---------------------------------------------------------
         std::string ToString(const Matrix4& in_value)
         {
-            std::stringstream stream;
-			stream << in_value.m[0] << " "
-			<< in_value.m[1] << " "
-			<< in_value.m[2] << " "
-			<< in_value.m[3] << " "
-			<< in_value.m[4] << " "
-			<< in_value.m[5] << " "
-			<< in_value.m[6] << " "
-			<< in_value.m[7] << " "
-			<< in_value.m[8] << " "
-			<< in_value.m[9] << " "
-			<< in_value.m[10] << " "
-			<< in_value.m[11] << " "
-			<< in_value.m[12] << " "
-			<< in_value.m[13] << " "
-			<< in_value.m[14] << " "
-			<< in_value.m[15];
-			return stream.str();
+            return JoinValues(in_value.m, 16);
         }
         //---------------------------------------------------------
         //---------------------------------------------------------
         std::string ToString(const Quaternion& in_value)
         {
-            std::stringstream stream;
-			stream  << in_value.w << " " << in_value.x << " " << in_value.y << " " << in_value.z;
-			return stream.str();
+            const f32 values[4] = { in_value.w, in_value.x, in_value.y, in_value.z };
+            return JoinValues(values, 4);
         }
         //---------------------------------------------------------
         //---------------------------------------------------------
         std::string ToString(const Colour& in_value)
         {
-            std::stringstream stream;
-			stream << in_value.r << " " << in_value.g << " " << in_value.b << " " << in_value.a;
-			return stream.str();
+            const f32 values[4] = { in_value.r, in_value.g, in_value.b, in_value.a };
+            return JoinValues(values, 4);
         }
         //---------------------------------------------------------
         //---------------------------------------------------------
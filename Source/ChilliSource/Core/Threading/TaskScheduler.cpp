@@ -72,16 +72,16 @@ namespace ChilliSource
         }
 		//------------------------------------------------
 		//------------------------------------------------
-		void TaskScheduler::ScheduleTask(const GenericTaskType& in_task)
+		void TaskScheduler::ScheduleTask(GenericTaskType in_task)
 		{
-			m_threadPool->Schedule(in_task);
+			m_threadPool->Schedule(std::move(in_task));
 		}
 		//----------------------------------------------------
 		//----------------------------------------------------
-		void TaskScheduler::ScheduleMainThreadTask(const GenericTaskType& in_task)
+		void TaskScheduler::ScheduleMainThreadTask(GenericTaskType in_task)
 		{
 			std::unique_lock<std::recursive_mutex> lock(m_mainThreadQueueMutex);
-			m_mainThreadTasks.push_back(in_task);
+			m_mainThreadTasks.push_back(std::move(in_task));
 		}
         //----------------------------------------------------
         //----------------------------------------------------
@@ -91,7 +91,10 @@ namespace ChilliSource
             
             for (u32 i = 0; i < m_mainThreadTasks.size(); ++i)
             {
-				m_mainThreadTasks[i]();
+                //The task is moved out first as it may schedule further tasks, which can
+                //reallocate the list while it is running.
+                GenericTaskType task(std::move(m_mainThreadTasks[i]));
+				task();
             }
             
 			m_mainThreadTasks.clear();
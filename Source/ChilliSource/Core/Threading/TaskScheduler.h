@@ -50,7 +50,7 @@ namespace ChilliSource
         
 			CS_DECLARE_NAMEDTYPE(TaskScheduler);
 
-            typedef std::function<void()> GenericTaskType;
+            typedef ThreadPool::GenericTaskType GenericTaskType;
 
 			//------------------------------------------------
 			/// @author S Downie
@@ -69,7 +69,7 @@ namespace ChilliSource
             ///
             /// @param Task
             //------------------------------------------------
-			void ScheduleTask(const GenericTaskType& in_task);
+			void ScheduleTask(GenericTaskType in_task);
             //----------------------------------------------------
             /// Schedule a task to be executed by the main
             /// thread
@@ -78,7 +78,7 @@ namespace ChilliSource
 			///
 			/// @param Task
             //----------------------------------------------------
-			void ScheduleMainThreadTask(const GenericTaskType& insTask);
+			void ScheduleMainThreadTask(GenericTaskType in_task);
             //----------------------------------------------------
             /// Execute any tasks that have been scehduled
             /// for the main thread
@@ -30,6 +30,10 @@
 
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 
+#ifdef CS_ENABLE_PROFILING
+#include <ChilliSource/Debugging/Base/Profiler.h>
+#endif
+
 namespace ChilliSource
 {
     namespace Core
@@ -47,7 +51,7 @@ namespace ChilliSource
         }
         //----------------------------------------------
         //----------------------------------------------
-        void ThreadPool::Schedule(const GenericTaskType& in_task)
+        void ThreadPool::Schedule(GenericTaskType in_task)
         {
             m_tasks.push(std::move(in_task));
         }
@@ -74,13 +78,16 @@ namespace ChilliSource
 			{
 				m_tasks.wait_for_push_or_destroy();
 
-				if (m_tasks.empty() == false)
+				GenericTaskType task;
+				if (m_tasks.try_pop(task) == true)
 				{
-					GenericTaskType task(std::move(m_tasks.front()));
-					m_tasks.pop();
 					task();
 				}
             }
+            
+#ifdef CS_ENABLE_PROFILING
+            Debugging::Profiler::ReleaseThread();
+#endif
         }
         //----------------------------------------------
         //----------------------------------------------
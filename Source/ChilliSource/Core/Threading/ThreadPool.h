@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Container/WorkerQueue.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
 
 #include <atomic>
 #include <thread>
@@ -44,7 +45,12 @@ namespace ChilliSource
         {
         public:
 
-            typedef std::function<void()> GenericTaskType;
+            //------------------------------------------------
+            /// Tasks are move only and stored inline where
+            /// they fit, so scheduling a typical task does not
+            /// allocate.
+            //------------------------------------------------
+            typedef UniqueDelegate<void(), 8 * sizeof(void*)> GenericTaskType;
             
             //------------------------------------------------
             /// Constructor
@@ -62,7 +68,7 @@ namespace ChilliSource
             ///
             /// @param Task to execute.
             //----------------------------------------------
-            void Schedule(const GenericTaskType& in_task);
+            void Schedule(GenericTaskType in_task);
             //----------------------------------------------
             /// @author Scott Downie
             ///
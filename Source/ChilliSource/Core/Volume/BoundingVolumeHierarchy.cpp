@@ -0,0 +1,518 @@
+//
+//  BoundingVolumeHierarchy.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Volume/BoundingVolumeHierarchy.h>
+
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const f32 k_boundsMargin = 0.1f;
+            const u32 k_initialStackSize = 64;
+            
+            //--------------------------------------------------------------
+            /// @param The first minimum.
+            /// @param The first maximum.
+            /// @param The second minimum.
+            /// @param The second maximum.
+            /// @param [Out] The minimum of the union.
+            /// @param [Out] The maximum of the union.
+            //--------------------------------------------------------------
+            void Union(const Vector3& in_minA, const Vector3& in_maxA, const Vector3& in_minB, const Vector3& in_maxB, Vector3& out_min, Vector3& out_max)
+            {
+                out_min = Vector3(std::min(in_minA.x, in_minB.x), std::min(in_minA.y, in_minB.y), std::min(in_minA.z, in_minB.z));
+                out_max = Vector3(std::max(in_maxA.x, in_maxB.x), std::max(in_maxA.y, in_maxB.y), std::max(in_maxA.z, in_maxB.z));
+            }
+            //--------------------------------------------------------------
+            /// @param The minimum.
+            /// @param The maximum.
+            ///
+            /// @return Half the surface area of the box. This is used as
+            /// the cost of a node when choosing where to insert a leaf.
+            //--------------------------------------------------------------
+            f32 CalculateCost(const Vector3& in_min, const Vector3& in_max)
+            {
+                Vector3 size = in_max - in_min;
+                return size.x * size.y + size.y * size.z + size.z * size.x;
+            }
+            //--------------------------------------------------------------
+            /// @param The outer minimum.
+            /// @param The outer maximum.
+            /// @param The inner minimum.
+            /// @param The inner maximum.
+            ///
+            /// @return Whether the outer box contains the inner box.
+            //--------------------------------------------------------------
+            bool Contains(const Vector3& in_outerMin, const Vector3& in_outerMax, const Vector3& in_innerMin, const Vector3& in_innerMax)
+            {
+                return in_outerMin.x <= in_innerMin.x && in_outerMin.y <= in_innerMin.y && in_outerMin.z <= in_innerMin.z &&
+                    in_outerMax.x >= in_innerMax.x && in_outerMax.y >= in_innerMax.y && in_outerMax.z >= in_innerMax.z;
+            }
+            //--------------------------------------------------------------
+            /// A slab test between a ray and a box. This matches the AABB
+            /// ray test, but is inclusive so that it is never stricter.
+            ///
+            /// @param The ray origin.
+            /// @param The ray direction.
+            /// @param The box minimum.
+            /// @param The box maximum.
+            ///
+            /// @return Whether the ray may hit the box.
+            //--------------------------------------------------------------
+            bool IntersectsRay(const Vector3& in_origin, const Vector3& in_direction, const Vector3& in_min, const Vector3& in_max)
+            {
+                f32 first = -std::numeric_limits<f32>::infinity();
+                f32 last = std::numeric_limits<f32>::infinity();
+                
+                const f32 origin[3] = { in_origin.x, in_origin.y, in_origin.z };
+                const f32 direction[3] = { in_direction.x, in_direction.y, in_direction.z };
+                const f32 minimum[3] = { in_min.x, in_min.y, in_min.z };
+                const f32 maximum[3] = { in_max.x, in_max.y, in_max.z };
+                
+                for (u32 axis = 0; axis < 3; ++axis)
+                {
+                    if (direction[axis] == 0.0f)
+                    {
+                        if (origin[axis] < minimum[axis] || origin[axis] > maximum[axis])
+                        {
+                            return false;
+                        }
+                        continue;
+                    }
+                    
+                    f32 entry = (minimum[axis] - origin[axis]) / direction[axis];
+                    f32 exit = (maximum[axis] - origin[axis]) / direction[axis];
+                    if (entry > exit)
+                    {
+                        std::swap(entry, exit);
+                    }
+                    
+                    first = std::max(first, entry);
+                    last = std::min(exit, last);
+                    if (first > last || last < 0.0f)
+                    {
+                        return false;
+                    }
+                }
+                
+                return true;
+            }
+            //--------------------------------------------------------------
+            /// @param The frustum.
+            /// @param The box minimum.
+            /// @param The box maximum.
+            ///
+            /// @return Whether the box is not entirely outside any of the
+            /// frustum planes.
+            //--------------------------------------------------------------
+            bool IntersectsFrustum(const Frustum& in_frustum, const Vector3& in_min, const Vector3& in_max)
+            {
+                const Plane* planes[6] = { &in_frustum.mLeftClipPlane, &in_frustum.mRightClipPlane, &in_frustum.mTopClipPlane,
+                    &in_frustum.mBottomClipPlane, &in_frustum.mNearClipPlane, &in_frustum.mFarClipPlane };
+                
+                for (const Plane* plane : planes)
+                {
+                    //test the corner furthest along the plane normal. If that is outside the whole box is.
+                    const Vector3& normal = plane->mvNormal;
+                    Vector3 corner(normal.x >= 0.0f ? in_max.x : in_min.x, normal.y >= 0.0f ? in_max.y : in_min.y, normal.z >= 0.0f ? in_max.z : in_min.z);
+                    if (plane->DistanceFromPoint(corner) < 0.0f)
+                    {
+                        return false;
+                    }
+                }
+                
+                return true;
+            }
+        }
+        
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 BoundingVolumeHierarchy::Add(VolumeComponent* in_volume, const AABB& in_bounds)
+        {
+            CS_ASSERT(in_volume != nullptr, "Cannot add a null volume to a bounding volume hierarchy.");
+            
+            s32 leaf = AllocateNode();
+            
+            Vector3 margin = in_bounds.GetSize() * k_boundsMargin;
+            m_nodes[leaf].m_bounds.m_min = in_bounds.GetMin() - margin;
+            m_nodes[leaf].m_bounds.m_max = in_bounds.GetMax() + margin;
+            m_nodes[leaf].m_volume = in_volume;
+            m_nodes[leaf].m_height = 0;
+            
+            InsertLeaf(leaf);
+            ++m_numVolumes;
+            
+            return leaf;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool BoundingVolumeHierarchy::Update(s32 in_proxyId, const AABB& in_bounds)
+        {
+            CS_ASSERT(in_proxyId >= 0 && in_proxyId < s32(m_nodes.size()) && m_nodes[in_proxyId].m_volume != nullptr, "Invalid bounding volume hierarchy proxy.");
+            
+            if (Contains(m_nodes[in_proxyId].m_bounds.m_min, m_nodes[in_proxyId].m_bounds.m_max, in_bounds.GetMin(), in_bounds.GetMax()) == true)
+            {
+                return false;
+            }
+            
+            RemoveLeaf(in_proxyId);
+            
+            Vector3 margin = in_bounds.GetSize() * k_boundsMargin;
+            m_nodes[in_proxyId].m_bounds.m_min = in_bounds.GetMin() - margin;
+            m_nodes[in_proxyId].m_bounds.m_max = in_bounds.GetMax() + margin;
+            
+            InsertLeaf(in_proxyId);
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BoundingVolumeHierarchy::Remove(s32 in_proxyId)
+        {
+            CS_ASSERT(in_proxyId >= 0 && in_proxyId < s32(m_nodes.size()) && m_nodes[in_proxyId].m_volume != nullptr, "Invalid bounding volume hierarchy proxy.");
+            
+            RemoveLeaf(in_proxyId);
+            FreeNode(in_proxyId);
+            --m_numVolumes;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 BoundingVolumeHierarchy::GetNumVolumes() const
+        {
+            return m_numVolumes;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 BoundingVolumeHierarchy::GetHeight() const
+        {
+            return (m_root != k_nullProxy) ? m_nodes[m_root].m_height : 0;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BoundingVolumeHierarchy::QueryRay(const Ray& in_ray, std::vector<VolumeComponent*>& out_volumes) const
+        {
+            Vector3 direction = in_ray.vDirection * in_ray.fLength;
+            Query([&](const Bounds& in_bounds)
+            {
+                return IntersectsRay(in_ray.vOrigin, direction, in_bounds.m_min, in_bounds.m_max);
+            }, out_volumes);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BoundingVolumeHierarchy::QueryFrustum(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumes) const
+        {
+            Query([&](const Bounds& in_bounds)
+            {
+                return IntersectsFrustum(in_frustum, in_bounds.m_min, in_bounds.m_max);
+            }, out_volumes);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BoundingVolumeHierarchy::QuerySphere(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumes) const
+        {
+            //the sphere tests treat spheres as boxes on each axis, so the box around the sphere is used here too.
+            Vector3 radius(in_sphere.fRadius, in_sphere.fRadius, in_sphere.fRadius);
+            Vector3 sphereMin = in_sphere.vOrigin - radius;
+            Vector3 sphereMax = in_sphere.vOrigin + radius;
+            Query([&](const Bounds& in_bounds)
+            {
+                return in_bounds.m_min.x <= sphereMax.x && in_bounds.m_max.x >= sphereMin.x &&
+                    in_bounds.m_min.y <= sphereMax.y && in_bounds.m_max.y >= sphereMin.y &&
+                    in_bounds.m_min.z <= sphereMax.z && in_bounds.m_max.z >= sphereMin.z;
+            }, out_volumes);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        template <typename TBoundsTest> void BoundingVolumeHierarchy::Query(const TBoundsTest& in_test, std::vector<VolumeComponent*>& out_volumes) const
+        {
+            if (m_root == k_nullProxy)
+            {
+                return;
+            }
+            
+            std::vector<s32> stack;
+            stack.reserve(k_initialStackSize);
+            stack.push_back(m_root);
+            
+            while (stack.empty() == false)
+            {
+                const Node& node = m_nodes[stack.back()];
+                stack.pop_back();
+                
+                if (in_test(node.m_bounds) == false)
+                {
+                    continue;
+                }
+                
+                if (node.m_volume != nullptr)
+                {
+                    out_volumes.push_back(node.m_volume);
+                }
+                else
+                {
+                    stack.push_back(node.m_left);
+                    stack.push_back(node.m_right);
+                }
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 BoundingVolumeHierarchy::AllocateNode()
+        {
+            if (m_freeList == k_nullProxy)
+            {
+                m_nodes.push_back(Node());
+                return s32(m_nodes.size()) - 1;
+            }
+            
+            s32 node = m_freeList;
+            m_freeList = m_nodes[node].m_parent;
+            m_nodes[node] = Node();
+            return node;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BoundingVolumeHierarchy::FreeNode(s32 in_node)
+        {
+            m_nodes[in_node] = Node();
+            m_nodes[in_node].m_parent = m_freeList;
+            m_freeList = in_node;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BoundingVolumeHierarchy::InsertLeaf(s32 in_leaf)
+        {
+            if (m_root == k_nullProxy)
+            {
+                m_root = in_leaf;
+                m_nodes[in_leaf].m_parent = k_nullProxy;
+                return;
+            }
+            
+            const Bounds leafBounds = m_nodes[in_leaf].m_bounds;
+            
+            //descend towards the sibling which gives the cheapest tree, stopping early if creating a new parent here is cheapest.
+            s32 sibling = m_root;
+            while (m_nodes[sibling].m_volume == nullptr)
+            {
+                const Node& node = m_nodes[sibling];
+                
+                Vector3 combinedMin, combinedMax;
+                Union(node.m_bounds.m_min, node.m_bounds.m_max, leafBounds.m_min, leafBounds.m_max, combinedMin, combinedMax);
+                f32 combinedCost = CalculateCost(combinedMin, combinedMax);
+                
+                f32 cost = 2.0f * combinedCost;
+                f32 inheritanceCost = 2.0f * (combinedCost - CalculateCost(node.m_bounds.m_min, node.m_bounds.m_max));
+                
+                f32 childCosts[2];
+                const s32 children[2] = { node.m_left, node.m_right };
+                for (u32 i = 0; i < 2; ++i)
+                {
+                    const Node& child = m_nodes[children[i]];
+                    Vector3 childMin, childMax;
+                    Union(child.m_bounds.m_min, child.m_bounds.m_max, leafBounds.m_min, leafBounds.m_max, childMin, childMax);
+                    
+                    childCosts[i] = CalculateCost(childMin, childMax) + inheritanceCost;
+                    if (child.m_volume == nullptr)
+                    {
+                        childCosts[i] -= CalculateCost(child.m_bounds.m_min, child.m_bounds.m_max);
+                    }
+                }
+                
+                if (cost < childCosts[0] && cost < childCosts[1])
+                {
+                    break;
+                }
+                
+                sibling = (childCosts[0] < childCosts[1]) ? node.m_left : node.m_right;
+            }
+            
+            //create a new parent for the sibling and the leaf
+            s32 oldParent = m_nodes[sibling].m_parent;
+            s32 newParent = AllocateNode();
+            m_nodes[newParent].m_parent = oldParent;
+            m_nodes[newParent].m_height = m_nodes[sibling].m_height + 1;
+            m_nodes[newParent].m_left = sibling;
+            m_nodes[newParent].m_right = in_leaf;
+            Union(m_nodes[sibling].m_bounds.m_min, m_nodes[sibling].m_bounds.m_max, leafBounds.m_min, leafBounds.m_max, m_nodes[newParent].m_bounds.m_min, m_nodes[newParent].m_bounds.m_max);
+            m_nodes[sibling].m_parent = newParent;
+            m_nodes[in_leaf].m_parent = newParent;
+            
+            if (oldParent == k_nullProxy)
+            {
+                m_root = newParent;
+            }
+            else if (m_nodes[oldParent].m_left == sibling)
+            {
+                m_nodes[oldParent].m_left = newParent;
+            }
+            else
+            {
+                m_nodes[oldParent].m_right = newParent;
+            }
+            
+            RefitAncestors(m_nodes[in_leaf].m_parent);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BoundingVolumeHierarchy::RemoveLeaf(s32 in_leaf)
+        {
+            if (in_leaf == m_root)
+            {
+                m_root = k_nullProxy;
+                return;
+            }
+            
+            s32 parent = m_nodes[in_leaf].m_parent;
+            s32 grandParent = m_nodes[parent].m_parent;
+            s32 sibling = (m_nodes[parent].m_left == in_leaf) ? m_nodes[parent].m_right : m_nodes[parent].m_left;
+            
+            m_nodes[in_leaf].m_parent = k_nullProxy;
+            m_nodes[sibling].m_parent = grandParent;
+            FreeNode(parent);
+            
+            if (grandParent == k_nullProxy)
+            {
+                m_root = sibling;
+                return;
+            }
+            
+            if (m_nodes[grandParent].m_left == parent)
+            {
+                m_nodes[grandParent].m_left = sibling;
+            }
+            else
+            {
+                m_nodes[grandParent].m_right = sibling;
+            }
+            
+            RefitAncestors(grandParent);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void BoundingVolumeHierarchy::RefitAncestors(s32 in_node)
+        {
+            s32 index = in_node;
+            while (index != k_nullProxy)
+            {
+                index = Balance(index);
+                
+                Node& node = m_nodes[index];
+                const Node& left = m_nodes[node.m_left];
+                const Node& right = m_nodes[node.m_right];
+                node.m_height = 1 + std::max(left.m_height, right.m_height);
+                Union(left.m_bounds.m_min, left.m_bounds.m_max, right.m_bounds.m_min, right.m_bounds.m_max, node.m_bounds.m_min, node.m_bounds.m_max);
+                
+                index = node.m_parent;
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        s32 BoundingVolumeHierarchy::Balance(s32 in_node)
+        {
+            Node& a = m_nodes[in_node];
+            if (a.m_volume != nullptr || a.m_height < 2)
+            {
+                return in_node;
+            }
+            
+            s32 indexB = a.m_left;
+            s32 indexC = a.m_right;
+            Node& b = m_nodes[indexB];
+            Node& c = m_nodes[indexC];
+            s32 balance = c.m_height - b.m_height;
+            
+            //rotate the taller child up to replace this node. Of the taller child's children, the taller stays with it and the
+            //shorter moves across to this node.
+            if (balance > 1 || balance < -1)
+            {
+                s32 indexUp = (balance > 1) ? indexC : indexB;
+                s32 indexStay = (balance > 1) ? indexB : indexC;
+                Node& up = m_nodes[indexUp];
+                Node& stay = m_nodes[indexStay];
+                
+                s32 indexF = up.m_left;
+                s32 indexG = up.m_right;
+                Node& f = m_nodes[indexF];
+                Node& g = m_nodes[indexG];
+                
+                up.m_left = in_node;
+                up.m_parent = a.m_parent;
+                a.m_parent = indexUp;
+                
+                if (up.m_parent == k_nullProxy)
+                {
+                    m_root = indexUp;
+                }
+                else if (m_nodes[up.m_parent].m_left == in_node)
+                {
+                    m_nodes[up.m_parent].m_left = indexUp;
+                }
+                else
+                {
+                    m_nodes[up.m_parent].m_right = indexUp;
+                }
+                
+                s32 indexTaller = (f.m_height > g.m_height) ? indexF : indexG;
+                s32 indexShorter = (f.m_height > g.m_height) ? indexG : indexF;
+                Node& taller = m_nodes[indexTaller];
+                Node& shorter = m_nodes[indexShorter];
+                
+                up.m_right = indexTaller;
+                if (balance > 1)
+                {
+                    a.m_right = indexShorter;
+                }
+                else
+                {
+                    a.m_left = indexShorter;
+                }
+                shorter.m_parent = in_node;
+                
+                Union(stay.m_bounds.m_min, stay.m_bounds.m_max, shorter.m_bounds.m_min, shorter.m_bounds.m_max, a.m_bounds.m_min, a.m_bounds.m_max);
+                Union(a.m_bounds.m_min, a.m_bounds.m_max, taller.m_bounds.m_min, taller.m_bounds.m_max, up.m_bounds.m_min, up.m_bounds.m_max);
+                a.m_height = 1 + std::max(stay.m_height, shorter.m_height);
+                up.m_height = 1 + std::max(a.m_height, taller.m_height);
+                
+                return indexUp;
+            }
+            
+            return in_node;
+        }
+    }
+}
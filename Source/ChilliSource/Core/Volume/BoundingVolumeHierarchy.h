@@ -0,0 +1,211 @@
+//
+//  BoundingVolumeHierarchy.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_VOLUME_BOUNDINGVOLUMEHIERARCHY_H_
+#define _CHILLISOURCE_CORE_VOLUME_BOUNDINGVOLUMEHIERARCHY_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //--------------------------------------------------------------
+        /// A dynamic bounding volume hierarchy of volume components. This
+        /// is a binary tree of axis aligned bounding boxes which allows
+        /// ray, frustum and sphere queries to skip whole regions of the
+        /// scene rather than testing every volume.
+        ///
+        /// Volumes are inserted and removed incrementally and the tree is
+        /// kept balanced with tree rotations. Leaf boxes are enlarged
+        /// slightly so that small movements can be handled without
+        /// changing the tree at all.
+        ///
+        /// Queries are conservative: they return every volume whose
+        /// bounds may intersect the query shape. Callers should perform
+        /// any exact tests on the results.
+        ///
+        /// This is not thread safe.
+        //--------------------------------------------------------------
+        class BoundingVolumeHierarchy final
+        {
+        public:
+            CS_DECLARE_NOCOPY(BoundingVolumeHierarchy);
+            
+            static const s32 k_nullProxy = -1;
+            //--------------------------------------------------------------
+            /// Constructor
+            //--------------------------------------------------------------
+            BoundingVolumeHierarchy();
+            //--------------------------------------------------------------
+            /// Adds a volume to the hierarchy.
+            ///
+            /// @param The volume component.
+            /// @param The world space bounds of the volume.
+            ///
+            /// @return The proxy id, used to update or remove the volume.
+            //--------------------------------------------------------------
+            s32 Add(VolumeComponent* in_volume, const AABB& in_bounds);
+            //--------------------------------------------------------------
+            /// Updates the bounds of a volume in the hierarchy. If the new
+            /// bounds still lie within the enlarged leaf bounds, nothing
+            /// changes. Otherwise the volume is reinserted.
+            ///
+            /// @param The proxy id.
+            /// @param The new world space bounds of the volume.
+            ///
+            /// @return Whether or not the volume was reinserted.
+            //--------------------------------------------------------------
+            bool Update(s32 in_proxyId, const AABB& in_bounds);
+            //--------------------------------------------------------------
+            /// Removes a volume from the hierarchy.
+            ///
+            /// @param The proxy id.
+            //--------------------------------------------------------------
+            void Remove(s32 in_proxyId);
+            //--------------------------------------------------------------
+            /// @return The number of volumes in the hierarchy.
+            //--------------------------------------------------------------
+            u32 GetNumVolumes() const;
+            //--------------------------------------------------------------
+            /// @return The height of the tree. This is zero if the tree is
+            /// empty or has a single volume.
+            //--------------------------------------------------------------
+            s32 GetHeight() const;
+            //--------------------------------------------------------------
+            /// Finds the volumes whose bounds may be hit by the given ray.
+            /// Like the AABB and OOBB ray tests, the ray length is not
+            /// considered.
+            ///
+            /// @param The ray.
+            /// @param [Out] The list to append the volumes to.
+            //--------------------------------------------------------------
+            void QueryRay(const Ray& in_ray, std::vector<VolumeComponent*>& out_volumes) const;
+            //--------------------------------------------------------------
+            /// Finds the volumes whose bounds may lie within the given
+            /// frustum.
+            ///
+            /// @param The frustum.
+            /// @param [Out] The list to append the volumes to.
+            //--------------------------------------------------------------
+            void QueryFrustum(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumes) const;
+            //--------------------------------------------------------------
+            /// Finds the volumes whose bounds may intersect the given
+            /// sphere.
+            ///
+            /// @param The sphere.
+            /// @param [Out] The list to append the volumes to.
+            //--------------------------------------------------------------
+            void QuerySphere(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumes) const;
+            
+        private:
+            //--------------------------------------------------------------
+            /// A minimal axis aligned box. Shapes::AABB also caches its
+            /// origin, size and half size, which the tree does not need.
+            //--------------------------------------------------------------
+            struct Bounds
+            {
+                Vector3 m_min;
+                Vector3 m_max;
+            };
+            //--------------------------------------------------------------
+            /// A node in the tree. Leaf nodes hold a volume; branch nodes
+            /// always have two children. Nodes in the free list use the
+            /// parent index as the next free node.
+            //--------------------------------------------------------------
+            struct Node
+            {
+                Bounds m_bounds;
+                VolumeComponent* m_volume = nullptr;
+                s32 m_parent = k_nullProxy;
+                s32 m_left = k_nullProxy;
+                s32 m_right = k_nullProxy;
+                s32 m_height = -1;
+            };
+            //--------------------------------------------------------------
+            /// @return The index of an unused node.
+            //--------------------------------------------------------------
+            s32 AllocateNode();
+            //--------------------------------------------------------------
+            /// Returns the node to the free list.
+            ///
+            /// @param The node index.
+            //--------------------------------------------------------------
+            void FreeNode(s32 in_node);
+            //--------------------------------------------------------------
+            /// Inserts the leaf next to the sibling that results in the
+            /// smallest increase in surface area, then walks back up the
+            /// tree refitting and balancing.
+            ///
+            /// @param The leaf node index.
+            //--------------------------------------------------------------
+            void InsertLeaf(s32 in_leaf);
+            //--------------------------------------------------------------
+            /// Removes the leaf from the tree, replacing its parent with
+            /// its sibling. The leaf node itself is not freed.
+            ///
+            /// @param The leaf node index.
+            //--------------------------------------------------------------
+            void RemoveLeaf(s32 in_leaf);
+            //--------------------------------------------------------------
+            /// Walks from the given node to the root, balancing each node
+            /// and refitting its bounds and height.
+            ///
+            /// @param The first node to refit.
+            //--------------------------------------------------------------
+            void RefitAncestors(s32 in_node);
+            //--------------------------------------------------------------
+            /// Performs a single tree rotation if the node's children
+            /// differ in height by more than one.
+            ///
+            /// @param The node index.
+            ///
+            /// @return The index of the node now at this position.
+            //--------------------------------------------------------------
+            s32 Balance(s32 in_node);
+            //--------------------------------------------------------------
+            /// Traverses the tree, descending into each node whose bounds
+            /// pass the given test, and appends the volume of every leaf
+            /// that passes.
+            ///
+            /// @param The bounds test.
+            /// @param [Out] The list to append the volumes to.
+            //--------------------------------------------------------------
+            template <typename TBoundsTest> void Query(const TBoundsTest& in_test, std::vector<VolumeComponent*>& out_volumes) const;
+            
+            std::vector<Node> m_nodes;
+            s32 m_root = k_nullProxy;
+            s32 m_freeList = k_nullProxy;
+            u32 m_numVolumes = 0;
+        };
+    }
+}
+
+#endif
@@ -28,10 +28,22 @@
 
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Scene/Scene.h>
+
 namespace ChilliSource
 {
     namespace Core
     {
         CS_DEFINE_NAMEDTYPE(VolumeComponent);
+        //----------------------------------------------------
+        //----------------------------------------------------
+        void VolumeComponent::OnVolumeChanged()
+        {
+            if (GetEntity() != nullptr && GetEntity()->GetScene() != nullptr)
+            {
+                GetEntity()->GetScene()->InvalidateVolume(this);
+            }
+        }
     }
 }
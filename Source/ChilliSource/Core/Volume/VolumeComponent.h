@@ -86,6 +86,17 @@ namespace ChilliSource
 
         public:
             f32 mfQueryIntersectionValue;
+            
+        protected:
+            //----------------------------------------------------
+            /// Notifies the scene that the bounds of this volume
+            /// have changed so that they are refitted in the scene's
+            /// bounding volume hierarchy. Changes to the entity
+            /// transform are tracked automatically; this should be
+            /// called when the bounds change for any other reason,
+            /// for example when a new mesh is attached.
+            //----------------------------------------------------
+            void OnVolumeChanged();
         };
     }
 }
@@ -33,5 +33,6 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Debugging/Base/DebugStats.h>
 #include <ChilliSource/Debugging/Base/DebugStatsView.h>
+#include <ChilliSource/Debugging/Base/Profiler.h>
 
 #endif
@@ -34,6 +34,10 @@
 #include <ChilliSource/Debugging/Base/DebugStatsView.h>
 #include <ChilliSource/GUI/Base/Window.h>
 
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
 namespace ChilliSource
 {
     namespace Debugging
@@ -41,6 +45,9 @@ namespace ChilliSource
         namespace
         {
             const TimeIntervalMs k_msBetweenRefreshes = 100;
+            
+            std::mutex g_counterNamesMutex;
+            std::vector<std::string> g_counterNames;
         }
         
         CS_DEFINE_NAMEDTYPE(DebugStats);
@@ -55,6 +62,10 @@ namespace ChilliSource
         DebugStats::DebugStats()
             : m_enabled(true), m_lastRefresh(0)
         {
+            for (auto& counter : m_counters)
+            {
+                counter.store(0, std::memory_order_relaxed);
+            }
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
@@ -136,9 +147,68 @@ namespace ChilliSource
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
+        DebugStats::CounterHandle DebugStats::RegisterCounter(const std::string& in_name)
+        {
+            std::unique_lock<std::mutex> lock(g_counterNamesMutex);
+            
+            auto it = std::find(g_counterNames.begin(), g_counterNames.end(), in_name);
+            if(it != g_counterNames.end())
+            {
+                return (CounterHandle)(it - g_counterNames.begin());
+            }
+            
+            if(g_counterNames.size() >= k_maxCounters)
+            {
+                CS_LOG_ERROR("Cannot register debug stats counter '" + in_name + "' as the maximum number of counters has been reached.");
+                return k_invalidCounterHandle;
+            }
+            
+            g_counterNames.push_back(in_name);
+            return (CounterHandle)(g_counterNames.size() - 1);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        DebugStats::CounterStats DebugStats::GetCounterStats(CounterHandle in_handle) const
+        {
+            CounterStats stats;
+            if(in_handle >= k_maxCounters)
+            {
+                return stats;
+            }
+            
+            const CounterHistory& history = m_counterHistories[in_handle];
+            if(history.m_numValues == 0)
+            {
+                return stats;
+            }
+            
+            stats.m_lastFrame = history.m_values[(history.m_nextValue + k_counterHistoryLength - 1) % k_counterHistoryLength];
+            stats.m_min = std::numeric_limits<u32>::max();
+            
+            u64 total = 0;
+            for(u32 i = 0; i < history.m_numValues; ++i)
+            {
+                const u32 value = history.m_values[i];
+                stats.m_min = std::min(stats.m_min, value);
+                stats.m_max = std::max(stats.m_max, value);
+                total += value;
+            }
+            stats.m_average = (f32)((f64)total / history.m_numValues);
+            
+            return stats;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
         void DebugStats::Clear()
         {
             m_events.clear();
+            
+            for(u32 i = 0; i < k_maxCounters; ++i)
+            {
+                m_counters[i].store(0, std::memory_order_relaxed);
+                m_counterHistories[i].m_numValues = 0;
+                m_counterHistories[i].m_nextValue = 0;
+            }
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
@@ -151,7 +221,22 @@ namespace ChilliSource
                 if (timeSince > k_msBetweenRefreshes)
                 {
                     m_lastRefresh = timeNow;
-                    m_view->Refresh(m_events);
+                    
+                    //Counters are only displayed once they have been used
+                    m_displayedStats = m_events;
+                    {
+                        std::unique_lock<std::mutex> lock(g_counterNamesMutex);
+                        for(u32 i = 0; i < g_counterNames.size(); ++i)
+                        {
+                            CounterStats stats = GetCounterStats(i);
+                            if(stats.m_max > 0)
+                            {
+                                m_displayedStats[g_counterNames[i]] = Core::ToString(stats.m_lastFrame);
+                            }
+                        }
+                    }
+                    
+                    m_view->Refresh(m_displayedStats);
                 }
                 
                 m_view->SetParentView(in_window);
@@ -171,6 +256,23 @@ namespace ChilliSource
         {
             m_view.reset();
         }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        void DebugStats::EndFrame()
+        {
+            for(u32 i = 0; i < k_maxCounters; ++i)
+            {
+                CounterHistory& history = m_counterHistories[i];
+                history.m_values[history.m_nextValue] = m_counters[i].exchange(0, std::memory_order_relaxed);
+                history.m_nextValue = (history.m_nextValue + 1) % k_counterHistoryLength;
+                if(history.m_numValues < k_counterHistoryLength)
+                {
+                    history.m_numValues++;
+                }
+            }
+            
+            m_events.clear();
+        }
     }
 }
 
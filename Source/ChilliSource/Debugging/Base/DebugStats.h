@@ -34,6 +34,8 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 
+#include <array>
+#include <atomic>
 #include <unordered_map>
 
 namespace ChilliSource
@@ -44,6 +46,13 @@ namespace ChilliSource
         /// An application system used for displaying debug statistics in a
         /// pane over the game as it is running.
         ///
+        /// Stats which are updated many times a frame, such as draw
+        /// calls, should use counters rather than events. A counter is
+        /// registered once by name, and can then be incremented from any
+        /// thread without any string hashing or conversion. At the end
+        /// of each frame the counter values are stored in a short
+        /// history, from which the min, average and max are calculated.
+        ///
         /// @author S Downie
         //---------------------------------------------------------------------
         class DebugStats final : public Core::AppSystem
@@ -51,6 +60,20 @@ namespace ChilliSource
         public:
             CS_DECLARE_NAMEDTYPE(DebugStats);
             
+            using CounterHandle = u32;
+            
+            static const CounterHandle k_invalidCounterHandle = 0xffffffff;
+            //------------------------------------------------------------
+            /// The values of a counter over the recent frame history.
+            //------------------------------------------------------------
+            struct CounterStats
+            {
+                u32 m_lastFrame = 0;
+                u32 m_min = 0;
+                u32 m_max = 0;
+                f32 m_average = 0.0f;
+            };
+            
             //------------------------------------------------------------
             /// Allows querying of whether or not this system implements
             /// a given interface.
@@ -118,6 +141,37 @@ namespace ChilliSource
             //------------------------------------------------------------
             void AddToEvent(const std::string& in_eventName, f32 in_value);
             //------------------------------------------------------------
+            /// Registers a counter with the given name, returning the
+            /// handle used to increment it. Registering the same name
+            /// again returns the same handle. Handles remain valid for
+            /// the lifetime of the application so are typically stored
+            /// in a function local static. This is thread-safe.
+            ///
+            /// If the maximum number of counters has been reached an
+            /// error is logged and k_invalidCounterHandle is returned.
+            /// Incrementing the invalid handle does nothing.
+            ///
+            /// @param The name of the counter.
+            ///
+            /// @return The counter handle.
+            //------------------------------------------------------------
+            static CounterHandle RegisterCounter(const std::string& in_name);
+            //------------------------------------------------------------
+            /// Adds the given value to the counter for the current frame.
+            /// This is thread-safe.
+            ///
+            /// @param The counter handle.
+            /// @param The value to add.
+            //------------------------------------------------------------
+            void IncrementCounter(CounterHandle in_handle, u32 in_value = 1);
+            //------------------------------------------------------------
+            /// @param The counter handle.
+            ///
+            /// @return The values of the counter over the recent frame
+            /// history.
+            //------------------------------------------------------------
+            CounterStats GetCounterStats(CounterHandle in_handle) const;
+            //------------------------------------------------------------
             /// Draws the current stored stats to the screen.
             ///
             /// @author Ian Copland
@@ -127,13 +181,26 @@ namespace ChilliSource
             //------------------------------------------------------------
             void DrawStats(Rendering::CanvasRenderer* in_canvas, GUI::Window* in_window);
             //------------------------------------------------------------
-            /// Clear all the previously recorded stats.
+            /// Clear all the previously recorded stats, including the
+            /// counter history.
             ///
             /// @author S Downie
             //------------------------------------------------------------
             void Clear();
         private:
             friend class Core::Application;
+            
+            static const u32 k_maxCounters = 64;
+            static const u32 k_counterHistoryLength = 60;
+            //------------------------------------------------------------
+            /// The per-frame values of a single counter.
+            //------------------------------------------------------------
+            struct CounterHistory
+            {
+                std::array<u32, k_counterHistoryLength> m_values;
+                u32 m_numValues = 0;
+                u32 m_nextValue = 0;
+            };
 			//------------------------------------------------------------
 			/// Factory create method called by application to create a new
             /// instance of the system.
@@ -166,8 +233,17 @@ namespace ChilliSource
             /// @author Ian Copland
             //------------------------------------------------------------
             void OnDestroy() override;
+            //------------------------------------------------------------
+            /// Called by the application at the end of each frame. This
+            /// stores the counter values in the history, resets them and
+            /// clears the events.
+            //------------------------------------------------------------
+            void EndFrame();
 
             std::unordered_map<std::string, std::string> m_events;
+            std::unordered_map<std::string, std::string> m_displayedStats;
+            std::array<std::atomic<u32>, k_maxCounters> m_counters;
+            std::array<CounterHistory, k_maxCounters> m_counterHistories;
             bool m_enabled;
             DebugStatsViewSPtr m_view;
             TimeIntervalMs m_lastRefresh;
@@ -181,6 +257,15 @@ namespace ChilliSource
                 m_events[in_eventName] = Core::ToString(in_value);
             }
         }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        inline void DebugStats::IncrementCounter(CounterHandle in_handle, u32 in_value)
+        {
+            if(m_enabled == true && in_handle < k_maxCounters)
+            {
+                m_counters[in_handle].fetch_add(in_value, std::memory_order_relaxed);
+            }
+        }
     }
 }
 
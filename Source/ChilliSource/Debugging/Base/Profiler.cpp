@@ -0,0 +1,436 @@
+//
+//  Profiler.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+
+
+#ifdef CS_ENABLE_PROFILING
+
+#include <ChilliSource/Debugging/Base/Profiler.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#ifdef CS_ENABLE_DEBUGSTATS
+#include <ChilliSource/Debugging/Base/DebugStats.h>
+#endif
+
+namespace ChilliSource
+{
+    namespace Debugging
+    {
+        namespace
+        {
+            const u32 k_maxThreads = 32;
+            const u32 k_zonesPerThread = 2048;
+            const u32 k_zoneIndexMask = k_zonesPerThread - 1;
+            const u32 k_maxCapturedZones = 1000000;
+            const u64 k_freeThreadKey = 0;
+            const u64 k_releasedThreadKey = 0xffffffffffffffffull;
+            
+            static_assert((k_zonesPerThread & k_zoneIndexMask) == 0, "The number of zones per thread must be a power of two.");
+            
+            //--------------------------------------------------------------
+            /// A single completed zone.
+            //--------------------------------------------------------------
+            struct RecordedZone
+            {
+                u32 m_zoneId;
+                u32 m_depth;
+                s64 m_startMicroS;
+                s64 m_endMicroS;
+            };
+            //--------------------------------------------------------------
+            /// A single producer, single consumer ring buffer of zones
+            /// recorded by one thread. Only the owning thread writes
+            /// zones and only the main thread reads them.
+            //--------------------------------------------------------------
+            struct ThreadBuffer
+            {
+                std::atomic<u32> m_writeIndex;
+                std::atomic<u32> m_readIndex;
+                std::atomic<u32> m_numDropped;
+                u32 m_depth = 0;
+                RecordedZone m_zones[k_zonesPerThread];
+                
+                ThreadBuffer()
+                    : m_writeIndex(0), m_readIndex(0), m_numDropped(0)
+                {
+                }
+            };
+            //--------------------------------------------------------------
+            /// A slot for a single thread. The key is claimed by the thread,
+            /// after which it is the only one to write the buffer pointer
+            /// until it marks the slot as released. The main thread then
+            /// frees the buffer and the slot can be claimed again.
+            //--------------------------------------------------------------
+            struct ThreadSlot
+            {
+                std::atomic<u64> m_threadKey;
+                std::atomic<ThreadBuffer*> m_buffer;
+            };
+            
+            ThreadSlot g_threadSlots[k_maxThreads] = {};
+            std::mutex g_zoneNamesMutex;
+            std::vector<const s8*> g_zoneNames;
+            const std::chrono::steady_clock::time_point g_startTime = std::chrono::steady_clock::now();
+            
+            //--------------------------------------------------------------
+            /// @return The time since the profiler started in microseconds.
+            //--------------------------------------------------------------
+            s64 GetTimeMicroS()
+            {
+                return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - g_startTime).count();
+            }
+            //--------------------------------------------------------------
+            /// @return The key identifying the calling thread in the slot
+            /// table. This is never one of the reserved keys.
+            //--------------------------------------------------------------
+            u64 GetThreadKey()
+            {
+                u64 threadKey = std::hash<std::thread::id>()(std::this_thread::get_id());
+                return (threadKey == k_freeThreadKey || threadKey == k_releasedThreadKey) ? 1 : threadKey;
+            }
+            //--------------------------------------------------------------
+            /// @param The thread key.
+            ///
+            /// @return The slot claimed by the thread with the given key, or
+            /// null if it doesn't have one. Released slots can be claimed
+            /// again while other threads still hold slots further along,
+            /// so every slot is checked rather than stopping at the first
+            /// free one.
+            //--------------------------------------------------------------
+            ThreadSlot* FindThreadSlot(u64 in_threadKey)
+            {
+                for (u32 i = 0; i < k_maxThreads; ++i)
+                {
+                    ThreadSlot& slot = g_threadSlots[(in_threadKey + i) % k_maxThreads];
+                    if (slot.m_threadKey.load(std::memory_order_acquire) == in_threadKey)
+                    {
+                        return &slot;
+                    }
+                }
+                
+                return nullptr;
+            }
+            //--------------------------------------------------------------
+            /// Finds the buffer for the calling thread, claiming a new slot
+            /// if this is the first zone recorded on the thread. This is
+            /// lock-free.
+            ///
+            /// @return The buffer or null if all slots are in use.
+            //--------------------------------------------------------------
+            ThreadBuffer* GetThreadBuffer()
+            {
+                const u64 threadKey = GetThreadKey();
+                
+                ThreadSlot* existingSlot = FindThreadSlot(threadKey);
+                if (existingSlot != nullptr)
+                {
+                    return existingSlot->m_buffer.load(std::memory_order_acquire);
+                }
+                
+                for (u32 i = 0; i < k_maxThreads; ++i)
+                {
+                    ThreadSlot& slot = g_threadSlots[(threadKey + i) % k_maxThreads];
+                    u64 slotKey = k_freeThreadKey;
+                    if (slot.m_threadKey.compare_exchange_strong(slotKey, threadKey, std::memory_order_acq_rel) == true)
+                    {
+                        ThreadBuffer* buffer = new ThreadBuffer();
+                        slot.m_buffer.store(buffer, std::memory_order_release);
+                        return buffer;
+                    }
+                }
+                
+                return nullptr;
+            }
+            //--------------------------------------------------------------
+            /// Writes the string to the JSON output, escaping it as needed.
+            ///
+            /// @param The string.
+            /// @param [Out] The output.
+            //--------------------------------------------------------------
+            void AppendJSONString(const s8* in_string, std::string& out_json)
+            {
+                out_json += '"';
+                for (const s8* character = in_string; *character != '\0'; ++character)
+                {
+                    if (*character == '"' || *character == '\\')
+                    {
+                        out_json += '\\';
+                    }
+                    out_json += *character;
+                }
+                out_json += '"';
+            }
+        }
+        
+        CS_DEFINE_NAMEDTYPE(Profiler);
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        ProfilerUPtr Profiler::Create()
+        {
+            return ProfilerUPtr(new Profiler());
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        Profiler::Profiler()
+            : m_isCapturing(false), m_lastFrameEndMicroS(GetTimeMicroS()), m_lastFrameTimeMS(0.0)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool Profiler::IsA(Core::InterfaceIDType in_interfaceId) const
+        {
+            return (Profiler::InterfaceID == in_interfaceId);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 Profiler::RegisterZone(const s8* in_name)
+        {
+            std::unique_lock<std::mutex> lock(g_zoneNamesMutex);
+            g_zoneNames.push_back(in_name);
+            return (u32)g_zoneNames.size() - 1;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Profiler::ReleaseThread()
+        {
+            ThreadSlot* slot = FindThreadSlot(GetThreadKey());
+            if (slot != nullptr)
+            {
+                slot->m_threadKey.store(k_releasedThreadKey, std::memory_order_release);
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        f64 Profiler::GetLastFrameTimeMS() const
+        {
+            return m_lastFrameTimeMS;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        const std::vector<Profiler::ZoneStats>& Profiler::GetLastFrameStats() const
+        {
+            return m_frameStats;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Profiler::StartCapture()
+        {
+            m_capturedZones.clear();
+            m_isCapturing = true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool Profiler::IsCapturing() const
+        {
+            return m_isCapturing;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool Profiler::StopCapture(Core::StorageLocation in_storageLocation, const std::string& in_filePath)
+        {
+            CS_ASSERT(m_isCapturing == true, "Cannot stop profiler capture as no capture is in progress.");
+            
+            m_isCapturing = false;
+            
+            std::vector<const s8*> zoneNames;
+            {
+                std::unique_lock<std::mutex> lock(g_zoneNamesMutex);
+                zoneNames = g_zoneNames;
+            }
+            
+            std::string json = "{\"traceEvents\":[";
+            s8 buffer[128];
+            for (u32 i = 0; i < m_capturedZones.size(); ++i)
+            {
+                const CapturedZone& zone = m_capturedZones[i];
+                
+                json += (i == 0) ? "\n{\"name\":" : ",\n{\"name\":";
+                AppendJSONString(zoneNames[zone.m_zoneId], json);
+                snprintf(buffer, sizeof(buffer), ",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%lld,\"dur\":%lld}", zone.m_threadIndex, (long long)zone.m_startMicroS, (long long)zone.m_durationMicroS);
+                json += buffer;
+            }
+            json += "\n]}\n";
+            
+            m_capturedZones.clear();
+            m_capturedZones.shrink_to_fit();
+            
+            Core::FileStreamUPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filePath, Core::FileMode::k_write);
+            if (stream == nullptr)
+            {
+                CS_LOG_ERROR("Could not open profiler capture file: " + in_filePath);
+                return false;
+            }
+            
+            stream->Write(json);
+            stream->Close();
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Profiler::EndFrame()
+        {
+            const s64 frameEndMicroS = GetTimeMicroS();
+            m_lastFrameTimeMS = (frameEndMicroS - m_lastFrameEndMicroS) / 1000.0;
+            m_lastFrameEndMicroS = frameEndMicroS;
+            
+            {
+                std::unique_lock<std::mutex> lock(g_zoneNamesMutex);
+                for (u32 i = (u32)m_frameStats.size(); i < g_zoneNames.size(); ++i)
+                {
+                    ZoneStats stats;
+                    stats.m_name = g_zoneNames[i];
+                    m_frameStats.push_back(stats);
+#ifdef CS_ENABLE_DEBUGSTATS
+                    m_debugStatsEventNames.push_back(stats.m_name + "Time");
+#endif
+                }
+            }
+            
+            for (ZoneStats& stats : m_frameStats)
+            {
+                stats.m_numCalls = 0;
+                stats.m_totalTimeMS = 0.0;
+                stats.m_maxTimeMS = 0.0;
+            }
+            
+            u32 numDropped = 0;
+#ifdef CS_ENABLE_DEBUGSTATS
+            ThreadBuffer* mainThreadBuffer = GetThreadBuffer();
+#endif
+            for (u32 threadIndex = 0; threadIndex < k_maxThreads; ++threadIndex)
+            {
+                ThreadSlot& slot = g_threadSlots[threadIndex];
+                
+                //The thread will never write to a released slot again, so it's read before draining the buffer.
+                const bool isReleased = (slot.m_threadKey.load(std::memory_order_acquire) == k_releasedThreadKey);
+                ThreadBuffer* buffer = slot.m_buffer.load(std::memory_order_acquire);
+                if (buffer == nullptr)
+                {
+                    continue;
+                }
+                
+                const u32 writeIndex = buffer->m_writeIndex.load(std::memory_order_acquire);
+                u32 readIndex = buffer->m_readIndex.load(std::memory_order_relaxed);
+                for (; readIndex != writeIndex; ++readIndex)
+                {
+                    const RecordedZone& zone = buffer->m_zones[readIndex & k_zoneIndexMask];
+                    const f64 timeMS = (zone.m_endMicroS - zone.m_startMicroS) / 1000.0;
+                    
+                    //Zones registered after the names were copied are picked up next frame.
+                    if (zone.m_zoneId < m_frameStats.size())
+                    {
+                        ZoneStats& stats = m_frameStats[zone.m_zoneId];
+                        stats.m_numCalls++;
+                        stats.m_totalTimeMS += timeMS;
+                        stats.m_maxTimeMS = std::max(stats.m_maxTimeMS, timeMS);
+                    }
+                    
+#ifdef CS_ENABLE_DEBUGSTATS
+                    //Top level zones on the main thread are the application phases.
+                    if (buffer == mainThreadBuffer && zone.m_depth == 0 && zone.m_zoneId < m_frameStats.size())
+                    {
+                        Core::Application::Get()->GetDebugStats()->AddToEvent(m_debugStatsEventNames[zone.m_zoneId], (f32)timeMS);
+                    }
+#endif
+                    
+                    if (m_isCapturing == true && m_capturedZones.size() < k_maxCapturedZones)
+                    {
+                        CapturedZone capturedZone;
+                        capturedZone.m_zoneId = zone.m_zoneId;
+                        capturedZone.m_threadIndex = threadIndex;
+                        capturedZone.m_startMicroS = zone.m_startMicroS;
+                        capturedZone.m_durationMicroS = zone.m_endMicroS - zone.m_startMicroS;
+                        m_capturedZones.push_back(capturedZone);
+                    }
+                }
+                buffer->m_readIndex.store(readIndex, std::memory_order_release);
+                
+                numDropped += buffer->m_numDropped.exchange(0, std::memory_order_relaxed);
+                
+                if (isReleased == true)
+                {
+                    slot.m_buffer.store(nullptr, std::memory_order_relaxed);
+                    delete buffer;
+                    slot.m_threadKey.store(k_freeThreadKey, std::memory_order_release);
+                }
+            }
+            
+            if (numDropped > 0)
+            {
+                CS_LOG_WARNING("Profiler dropped " + Core::ToString(numDropped) + " zones as a thread buffer was full.");
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        ProfileScope::ProfileScope(u32 in_zoneId)
+            : m_zoneId(in_zoneId), m_startMicroS(GetTimeMicroS())
+        {
+            ThreadBuffer* buffer = GetThreadBuffer();
+            if (buffer != nullptr)
+            {
+                buffer->m_depth++;
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        ProfileScope::~ProfileScope()
+        {
+            const s64 endMicroS = GetTimeMicroS();
+            
+            ThreadBuffer* buffer = GetThreadBuffer();
+            if (buffer == nullptr)
+            {
+                return;
+            }
+            
+            buffer->m_depth--;
+            
+            const u32 writeIndex = buffer->m_writeIndex.load(std::memory_order_relaxed);
+            if (writeIndex - buffer->m_readIndex.load(std::memory_order_acquire) >= k_zonesPerThread)
+            {
+                buffer->m_numDropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            
+            RecordedZone& zone = buffer->m_zones[writeIndex & k_zoneIndexMask];
+            zone.m_zoneId = m_zoneId;
+            zone.m_depth = buffer->m_depth;
+            zone.m_startMicroS = m_startMicroS;
+            zone.m_endMicroS = endMicroS;
+            buffer->m_writeIndex.store(writeIndex + 1, std::memory_order_release);
+        }
+    }
+}
+
+#endif
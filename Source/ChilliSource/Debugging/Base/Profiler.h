@@ -0,0 +1,212 @@
+//
+//  Profiler.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_DEBUGGING_BASE_PROFILER_H_
+#define _CHILLISOURCE_DEBUGGING_BASE_PROFILER_H_
+
+#ifdef CS_ENABLE_PROFILING
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------
+/// Profiles the remainder of the enclosing scope under the
+/// given name. The name must be a string literal or otherwise
+/// remain valid for the lifetime of the application. This
+/// compiles to nothing unless CS_ENABLE_PROFILING is defined.
+//------------------------------------------------------------
+#define CS_PROFILE_SCOPE_CONCAT_IMPL(in_a, in_b) in_a##in_b
+#define CS_PROFILE_SCOPE_CONCAT(in_a, in_b) CS_PROFILE_SCOPE_CONCAT_IMPL(in_a, in_b)
+#define CS_PROFILE_SCOPE(in_name) \
+    static const u32 CS_PROFILE_SCOPE_CONCAT(csProfileZone, __LINE__) = CSDebugging::Profiler::RegisterZone(in_name); \
+    CSDebugging::ProfileScope CS_PROFILE_SCOPE_CONCAT(csProfileScope, __LINE__)(CS_PROFILE_SCOPE_CONCAT(csProfileZone, __LINE__))
+
+namespace ChilliSource
+{
+    namespace Debugging
+    {
+        //---------------------------------------------------------------------
+        /// A hierarchical CPU profiler. Zones are recorded using the
+        /// CS_PROFILE_SCOPE macro from any thread. Each thread records into
+        /// its own lock-free buffer, storing only the zone id and the start
+        /// and end times. At the end of each frame the buffers are drained
+        /// on the main thread and aggregated into per-zone frame timings.
+        /// Zones can also be captured over a number of frames and saved in
+        /// the Chrome trace event format, which can be viewed using
+        /// chrome://tracing.
+        ///
+        /// The profiler is only available when the preprocessor flag
+        /// CS_ENABLE_PROFILING is defined.
+        //---------------------------------------------------------------------
+        class Profiler final : public Core::AppSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(Profiler);
+            //------------------------------------------------------------
+            /// The timings for a single zone over the last frame.
+            //------------------------------------------------------------
+            struct ZoneStats
+            {
+                std::string m_name;
+                u32 m_numCalls = 0;
+                f64 m_totalTimeMS = 0.0;
+                f64 m_maxTimeMS = 0.0;
+            };
+            //------------------------------------------------------------
+            /// Allows querying of whether or not this system implements
+            /// a given interface.
+            ///
+            /// @param Interface Id
+            ///
+            /// @return Whether this object is of the given type.
+            //------------------------------------------------------------
+            bool IsA(Core::InterfaceIDType in_interfaceId) const override;
+            //------------------------------------------------------------
+            /// Registers a zone name, returning the id used to record it.
+            /// This is typically called once per call site by the
+            /// CS_PROFILE_SCOPE macro. This is thread-safe.
+            ///
+            /// @param The zone name. This must remain valid for the
+            /// lifetime of the application.
+            ///
+            /// @return The zone id.
+            //------------------------------------------------------------
+            static u32 RegisterZone(const s8* in_name);
+            //------------------------------------------------------------
+            /// Releases the calling thread's buffer so its slot can be
+            /// used by another thread. This should be called by any
+            /// thread which has recorded zones before it exits, as the
+            /// number of threads which can record zones at once is
+            /// limited. Zones already recorded are still included in
+            /// the current frame. This is thread-safe.
+            //------------------------------------------------------------
+            static void ReleaseThread();
+            //------------------------------------------------------------
+            /// @return The time between the last two frames in
+            /// milliseconds.
+            //------------------------------------------------------------
+            f64 GetLastFrameTimeMS() const;
+            //------------------------------------------------------------
+            /// @return The timings of each zone recorded during the last
+            /// frame, indexed by zone id. Zones which were not recorded
+            /// have zero calls.
+            //------------------------------------------------------------
+            const std::vector<ZoneStats>& GetLastFrameStats() const;
+            //------------------------------------------------------------
+            /// Starts capturing all recorded zones for output as a
+            /// Chrome trace. Any previous capture is discarded.
+            //------------------------------------------------------------
+            void StartCapture();
+            //------------------------------------------------------------
+            /// @return Whether or not a capture is in progress.
+            //------------------------------------------------------------
+            bool IsCapturing() const;
+            //------------------------------------------------------------
+            /// Stops the current capture and writes it to the given file
+            /// in the Chrome trace event JSON format.
+            ///
+            /// @param The storage location.
+            /// @param The file path.
+            ///
+            /// @return Whether or not the file was successfully written.
+            //------------------------------------------------------------
+            bool StopCapture(Core::StorageLocation in_storageLocation, const std::string& in_filePath);
+        private:
+            friend class Core::Application;
+            //------------------------------------------------------------
+            /// A zone captured for output as a Chrome trace.
+            //------------------------------------------------------------
+            struct CapturedZone
+            {
+                u32 m_zoneId;
+                u32 m_threadIndex;
+                s64 m_startMicroS;
+                s64 m_durationMicroS;
+            };
+            //------------------------------------------------------------
+            /// Factory create method called by application to create a
+            /// new instance of the system.
+            ///
+            /// @return Creates a new instance of the system.
+            //------------------------------------------------------------
+            static ProfilerUPtr Create();
+            //------------------------------------------------------------
+            /// Private constructor to enforce use of the factory method.
+            //------------------------------------------------------------
+            Profiler();
+            //------------------------------------------------------------
+            /// Called by the application at the end of each frame. This
+            /// drains the zones recorded by each thread, aggregating
+            /// them into the frame stats and adding them to the capture.
+            //------------------------------------------------------------
+            void EndFrame();
+
+            std::vector<ZoneStats> m_frameStats;
+#ifdef CS_ENABLE_DEBUGSTATS
+            std::vector<std::string> m_debugStatsEventNames;
+#endif
+            std::vector<CapturedZone> m_capturedZones;
+            bool m_isCapturing;
+            s64 m_lastFrameEndMicroS;
+            f64 m_lastFrameTimeMS;
+        };
+        //---------------------------------------------------------------------
+        /// Records a zone with the given id from construction until
+        /// destruction. This should be used through CS_PROFILE_SCOPE rather
+        /// than directly.
+        //---------------------------------------------------------------------
+        class ProfileScope final
+        {
+        public:
+            CS_DECLARE_NOCOPY(ProfileScope);
+            //------------------------------------------------------------
+            /// Constructor. Starts timing the zone.
+            ///
+            /// @param The zone id returned from Profiler::RegisterZone().
+            //------------------------------------------------------------
+            ProfileScope(u32 in_zoneId);
+            //------------------------------------------------------------
+            /// Destructor. Records the zone in this thread's buffer.
+            //------------------------------------------------------------
+            ~ProfileScope();
+        private:
+            u32 m_zoneId;
+            s64 m_startMicroS;
+        };
+    }
+}
+
+#else
+
+#define CS_PROFILE_SCOPE(in_name)
+
+#endif
+
+#endif
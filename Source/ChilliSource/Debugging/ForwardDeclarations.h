@@ -43,6 +43,9 @@ namespace ChilliSource
 #ifdef CS_ENABLE_DEBUGSTATS
         CS_FORWARDDECLARE_CLASS(DebugStats);
         CS_FORWARDDECLARE_CLASS(DebugStatsView);
+#endif
+#ifdef CS_ENABLE_PROFILING
+        CS_FORWARDDECLARE_CLASS(Profiler);
 #endif
     }
 }
@@ -36,6 +36,8 @@
 #include <ChilliSource/Rendering/Base/CanvasRenderer.h>
 
 #include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <limits>
 
 namespace ChilliSource
@@ -43,6 +45,27 @@ namespace ChilliSource
     namespace GUI
     {
         static GUIViewSPtr pGUINull;
+        
+        namespace
+        {
+            const u32 k_maxHitTestGridCellsPerAxis = 32;
+        }
+        
+        //-----------------------------------------------------
+        /// A uniform grid over the absolute bounds of the
+        /// subviews. Each cell holds the indices of the
+        /// subviews that overlap it in ascending order.
+        //-----------------------------------------------------
+        struct GUIView::SubviewHitTestGrid
+        {
+            bool m_isValid = false;
+            u32 m_numCellsX = 0;
+            u32 m_numCellsY = 0;
+            Core::Vector2 m_min;
+            Core::Vector2 m_cellSize;
+            std::vector<std::vector<u32>> m_cells;
+            std::vector<u32> m_unboundedSubviews;
+        };
 
 		DEFINE_META_CLASS(GUIView)
 
@@ -75,7 +98,7 @@ namespace ChilliSource
         ///
         /// Default
         //-----------------------------------------------------
-        GUIView::GUIView() : mpParentView(nullptr), mpRootWindow(nullptr), mbIsBeingDragged(false), mudwCacheValidaters(0), UnifiedPosition(0.5f, 0.5f, 0.0f, 0.0f), UnifiedSize(1.0f, 1.0f, 0.0f, 0.0f),
+        GUIView::GUIView() : mpSubviewIterators(nullptr), mpParentView(nullptr), mpRootWindow(nullptr), mbIsBeingDragged(false), mudwCacheValidaters(0), UnifiedPosition(0.5f, 0.5f, 0.0f, 0.0f), UnifiedSize(1.0f, 1.0f, 0.0f, 0.0f),
         Rotation(0.0f), Opacity(1.0f), LocalAlignment(Rendering::AlignmentAnchor::k_middleCentre), ParentalAlignment(Rendering::AlignmentAnchor::k_bottomLeft), AlignedWithParent(false),
         Scale(Core::Vector2::k_one), ClipSubviews(false), InheritColour(true), Visible(true), Movable(false), UserInteraction(true), ConsumesTouches(true),
         AcceptTouchesOutsideOfBounds(false), InheritOpacity(true), RotatedWithParent(true), InheritScale(false), ClipOffScreen(true)
@@ -90,7 +113,7 @@ namespace ChilliSource
         /// @param Param dictionary
         //------------------------------------------------------
         GUIView::GUIView(const Core::ParamDictionary& insParams) 
-		: mpParentView(nullptr), mpRootWindow(nullptr), mbIsBeingDragged(false), mudwCacheValidaters(0), UnifiedPosition(0.5f, 0.5f, 0.0f, 0.0f), UnifiedSize(1.0f, 1.0f, 0.0f, 0.0f),
+		: mpSubviewIterators(nullptr), mpParentView(nullptr), mpRootWindow(nullptr), mbIsBeingDragged(false), mudwCacheValidaters(0), UnifiedPosition(0.5f, 0.5f, 0.0f, 0.0f), UnifiedSize(1.0f, 1.0f, 0.0f, 0.0f),
         Rotation(0.0f), Opacity(1.0f), LocalAlignment(Rendering::AlignmentAnchor::k_middleCentre), ParentalAlignment(Rendering::AlignmentAnchor::k_bottomLeft), AlignedWithParent(false),
         Scale(Core::Vector2::k_one), ClipSubviews(false), InheritColour(true), Visible(true), Movable(false), UserInteraction(true), ConsumesTouches(true),
         AcceptTouchesOutsideOfBounds(false), InheritOpacity(true), RotatedWithParent(true), InheritScale(false), ClipOffScreen(true)
@@ -233,6 +256,12 @@ namespace ChilliSource
 		void GUIView::OnTransformChanged(u32 inudwInvalidFlags)
 		{
             Core::Utils::BitmapClear(mudwCacheValidaters, inudwInvalidFlags);
+            
+            InvalidateSubviewHitTestGrid();
+            if(mpParentView)
+            {
+                mpParentView->InvalidateSubviewHitTestGrid();
+            }
 			
 			for(GUIView::Subviews::iterator it = mSubviews.begin(); it != mSubviews.end(); ++it)
 			{
@@ -253,6 +282,7 @@ namespace ChilliSource
 				return;
 				
             mSubviews.push_back(inpSubview);
+            InvalidateSubviewHitTestGrid();
 			
 			if(inpSubview->GetParentViewPtr())
 			{
@@ -285,7 +315,29 @@ namespace ChilliSource
                 {
                     inpSubview->SetParentView(nullptr);
                     inpSubview->SetRootWindow(nullptr);
+                    
+                    if(mpSubviewIterators)
+                    {
+                        //Keep the view alive until iteration has finished and step any iterators past the gap
+                        mRemovedSubviews.push_back(*it);
+                        
+                        const u32 udwIndex = (u32)(it - mSubviews.begin());
+                        for(SubviewIterator* pIterator = mpSubviewIterators; pIterator != nullptr; pIterator = pIterator->mpPrevious)
+                        {
+                            if(udwIndex < pIterator->mudwBegin)
+                            {
+                                --pIterator->mudwBegin;
+                                --pIterator->mudwEnd;
+                            }
+                            else if(udwIndex < pIterator->mudwEnd)
+                            {
+                                --pIterator->mudwEnd;
+                            }
+                        }
+                    }
+                    
                     mSubviews.erase(it);
+                    InvalidateSubviewHitTestGrid();
                     return;
                 }
             }
@@ -305,7 +357,19 @@ namespace ChilliSource
 				(*it)->SetRootWindow(nullptr);
             }
 			
+			if(mpSubviewIterators)
+			{
+				mRemovedSubviews.insert(mRemovedSubviews.end(), mSubviews.begin(), mSubviews.end());
+				
+				for(SubviewIterator* pIterator = mpSubviewIterators; pIterator != nullptr; pIterator = pIterator->mpPrevious)
+				{
+					pIterator->mudwBegin = 0;
+					pIterator->mudwEnd = 0;
+				}
+			}
+			
 			mSubviews.clear();
+			InvalidateSubviewHitTestGrid();
 		}
         //-----------------------------------------------------
         /// Remove From Parent View
@@ -391,6 +455,14 @@ namespace ChilliSource
         //-----------------------------------------------------
         void GUIView::BringSubviewForward(GUIView* inpView)
         {
+            if(mpSubviewIterators)
+            {
+                mDeferredSubviewReorders.push_back(std::make_pair(inpView, SubviewReorder::k_forward));
+                return;
+            }
+            
+            InvalidateSubviewHitTestGrid();
+            
             u32 udwNumSubviews = mSubviews.size();
             for(u32 i=0; i<udwNumSubviews; ++i)
             {
@@ -408,6 +480,14 @@ namespace ChilliSource
         //-----------------------------------------------------
         void GUIView::SendSubviewBackward(GUIView* inpView)
         {
+            if(mpSubviewIterators)
+            {
+                mDeferredSubviewReorders.push_back(std::make_pair(inpView, SubviewReorder::k_backward));
+                return;
+            }
+            
+            InvalidateSubviewHitTestGrid();
+            
             u32 udwNumSubviews = mSubviews.size();
             for(u32 i=0; i<udwNumSubviews; ++i)
             {
@@ -425,6 +505,14 @@ namespace ChilliSource
         //-----------------------------------------------------
         void GUIView::BringSubviewToFront(GUIView* inpView)
         {
+            if(mpSubviewIterators)
+            {
+                mDeferredSubviewReorders.push_back(std::make_pair(inpView, SubviewReorder::k_toFront));
+                return;
+            }
+            
+            InvalidateSubviewHitTestGrid();
+            
             u32 udwNumSubviews = mSubviews.size();
             for(u32 i = 1; i < udwNumSubviews; ++i)
             {
@@ -441,6 +529,14 @@ namespace ChilliSource
         //-----------------------------------------------------
         void GUIView::SendSubviewToBack(GUIView* inpView)
         {
+            if(mpSubviewIterators)
+            {
+                mDeferredSubviewReorders.push_back(std::make_pair(inpView, SubviewReorder::k_toBack));
+                return;
+            }
+            
+            InvalidateSubviewHitTestGrid();
+            
             u32 udwNumSubviews = mSubviews.size();
             for(u32 i = udwNumSubviews - 1; i > 0; --i)
             {
@@ -1583,13 +1679,12 @@ namespace ChilliSource
         {
             if(Visible)
             {
-				mSubviewsCopy = mSubviews;
-                for(GUIView::Subviews::iterator it = mSubviewsCopy.begin(); it != mSubviewsCopy.end(); ++it)
+                //Subviews added during the update are not updated until next frame
+                SubviewIterator subviews(this, false);
+                while(GUIView* pSubview = subviews.Next())
                 {
-                    (*it)->Update(infDt);
+                    pSubview->Update(infDt);
                 }
-                
-                mSubviewsCopy.clear();
             }
         }
         //-----------------------------------------------------
@@ -1654,6 +1749,11 @@ namespace ChilliSource
 		void GUIView::EnableAcceptTouchesOutsideOfBounds(bool inbEnable)
 		{
 			AcceptTouchesOutsideOfBounds = inbEnable;
+            
+            if(mpParentView)
+            {
+                mpParentView->InvalidateSubviewHitTestGrid();
+            }
 		}
 		//-----------------------------------------------------------
         /// Is Accept Touches Outside of Bounds Enabled
@@ -1688,24 +1788,12 @@ namespace ChilliSource
 					mbIsBeingDragged = true;
 				}
 
-				mSubviewsCopy = mSubviews;
-
-                //Loop through all our children
-                for(GUIView::Subviews::reverse_iterator it = mSubviewsCopy.rbegin(); it != mSubviewsCopy.rend(); ++it)
-                {
-					if((*it)->UserInteraction)
-					{
-						bool bContains = (*it)->Contains(in_pointer.GetPosition());
-						if((*it)->IsAcceptTouchesOutsideOfBoundsEnabled() || bContains)
-						{
-							if((*it)->OnPointerDown(in_pointer, in_timestamp, in_inputType))
-							{
-                                mSubviewsCopy.clear();
-								return true;
-							}
-						}
-					}
-                }
+				//Loop through all our children
+				if(DispatchPointerDownToSubviews(in_pointer, in_timestamp, in_inputType))
+				{
+					return true;
+				}
+				
                 //Check for input events
 				bool bContains = Contains(in_pointer.GetPosition());
 				if(IsAcceptTouchesOutsideOfBoundsEnabled() || bContains)
@@ -1716,7 +1804,6 @@ namespace ChilliSource
 					//We consume this touch as it is within us
 					if(IsTouchConsumptionEnabled() && bContains)
 					{
-                        mSubviewsCopy.clear();
 						return true;
 					}
                 }
@@ -1724,7 +1811,6 @@ namespace ChilliSource
             }
             
             //We have no user interaction enabled - let this touch pass
-            mSubviewsCopy.clear();
             return false;
         }
         //-----------------------------------------------------------
@@ -1745,11 +1831,10 @@ namespace ChilliSource
 					}
 				}
 
-				mSubviewsCopy = mSubviews;
-
-                for(GUIView::Subviews::reverse_iterator it = mSubviewsCopy.rbegin(); it != mSubviewsCopy.rend(); ++it)
+				SubviewIterator subviews(this, true);
+                while(GUIView* pSubview = subviews.Next())
                 {
-                    (*it)->OnPointerMoved(in_pointer, in_timestamp);
+                    pSubview->OnPointerMoved(in_pointer, in_timestamp);
                 }
                 
                 //Only send the moved event if the event is inside the view.
@@ -1758,8 +1843,6 @@ namespace ChilliSource
                     m_pointerMovedEvent.NotifyConnections(in_pointer, in_timestamp);
                 }
             }
-            
-            mSubviewsCopy.clear();
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
@@ -1769,17 +1852,15 @@ namespace ChilliSource
 
             if(UserInteraction)
             {
-				mSubviewsCopy = mSubviews;
-				
-                for(GUIView::Subviews::reverse_iterator it = mSubviewsCopy.rbegin(); it != mSubviewsCopy.rend(); ++it)
+				SubviewIterator subviews(this, true);
+                while(GUIView* pSubview = subviews.Next())
                 {
-                    (*it)->OnPointerUp(in_pointer, in_timestamp, in_inputType);
+                    pSubview->OnPointerUp(in_pointer, in_timestamp, in_inputType);
                 }
                 
                 m_pointerUpEvent.NotifyConnections(in_pointer, in_timestamp, in_inputType);
                 mInputEvents.OnPointerUp(this, in_pointer);
             }
-            mSubviewsCopy.clear();
         }
         
         //-----------------------------------------------------
@@ -1790,11 +1871,252 @@ namespace ChilliSource
         //-----------------------------------------------------
         void GUIView::LayoutChildrensContent()
         {
-            Subviews aSubviewsCopy = mSubviews;
-            for(GUIView::Subviews::iterator it = aSubviewsCopy.begin(); it != aSubviewsCopy.end(); ++it)
+            SubviewIterator subviews(this, false);
+            while(GUIView* pSubview = subviews.Next())
+            {
+                pSubview->LayoutContent();
+                pSubview->LayoutChildrensContent();
+            }
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        GUIView::SubviewIterator::SubviewIterator(GUIView* inpView, bool inbTopMostFirst)
+        : mpView(inpView), mpPrevious(inpView->mpSubviewIterators), mudwBegin(0), mudwEnd(inpView->mSubviews.size()), mbTopMostFirst(inbTopMostFirst)
+        {
+            mpView->mpSubviewIterators = this;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        GUIView* GUIView::SubviewIterator::Next()
+        {
+            if(mudwBegin == mudwEnd)
+            {
+                return nullptr;
+            }
+            
+            if(mbTopMostFirst == true)
+            {
+                return mpView->mSubviews[--mudwEnd].get();
+            }
+            
+            return mpView->mSubviews[mudwBegin++].get();
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        GUIView::SubviewIterator::~SubviewIterator()
+        {
+            CS_ASSERT(mpView->mpSubviewIterators == this, "Subview iterators must be destroyed in reverse order of creation.");
+            mpView->mpSubviewIterators = mpPrevious;
+            
+            if(mpPrevious == nullptr)
+            {
+                mpView->OnSubviewIterationFinished();
+            }
+        }
+        //-----------------------------------------------------
+        /// On Subview Iteration Finished
+        //-----------------------------------------------------
+        void GUIView::OnSubviewIterationFinished()
+        {
+            if(mDeferredSubviewReorders.empty() == false)
+            {
+                std::vector<std::pair<GUIView*, SubviewReorder>> aReorders;
+                aReorders.swap(mDeferredSubviewReorders);
+                
+                for(const auto& reorder : aReorders)
+                {
+                    switch(reorder.second)
+                    {
+                        case SubviewReorder::k_forward:
+                            BringSubviewForward(reorder.first);
+                            break;
+                        case SubviewReorder::k_backward:
+                            SendSubviewBackward(reorder.first);
+                            break;
+                        case SubviewReorder::k_toFront:
+                            BringSubviewToFront(reorder.first);
+                            break;
+                        case SubviewReorder::k_toBack:
+                            SendSubviewToBack(reorder.first);
+                            break;
+                    }
+                }
+            }
+            
+            if(mRemovedSubviews.empty() == false)
+            {
+                //Releasing the views may cause them to be destroyed
+                Subviews removedSubviews;
+                removedSubviews.swap(mRemovedSubviews);
+            }
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        bool GUIView::DispatchPointerDownToSubviews(const Input::Pointer& in_pointer, f64 in_timestamp, Input::Pointer::InputType in_inputType)
+        {
+            if(mpSubviewHitTestGrid)
+            {
+                if(mpSubviewHitTestGrid->m_isValid == false)
+                {
+                    BuildSubviewHitTestGrid();
+                }
+                
+                const SubviewHitTestGrid& grid(*mpSubviewHitTestGrid);
+                std::vector<u32> aCandidateIndices;
+                
+                Core::Vector2 vCell = (in_pointer.GetPosition() - grid.m_min) / grid.m_cellSize;
+                if(vCell.x >= 0.0f && vCell.y >= 0.0f && vCell.x < (f32)grid.m_numCellsX && vCell.y < (f32)grid.m_numCellsY)
+                {
+                    const std::vector<u32>& cell(grid.m_cells[(u32)vCell.y * grid.m_numCellsX + (u32)vCell.x]);
+                    std::merge(cell.begin(), cell.end(), grid.m_unboundedSubviews.begin(), grid.m_unboundedSubviews.end(), std::back_inserter(aCandidateIndices));
+                }
+                else
+                {
+                    aCandidateIndices = grid.m_unboundedSubviews;
+                }
+                
+                //The views notified may change the subviews or the grid so take our own references to the candidates
+                Subviews aCandidates;
+                aCandidates.reserve(aCandidateIndices.size());
+                for(u32 udwIndex : aCandidateIndices)
+                {
+                    aCandidates.push_back(mSubviews[udwIndex]);
+                }
+                
+                for(auto it = aCandidates.rbegin(); it != aCandidates.rend(); ++it)
+                {
+                    GUIView* pSubview = it->get();
+                    if(pSubview->GetParentViewPtr() == this && pSubview->UserInteraction && (pSubview->IsAcceptTouchesOutsideOfBoundsEnabled() || pSubview->Contains(in_pointer.GetPosition())))
+                    {
+                        if(pSubview->OnPointerDown(in_pointer, in_timestamp, in_inputType))
+                        {
+                            return true;
+                        }
+                    }
+                }
+                
+                return false;
+            }
+            
+            SubviewIterator subviews(this, true);
+            while(GUIView* pSubview = subviews.Next())
+            {
+                if(pSubview->UserInteraction && (pSubview->IsAcceptTouchesOutsideOfBoundsEnabled() || pSubview->Contains(in_pointer.GetPosition())))
+                {
+                    if(pSubview->OnPointerDown(in_pointer, in_timestamp, in_inputType))
+                    {
+                        return true;
+                    }
+                }
+            }
+            
+            return false;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void GUIView::EnableSubviewHitTestGrid(bool inbEnable)
+        {
+            if(inbEnable == true && mpSubviewHitTestGrid == nullptr)
+            {
+                mpSubviewHitTestGrid.reset(new SubviewHitTestGrid());
+            }
+            else if(inbEnable == false)
             {
-                (*it)->LayoutContent();
-                (*it)->LayoutChildrensContent();
+                mpSubviewHitTestGrid.reset();
+            }
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        bool GUIView::IsSubviewHitTestGridEnabled() const
+        {
+            return mpSubviewHitTestGrid != nullptr;
+        }
+        //-----------------------------------------------------
+        /// Invalidate Subview Hit Test Grid
+        //-----------------------------------------------------
+        void GUIView::InvalidateSubviewHitTestGrid()
+        {
+            if(mpSubviewHitTestGrid)
+            {
+                mpSubviewHitTestGrid->m_isValid = false;
+            }
+        }
+        //-----------------------------------------------------
+        /// Build Subview Hit Test Grid
+        //-----------------------------------------------------
+        void GUIView::BuildSubviewHitTestGrid()
+        {
+            SubviewHitTestGrid& grid(*mpSubviewHitTestGrid);
+            
+            //Size the grid to fit the bounds of all the subviews
+            Core::Vector2 vMin(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
+            Core::Vector2 vMax(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
+            u32 udwNumBounded = 0;
+            
+            grid.m_unboundedSubviews.clear();
+            for(u32 i = 0; i < mSubviews.size(); ++i)
+            {
+                if(mSubviews[i]->IsAcceptTouchesOutsideOfBoundsEnabled())
+                {
+                    grid.m_unboundedSubviews.push_back(i);
+                    continue;
+                }
+                
+                Core::Vector2 vCentre = mSubviews[i]->GetAbsoluteScreenSpaceAnchorPoint(Rendering::AlignmentAnchor::k_middleCentre);
+                Core::Vector2 vHalfSize = mSubviews[i]->GetAbsoluteSize() * 0.5f;
+                vMin = Core::Vector2::Min(vMin, vCentre - vHalfSize);
+                vMax = Core::Vector2::Max(vMax, vCentre + vHalfSize);
+                ++udwNumBounded;
+            }
+            
+            grid.m_numCellsX = 0;
+            grid.m_numCellsY = 0;
+            grid.m_isValid = true;
+            
+            if(udwNumBounded == 0)
+            {
+                return;
+            }
+            
+            u32 udwCellsPerAxis = (u32)std::sqrt((f32)udwNumBounded);
+            udwCellsPerAxis = std::max(1u, std::min(udwCellsPerAxis, k_maxHitTestGridCellsPerAxis));
+            
+            grid.m_numCellsX = udwCellsPerAxis;
+            grid.m_numCellsY = udwCellsPerAxis;
+            grid.m_min = vMin;
+            grid.m_cellSize = Core::Vector2::Max((vMax - vMin) / (f32)udwCellsPerAxis, Core::Vector2(std::numeric_limits<f32>::epsilon(), std::numeric_limits<f32>::epsilon()));
+            
+            grid.m_cells.resize(grid.m_numCellsX * grid.m_numCellsY);
+            for(auto& cell : grid.m_cells)
+            {
+                cell.clear();
+            }
+            
+            //Subviews are added in order so each cell stays sorted by index
+            for(u32 i = 0; i < mSubviews.size(); ++i)
+            {
+                if(mSubviews[i]->IsAcceptTouchesOutsideOfBoundsEnabled())
+                {
+                    continue;
+                }
+                
+                Core::Vector2 vCentre = mSubviews[i]->GetAbsoluteScreenSpaceAnchorPoint(Rendering::AlignmentAnchor::k_middleCentre);
+                Core::Vector2 vHalfSize = mSubviews[i]->GetAbsoluteSize() * 0.5f;
+                Core::Vector2 vMinCell = (vCentre - vHalfSize - grid.m_min) / grid.m_cellSize;
+                Core::Vector2 vMaxCell = (vCentre + vHalfSize - grid.m_min) / grid.m_cellSize;
+                
+                u32 udwMinX = (u32)Core::MathUtils::Clamp(vMinCell.x, 0.0f, (f32)(grid.m_numCellsX - 1));
+                u32 udwMinY = (u32)Core::MathUtils::Clamp(vMinCell.y, 0.0f, (f32)(grid.m_numCellsY - 1));
+                u32 udwMaxX = (u32)Core::MathUtils::Clamp(vMaxCell.x, 0.0f, (f32)(grid.m_numCellsX - 1));
+                u32 udwMaxY = (u32)Core::MathUtils::Clamp(vMaxCell.y, 0.0f, (f32)(grid.m_numCellsY - 1));
+                
+                for(u32 y = udwMinY; y <= udwMaxY; ++y)
+                {
+                    for(u32 x = udwMinX; x <= udwMaxX; ++x)
+                    {
+                        grid.m_cells[y * grid.m_numCellsX + x].push_back(i);
+                    }
+                }
             }
         }
 		//-----------------------------------------------------
@@ -813,6 +813,25 @@ namespace ChilliSource
 			//-----------------------------------------------------------
 			bool IsAcceptTouchesOutsideOfBoundsEnabled() const;
 			//-----------------------------------------------------------
+			/// Enable Subview Hit Test Grid
+			///
+			/// When set to true, the view will bucket its subviews into
+			/// a uniform grid based on their bounds so pointer down
+			/// events only test the subviews near the pointer. This is
+			/// useful for views with a large number of subviews. Subviews
+			/// that override Contains() to accept touches outside of their
+			/// bounds should also enable AcceptTouchesOutsideOfBounds.
+			///
+			/// @param Whether the grid is enabled
+			//-----------------------------------------------------------
+			void EnableSubviewHitTestGrid(bool inbEnable);
+			//-----------------------------------------------------------
+			/// Is Subview Hit Test Grid Enabled
+			///
+			/// @return Whether the view uses a hit test grid
+			//-----------------------------------------------------------
+			bool IsSubviewHitTestGridEnabled() const;
+			//-----------------------------------------------------------
 			/// On Screen Resolution Changed
 			///
 			/// Triggered if the screen resolution changes so we can
@@ -942,7 +961,93 @@ namespace ChilliSource
 			/// @return Cumulated rotation of the parent hierarchy
             //------------------------------------------------------
             const f32 GetParentSpaceRotation() const;
+            //-----------------------------------------------------
+            /// Subview Iterator
+            ///
+            /// Walks the subviews present when it was created while
+            /// calling out to other code, without copying them.
+            /// Subviews removed in the meantime are erased straight
+            /// away and the iterator adjusted so no subview is
+            /// skipped or visited twice; they are kept alive until
+            /// the outermost iterator is destroyed. Reordering the
+            /// subviews is deferred until then. Subviews added in
+            /// the meantime are not visited.
+            //-----------------------------------------------------
+            class SubviewIterator final
+            {
+            public:
+                //-----------------------------------------------------
+                /// Constructor
+                ///
+                /// @param The view whose subviews are iterated
+                /// @param Whether to visit the top-most subview first
+                //-----------------------------------------------------
+                SubviewIterator(GUIView* inpView, bool inbTopMostFirst);
+                SubviewIterator(const SubviewIterator&) = delete;
+                SubviewIterator& operator=(const SubviewIterator&) = delete;
+                //-----------------------------------------------------
+                /// @return The next subview or null if all have been
+                /// visited. The view is kept alive until the iterator
+                /// is destroyed even if it is removed.
+                //-----------------------------------------------------
+                GUIView* Next();
+                //-----------------------------------------------------
+                /// Destructor
+                //-----------------------------------------------------
+                ~SubviewIterator();
+            private:
+                friend class GUIView;
+                
+                GUIView* mpView;
+                SubviewIterator* mpPrevious;
+                u32 mudwBegin;
+                u32 mudwEnd;
+                bool mbTopMostFirst;
+            };
+            //-----------------------------------------------------------
+            /// Passes the pointer down event to the subviews, top-most
+            /// first, until one of them consumes it.
+            ///
+			/// @param The pointer
+            /// @param The timestamp
+            /// @param The press type.
+			///
+            /// @return Whether touch has been consumed by a subview
+            //-----------------------------------------------------------
+            bool DispatchPointerDownToSubviews(const Input::Pointer& in_pointer, f64 in_timestamp, Input::Pointer::InputType in_inputType);
 		private:
+            
+            struct SubviewHitTestGrid;
+            //-----------------------------------------------------
+            /// Invalidate Subview Hit Test Grid
+            ///
+            /// Flags the hit test grid for rebuild next time it is
+            /// used, as the bounds or order of subviews changed.
+            //-----------------------------------------------------
+            void InvalidateSubviewHitTestGrid();
+            //-----------------------------------------------------
+            /// Build Subview Hit Test Grid
+            ///
+            /// Buckets the subviews into the hit test grid based
+            /// on their absolute bounds.
+            //-----------------------------------------------------
+            void BuildSubviewHitTestGrid();
+            //-----------------------------------------------------
+            /// On Subview Iteration Finished
+            ///
+            /// Called once the outermost subview iterator has been
+            /// destroyed. Applies any deferred reordering and
+            /// releases the subviews removed during iteration.
+            //-----------------------------------------------------
+            void OnSubviewIterationFinished();
+            
+            enum class SubviewReorder
+            {
+                k_forward,
+                k_backward,
+                k_toFront,
+                k_toBack
+            };
 
 
 			mutable Core::Matrix3 mmatTransform;
@@ -963,7 +1068,10 @@ namespace ChilliSource
             Core::Event<Input::PointerSystem::PointerUpDelegate> m_pointerUpEvent;
             
 			Subviews mSubviews;
-			Subviews mSubviewsCopy;
+			Subviews mRemovedSubviews;
+			std::vector<std::pair<GUIView*, SubviewReorder>> mDeferredSubviewReorders;
+			SubviewIterator* mpSubviewIterators;
+			std::unique_ptr<SubviewHitTestGrid> mpSubviewHitTestGrid;
 
 			InputEvents mInputEvents;
 
@@ -30,7 +30,11 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Container/ParamDictionarySerialiser.h>
+#include <ChilliSource/Core/File/BinaryReader.h>
+#include <ChilliSource/Core/File/BinaryWriter.h>
+#include <ChilliSource/Core/File/FileStream.h>
 #include <ChilliSource/Core/String/StringParser.h>
+#include <ChilliSource/Core/String/ToString.h>
 #include <ChilliSource/Core/XML/XMLUtils.h>
 
 #include <ChilliSource/GUI/Button/HighlightButton.h>
@@ -59,6 +63,13 @@ namespace ChilliSource
 	namespace GUI
 	{
 		GUIViewFactory::MapDelegateToString GUIViewFactory::mmapDelegateToType;
+		std::unordered_map<std::string, GUIViewFactory::LayoutTemplateCSPtr> GUIViewFactory::s_layoutCache;
+        
+        namespace
+        {
+            const u32 k_cookedLayoutMagic = 0x4C475343; //"CSGL"
+            const u32 k_cookedLayoutVersion = 1;
+        }
 
 		//--------------------------------------------------------
 		/// Register Defaults
@@ -124,10 +135,114 @@ namespace ChilliSource
 		//--------------------------------------------------------
 		GUIViewUPtr GUIViewFactory::CreateGUIViewFromScript(Core::StorageLocation ineStorageLocation, const std::string& instrScriptFile)
 		{
-			GUIViewUPtr pRootView;
-
-            Core::XMLUPtr xml = Core::XMLUtils::ReadDocument(ineStorageLocation, instrScriptFile);
-             CS_ASSERT(xml != nullptr, "Cannot open GUI file: " + instrScriptFile);
+            LayoutTemplateCSPtr layoutTemplate = GetLayoutTemplate(ineStorageLocation, instrScriptFile);
+            CS_ASSERT(layoutTemplate != nullptr, "Cannot open GUI file: " + instrScriptFile);
+            
+            if(layoutTemplate == nullptr)
+            {
+                return nullptr;
+            }
+            
+			return CreateView(*layoutTemplate);
+		}
+        //--------------------------------------------------------
+        //--------------------------------------------------------
+        bool GUIViewFactory::CookLayout(Core::StorageLocation in_sourceLocation, const std::string& in_sourcePath, Core::StorageLocation in_destLocation, const std::string& in_destPath)
+        {
+            LayoutTemplateCSPtr layoutTemplate = ReadLayoutTemplate(in_sourceLocation, in_sourcePath);
+            if(layoutTemplate == nullptr)
+            {
+                CS_LOG_ERROR("Cannot cook GUI layout as it could not be read: " + in_sourcePath);
+                return false;
+            }
+            
+            Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_destLocation, in_destPath, Core::FileMode::k_writeBinary);
+            Core::BinaryWriter writer(stream);
+            if(writer.IsBad() == true)
+            {
+                CS_LOG_ERROR("Cannot open cooked GUI layout for writing: " + in_destPath);
+                return false;
+            }
+            
+            writer.Write(k_cookedLayoutMagic);
+            writer.Write(k_cookedLayoutVersion);
+            WriteViewTemplate(*layoutTemplate, writer);
+            
+            bool success = (writer.IsBad() == false);
+            stream->Close();
+            return success;
+        }
+        //--------------------------------------------------------
+        //--------------------------------------------------------
+        void GUIViewFactory::ClearLayoutCache()
+        {
+            s_layoutCache.clear();
+        }
+        //--------------------------------------------------------
+        //--------------------------------------------------------
+        GUIViewFactory::LayoutTemplateCSPtr GUIViewFactory::GetLayoutTemplate(Core::StorageLocation in_location, const std::string& in_filePath)
+        {
+            std::string key = Core::ToString(u32(in_location)) + ":" + in_filePath;
+            
+            auto it = s_layoutCache.find(key);
+            if(it != s_layoutCache.end())
+            {
+                return it->second;
+            }
+            
+            LayoutTemplateCSPtr layoutTemplate = ReadLayoutTemplate(in_location, in_filePath);
+            if(layoutTemplate != nullptr)
+            {
+                s_layoutCache.insert(std::make_pair(key, layoutTemplate));
+            }
+            return layoutTemplate;
+        }
+        //--------------------------------------------------------
+        //--------------------------------------------------------
+        GUIViewFactory::LayoutTemplateCSPtr GUIViewFactory::ReadLayoutTemplate(Core::StorageLocation in_location, const std::string& in_filePath)
+        {
+            //Cooked layouts are identified by their header rather than their extension.
+            Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, Core::FileMode::k_readBinary);
+            if(stream == nullptr || stream->IsOpen() == false || stream->IsBad() == true)
+            {
+                return nullptr;
+            }
+            
+            //The file is only read once. The header is checked through a view of the whole file, which is then either
+            //parsed as a cooked layout or passed on to the XML parser.
+            Core::BinaryReader fileReader(stream);
+            const u32 fileSize = fileReader.GetRemaining();
+            const s8* fileData = fileReader.ReadView(fileSize);
+            if(fileReader.IsBad() == true || fileData == nullptr || fileSize == 0)
+            {
+                return nullptr;
+            }
+            
+            Core::BinaryReader reader(fileData, fileSize);
+            if(reader.GetRemaining() >= sizeof(u32) * 2 && reader.Read<u32>() == k_cookedLayoutMagic)
+            {
+                u32 version = reader.Read<u32>();
+                if(version != k_cookedLayoutVersion)
+                {
+                    CS_LOG_ERROR("Unsupported cooked GUI layout version in: " + in_filePath);
+                    return nullptr;
+                }
+                
+                std::shared_ptr<LayoutTemplate> layoutTemplate(new LayoutTemplate());
+                ReadViewTemplate(reader, *layoutTemplate);
+                if(reader.IsBad() == true)
+                {
+                    CS_LOG_ERROR("Cooked GUI layout is corrupt: " + in_filePath);
+                    return nullptr;
+                }
+                return layoutTemplate;
+            }
+            
+            Core::XMLUPtr xml = Core::XMLUtils::ParseDocument(std::string(fileData, fileSize));
+            if(xml == nullptr)
+            {
+                return nullptr;
+            }
             
             Core::XML::Node* pDocRoot = Core::XMLUtils::GetFirstChildElement(xml->GetDocument());
 			if(pDocRoot && Core::XMLUtils::GetName(pDocRoot) == "Layout")
@@ -135,75 +250,123 @@ namespace ChilliSource
 				Core::XML::Node* pViewElement = Core::XMLUtils::GetFirstChildElement(pDocRoot);
 				if(pViewElement)
 				{
-					pRootView = CreateView(pViewElement);
+                    std::shared_ptr<LayoutTemplate> layoutTemplate(new LayoutTemplate());
+                    ReadViewTemplate(pViewElement, *layoutTemplate);
+                    return layoutTemplate;
 				}
 			}
-
-			return pRootView;
-		}
-		//--------------------------------------------------------
-		/// Create View
-		///
-		/// Recursive function used to create subviews
-		///
-		/// @param View XML element
-		/// @return Created view
-		//--------------------------------------------------------
-		GUIViewUPtr GUIViewFactory::CreateView(Core::XML::Node* inpViewElement)
-		{
-			//Get the view type
-			//Get the param dictionary config values
-			GUIViewUPtr pView;
-            std::string strType;
-            std::string strSource;
-            bool bExtern = false;
-            Core::StorageLocation eStorageLoc = Core::StorageLocation::k_none;
-            
-            for(Core::XML::Attribute* pAttr = Core::XMLUtils::GetFirstAttribute(inpViewElement); pAttr != nullptr; pAttr = Core::XMLUtils::GetNextAttribute(pAttr))
+            
+            return nullptr;
+        }
+        //--------------------------------------------------------
+        //--------------------------------------------------------
+        void GUIViewFactory::ReadViewTemplate(Core::XML::Node* in_viewElement, LayoutTemplate& out_template)
+        {
+            for(Core::XML::Attribute* pAttr = Core::XMLUtils::GetFirstAttribute(in_viewElement); pAttr != nullptr; pAttr = Core::XMLUtils::GetNextAttribute(pAttr))
             {
-                
                 if(Core::XMLUtils::GetName(pAttr) == "Type")
                 {
-                    strType = Core::XMLUtils::GetValue(pAttr);
+                    out_template.m_type = Core::XMLUtils::GetValue(pAttr);
                 }
                 else if(Core::XMLUtils::GetName(pAttr) == "Source")
                 {
-                    bExtern = true;
-                    strSource = Core::XMLUtils::GetValue(pAttr);
+                    out_template.m_isExtern = true;
+                    out_template.m_sourcePath = Core::XMLUtils::GetValue(pAttr);
                 }
                 else if(Core::XMLUtils::GetName(pAttr) == "StorageLocation")
                 {
-                    bExtern = true;
-                    eStorageLoc = Core::ParseStorageLocation(Core::XMLUtils::GetValue(pAttr));
+                    out_template.m_isExtern = true;
+                    out_template.m_sourceLocation = Core::ParseStorageLocation(Core::XMLUtils::GetValue(pAttr));
                 }
             }
             
+            out_template.m_params = Core::ParamDictionarySerialiser::FromString(in_viewElement->value());
+            
+            for(Core::XML::Node* pNode = Core::XMLUtils::GetFirstChildElement(in_viewElement); pNode != nullptr; pNode = Core::XMLUtils::GetNextSiblingElement(pNode))
+            {
+                out_template.m_subviews.push_back(LayoutTemplate());
+                ReadViewTemplate(pNode, out_template.m_subviews.back());
+            }
+        }
+        //--------------------------------------------------------
+        //--------------------------------------------------------
+        void GUIViewFactory::ReadViewTemplate(Core::BinaryReader& in_reader, LayoutTemplate& out_template)
+        {
+            out_template.m_type = in_reader.ReadString();
+            out_template.m_isExtern = (in_reader.Read<u8>() != 0);
+            out_template.m_sourceLocation = Core::StorageLocation(in_reader.Read<u32>());
+            out_template.m_sourcePath = in_reader.ReadString();
+            
+            u32 numParams = in_reader.Read<u32>();
+            for(u32 i = 0; i < numParams && in_reader.IsBad() == false; ++i)
+            {
+                std::string key = in_reader.ReadString();
+                out_template.m_params.SetValue(key, in_reader.ReadString());
+            }
+            
+            u32 numSubviews = in_reader.Read<u32>();
+            for(u32 i = 0; i < numSubviews && in_reader.IsBad() == false; ++i)
+            {
+                out_template.m_subviews.push_back(LayoutTemplate());
+                ReadViewTemplate(in_reader, out_template.m_subviews.back());
+            }
+        }
+        //--------------------------------------------------------
+        //--------------------------------------------------------
+        void GUIViewFactory::WriteViewTemplate(const LayoutTemplate& in_template, Core::BinaryWriter& in_writer)
+        {
+            in_writer.WriteString(in_template.m_type);
+            in_writer.Write(u8(in_template.m_isExtern ? 1 : 0));
+            in_writer.Write(u32(in_template.m_sourceLocation));
+            in_writer.WriteString(in_template.m_sourcePath);
+            
+            in_writer.Write(u32(in_template.m_params.size()));
+            for(const auto& param : in_template.m_params)
+            {
+                in_writer.WriteString(param.first);
+                in_writer.WriteString(param.second);
+            }
+            
+            in_writer.Write(u32(in_template.m_subviews.size()));
+            for(const LayoutTemplate& subview : in_template.m_subviews)
+            {
+                WriteViewTemplate(subview, in_writer);
+            }
+        }
+		//--------------------------------------------------------
+		/// Create View
+		///
+		/// Recursive function used to create subviews
+		///
+		/// @param View template
+		/// @return Created view
+		//--------------------------------------------------------
+		GUIViewUPtr GUIViewFactory::CreateView(const LayoutTemplate& in_template)
+		{
 			//Create the UI of the given type
-			MapDelegateToString::iterator it = mmapDelegateToType.find(strType);
+			MapDelegateToString::iterator it = mmapDelegateToType.find(in_template.m_type);
 			if(it != mmapDelegateToType.end())
 			{
-				Core::ParamDictionary sParams = Core::ParamDictionarySerialiser::FromString(inpViewElement->value());
-	
 				//Lets load the given type!
-				pView = (it->second)(sParams);
+				GUIViewUPtr pView = (it->second)(in_template.m_params);
                 
-                if(bExtern)
+                if(in_template.m_isExtern)
                 {
-                    pView->AddSubview(CreateGUIViewFromScript(eStorageLoc, strSource));
+                    pView->AddSubview(CreateGUIViewFromScript(in_template.m_sourceLocation, in_template.m_sourcePath));
                 }
                 
 				//Now we need to do some recursion and load any subviews
-                for(Core::XML::Node* pNode = Core::XMLUtils::GetFirstChildElement(inpViewElement); pNode != nullptr; pNode = Core::XMLUtils::GetNextSiblingElement(pNode))
+                for(const LayoutTemplate& subview : in_template.m_subviews)
 				{
-                    pView->AddSubview(CreateView(pNode));
+                    pView->AddSubview(CreateView(subview));
 				}
 
 				return pView;
 			}
 			else
 			{
-				CS_LOG_ERROR("Cannot create GUI view of type: " + strType);
-				return pView;
+				CS_LOG_ERROR("Cannot create GUI view of type: " + in_template.m_type);
+				return nullptr;
 			}
 		}
 	}
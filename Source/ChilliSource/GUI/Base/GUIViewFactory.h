@@ -35,6 +35,8 @@
 #include <ChilliSource/Core/XML/XMLUtils.h>
 
 #include <functional>
+#include <unordered_map>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -74,6 +76,29 @@ namespace ChilliSource
             /// @return GUI View
             //--------------------------------------------------------
             static GUIViewUPtr CreateGUIViewFromScript(Core::StorageLocation ineStorageLocation, const std::string& instrScriptFile);
+            //--------------------------------------------------------
+            /// Converts a layout script to the cooked binary layout
+            /// format. Cooked layouts can be passed to
+            /// CreateGUIViewFromScript() in place of the XML and are
+            /// loaded without any XML or param dictionary parsing.
+            ///
+            /// @param The storage location of the layout script.
+            /// @param The file path of the layout script.
+            /// @param The storage location to write the cooked layout.
+            /// @param The file path to write the cooked layout.
+            ///
+            /// @return Whether or not the layout was cooked.
+            //--------------------------------------------------------
+            static bool CookLayout(Core::StorageLocation in_sourceLocation, const std::string& in_sourcePath, Core::StorageLocation in_destLocation, const std::string& in_destPath);
+            //--------------------------------------------------------
+            /// Layouts are only read from file the first time they
+            /// are created; afterwards views are created from the
+            /// cached copy of the layout. This releases all cached
+            /// layouts, for example on receiving a memory warning or
+            /// when the layout files have changed. The content
+            /// management system calls this whenever it installs DLC.
+            //--------------------------------------------------------
+            static void ClearLayoutCache();
 			//--------------------------------------------------------
             /// Create GUI View 
             ///
@@ -109,20 +134,80 @@ namespace ChilliSource
 #endif
 			}
         private:
+            //--------------------------------------------------------
+            /// A view description read from a layout file, from which
+            /// any number of views can be created.
+            //--------------------------------------------------------
+            struct LayoutTemplate
+            {
+                std::string m_type;
+                Core::ParamDictionary m_params;
+                bool m_isExtern = false;
+                Core::StorageLocation m_sourceLocation = Core::StorageLocation::k_none;
+                std::string m_sourcePath;
+                std::vector<LayoutTemplate> m_subviews;
+            };
+            typedef std::shared_ptr<const LayoutTemplate> LayoutTemplateCSPtr;
+            //--------------------------------------------------------
+            /// @param The storage location of the layout.
+            /// @param The file path of the layout.
+            ///
+            /// @return The root view template of the layout, read from
+            /// file if it is not already cached, or null if the layout
+            /// could not be read.
+            //--------------------------------------------------------
+            static LayoutTemplateCSPtr GetLayoutTemplate(Core::StorageLocation in_location, const std::string& in_filePath);
+            //--------------------------------------------------------
+            /// Reads the root view template from a layout file, which
+            /// may be either a layout script or a cooked layout.
+            ///
+            /// @param The storage location of the layout.
+            /// @param The file path of the layout.
+            ///
+            /// @return The root view template, or null if the layout
+            /// could not be read.
+            //--------------------------------------------------------
+            static LayoutTemplateCSPtr ReadLayoutTemplate(Core::StorageLocation in_location, const std::string& in_filePath);
+            //--------------------------------------------------------
+            /// Recursive function used to read a view template and
+            /// its subviews from a layout script.
+            ///
+            /// @param View XML element
+            /// @param [Out] The view template.
+            //--------------------------------------------------------
+            static void ReadViewTemplate(Core::XML::Node* in_viewElement, LayoutTemplate& out_template);
+            //--------------------------------------------------------
+            /// Recursive function used to read a view template and
+            /// its subviews from a cooked layout.
+            ///
+            /// @param The reader.
+            /// @param [Out] The view template.
+            //--------------------------------------------------------
+            static void ReadViewTemplate(Core::BinaryReader& in_reader, LayoutTemplate& out_template);
+            //--------------------------------------------------------
+            /// Recursive function used to write a view template and
+            /// its subviews to a cooked layout.
+            ///
+            /// @param The view template.
+            /// @param The output writer.
+            //--------------------------------------------------------
+            static void WriteViewTemplate(const LayoutTemplate& in_template, Core::BinaryWriter& in_writer);
             //--------------------------------------------------------
             /// Create View
             ///
             /// Recursive function used to create subviews
             ///
-            /// @param View XML element
+            /// @param View template
             /// @return Created view
             //--------------------------------------------------------
-            static GUIViewUPtr CreateView(Core::XML::Node* ipViewElement);
+            static GUIViewUPtr CreateView(const LayoutTemplate& in_template);
             
         private:
             
             typedef std::unordered_map<std::string, GUIViewCreateDelegate> MapDelegateToString;
             static MapDelegateToString mmapDelegateToType;
+            
+            static std::unordered_map<std::string, LayoutTemplateCSPtr> s_layoutCache;
         };
     }
 }
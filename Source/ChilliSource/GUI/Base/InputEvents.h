@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_GUI_INPUT_EVENTS_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Input/Pointer/Pointer.h>
 
@@ -39,7 +40,7 @@ namespace ChilliSource
 {
     namespace GUI
     {
-        typedef std::function<void(GUIView*, const Input::Pointer&)> GUIEventDelegate;
+        typedef Core::InlineDelegate<void(GUIView*, const Input::Pointer&)> GUIEventDelegate;
         
         class InputEvents
         {
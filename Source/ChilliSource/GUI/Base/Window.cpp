@@ -114,28 +114,18 @@ namespace ChilliSource
                 if (!UserInteraction)
                     return;
                 
-                mSubviewsCopy = mSubviews;
-                
                 mInputEvents.OnPointerDown(this, in_pointer, true);
                 
                 //We need to notify any subviews they get first dibs
-                for(GUIView::Subviews::reverse_iterator it = mSubviewsCopy.rbegin(); it != mSubviewsCopy.rend(); ++it)
+                if(DispatchPointerDownToSubviews(in_pointer, in_timestamp, in_inputType))
                 {
-                    if(((*it)->IsAcceptTouchesOutsideOfBoundsEnabled() || (*it)->Contains(in_pointer.GetPosition())))
-                    {
-                        if((*it)->OnPointerDown(in_pointer, in_timestamp, in_inputType))
-                        {
-                            //This means the touch has been consumed
-                            //and we should not notify anyone else
-                            mSubviewsCopy.clear();
-                            return;
-                        }
-                    }
+                    //This means the touch has been consumed
+                    //and we should not notify anyone else
+                    return;
                 }
                 
                 //If the touch has not been consumed we then notify
                 //the outside world
-                mSubviewsCopy.clear();
                 m_pointerDownEvent.NotifyConnections(in_pointer, in_timestamp, in_inputType);
             }
 		}
@@ -148,17 +138,15 @@ namespace ChilliSource
                 if (!UserInteraction)
                     return;
                 
-                mSubviewsCopy = mSubviews;
-                
                 mInputEvents.OnPointerMoved(this, in_pointer);
                 
                 //We need to notify any subviews they get first dibs
-                for(GUIView::Subviews::reverse_iterator it = mSubviewsCopy.rbegin(); it != mSubviewsCopy.rend(); ++it)
+                SubviewIterator subviews(this, true);
+                while(GUIView* pSubview = subviews.Next())
                 {
-                    (*it)->OnPointerMoved(in_pointer, in_timestamp);
+                    pSubview->OnPointerMoved(in_pointer, in_timestamp);
                 }
                 
-                mSubviewsCopy.clear();
                 m_pointerMovedEvent.NotifyConnections(in_pointer, in_timestamp);
             }
 		}
@@ -171,17 +159,15 @@ namespace ChilliSource
                 if (!UserInteraction)
                     return;
                 
-                mSubviewsCopy = mSubviews;
-                
                 mInputEvents.OnPointerUp(this, in_pointer);
                 
                 //We need to notify any subviews they get first dibs
-                for(GUIView::Subviews::reverse_iterator it = mSubviewsCopy.rbegin(); it != mSubviewsCopy.rend(); ++it)
+                SubviewIterator subviews(this, true);
+                while(GUIView* pSubview = subviews.Next())
                 {
-                    (*it)->OnPointerUp(in_pointer, in_timestamp, in_inputType);
+                    pSubview->OnPointerUp(in_pointer, in_timestamp, in_inputType);
                 }
                 
-                mSubviewsCopy.clear();
                 m_pointerUpEvent.NotifyConnections(in_pointer, in_timestamp, in_inputType);
             }
 		}
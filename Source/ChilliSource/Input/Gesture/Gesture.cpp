@@ -37,6 +37,42 @@ namespace ChilliSource
         CS_DEFINE_NAMEDTYPE(Gesture);
         //-------------------------------------------------------
         //-------------------------------------------------------
+        void Gesture::SetRegion(const Core::Rectangle& in_region)
+        {
+            m_hasRegion = true;
+            m_region = in_region;
+            
+            if (m_gestureSystem != nullptr)
+            {
+                m_gestureSystem->UpdateGestureRegion(this);
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Gesture::ClearRegion()
+        {
+            m_hasRegion = false;
+            m_regionPointers.clear();
+            
+            if (m_gestureSystem != nullptr)
+            {
+                m_gestureSystem->UpdateGestureRegion(this);
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        bool Gesture::HasRegion() const
+        {
+            return m_hasRegion;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        const Core::Rectangle& Gesture::GetRegion() const
+        {
+            return m_region;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
         bool Gesture::ResolveConflicts()
         {
             if (m_gestureSystem != nullptr)
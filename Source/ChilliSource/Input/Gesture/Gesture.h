@@ -31,8 +31,11 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/QueryableInterface.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Input/Pointer/Pointer.h>
 
+#include <vector>
+
 namespace ChilliSource
 {
     namespace Input
@@ -54,6 +57,32 @@ namespace ChilliSource
             /// @author Ian Copland
             //-------------------------------------------------------
             virtual ~Gesture() {};
+            //-------------------------------------------------------
+            /// Restricts the gesture to pointers which go down within
+            /// the given region. Events for other pointers are not
+            /// passed to the gesture at all, which is considerably
+            /// cheaper than the gesture rejecting them itself when
+            /// many gestures are registered. By default a gesture has
+            /// no region and receives all pointer events.
+            ///
+            /// @param The region, in the same space as pointer
+            /// positions.
+            //-------------------------------------------------------
+            void SetRegion(const Core::Rectangle& in_region);
+            //-------------------------------------------------------
+            /// Removes the region so that the gesture receives all
+            /// pointer events.
+            //-------------------------------------------------------
+            void ClearRegion();
+            //-------------------------------------------------------
+            /// @return Whether or not the gesture has a region.
+            //-------------------------------------------------------
+            bool HasRegion() const;
+            //-------------------------------------------------------
+            /// @return The region. This is only meaningful if the
+            /// gesture has a region.
+            //-------------------------------------------------------
+            const Core::Rectangle& GetRegion() const;
             
         protected:
             //-------------------------------------------------------
@@ -171,6 +200,9 @@ namespace ChilliSource
             
             GestureSystem* m_gestureSystem = nullptr;
             bool m_active = false;
+            bool m_hasRegion = false;
+            Core::Rectangle m_region;
+            std::vector<Pointer::Id> m_regionPointers;
         };
     }
 }
@@ -34,6 +34,8 @@
 #include <ChilliSource/Input/Gesture/Gesture.h>
 #include <ChilliSource/Input/Pointer/PointerSystem.h>
 
+#include <algorithm>
+
 #define CS_ENABLE_LEGACYGESTURECONSUMPTION
 #ifdef CS_ENABLE_LEGACYGESTURECONSUMPTION
 #include <ChilliSource/Core/State.h>
@@ -57,17 +59,15 @@ namespace ChilliSource
             ///
             /// @return Whether or not it exists.
             //-------------------------------------------------------
-            bool GestureExists(Core::concurrent_vector<GestureSPtr>& in_gestureList, const Gesture* in_gesture)
+            template <typename TGestureList> bool GestureExists(const TGestureList& in_gestureList, const Gesture* in_gesture)
             {
-                in_gestureList.lock();
-                for (const auto& gesturePair : in_gestureList)
+                for (const auto& entry : in_gestureList)
                 {
-                    if (gesturePair.get() == in_gesture)
+                    if (entry.m_gesture.get() == in_gesture)
                     {
                         return true;
                     }
                 }
-                in_gestureList.unlock();
                 return false;
             }
         }
@@ -89,59 +89,93 @@ namespace ChilliSource
         //--------------------------------------------------------
         void GestureSystem::AddGesture(const GestureSPtr& in_gesture)
         {
-            std::unique_lock<std::recursive_mutex> lock(m_mutex);
-            CS_ASSERT(GestureExists(m_gestures, in_gesture.get()) == false, "Cannot add a gesture that has already been added to the Gesture System.");
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            CS_ASSERT(GestureExists(m_gestures.read(), in_gesture.get()) == false, "Cannot add a gesture that has already been added to the Gesture System.");
+            
             in_gesture->SetGestureSystem(this);
-            m_gestures.push_back(in_gesture);
+            m_gestures.push_back(CreateEntry(in_gesture));
         }
         //--------------------------------------------------------
         //--------------------------------------------------------
         void GestureSystem::RemoveGesture(const Gesture* in_gesture)
         {
-            std::unique_lock<std::recursive_mutex> lock(m_mutex);
-            m_gestures.lock();
+            std::unique_lock<std::mutex> lock(m_mutex);
             
-            CS_ASSERT(GestureExists(m_gestures, in_gesture) == true, "Cannot remove a gesture that hasn't been added to the Gesture System.");
+            CS_ASSERT(GestureExists(m_gestures.read(), in_gesture) == true, "Cannot remove a gesture that hasn't been added to the Gesture System.");
             
-            for (auto it = m_gestures.begin(); it != m_gestures.end();)
+            m_gestures.remove_if([in_gesture](const GestureEntry& in_entry)
             {
-                if (it->get() == in_gesture)
-                {
-                    (*it)->SetGestureSystem(nullptr);
-                    m_gestures.erase(it);
-                    break;
-                }
-                else
+                if (in_entry.m_gesture.get() == in_gesture)
                 {
-                    ++it;
+                    in_entry.m_gesture->SetGestureSystem(nullptr);
+                    in_entry.m_gesture->m_regionPointers.clear();
+                    return true;
                 }
-            }
-            
-            m_gestures.unlock();
+                return false;
+            });
         }
         //--------------------------------------------------------
         //--------------------------------------------------------
         void GestureSystem::SetConflictResolutionDelegate(const ConflictResolutionDelegate& in_delegate)
         {
-            std::unique_lock<std::recursive_mutex> lock(m_mutex);
+            std::unique_lock<std::mutex> lock(m_mutex);
             m_conflictResolutionDelegate = in_delegate;
         }
         //--------------------------------------------------------
         //--------------------------------------------------------
+        GestureSystem::GestureEntry GestureSystem::CreateEntry(const GestureSPtr& in_gesture)
+        {
+            GestureEntry entry;
+            entry.m_gesture = in_gesture;
+            entry.m_hasRegion = in_gesture->HasRegion();
+            
+            if (entry.m_hasRegion == true)
+            {
+                const Core::Rectangle& region = in_gesture->GetRegion();
+                entry.m_regionMin = Core::Vector2(region.Left(), region.Bottom());
+                entry.m_regionMax = Core::Vector2(region.Right(), region.Top());
+            }
+            
+            return entry;
+        }
+        //--------------------------------------------------------
+        //--------------------------------------------------------
+        void GestureSystem::UpdateGestureRegion(const Gesture* in_gesture)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            m_gestures.update([in_gesture](std::vector<GestureEntry>& in_entries)
+            {
+                for (auto& entry : in_entries)
+                {
+                    if (entry.m_gesture.get() == in_gesture)
+                    {
+                        entry = CreateEntry(entry.m_gesture);
+                        break;
+                    }
+                }
+            });
+        }
+        //--------------------------------------------------------
+        //--------------------------------------------------------
         bool GestureSystem::ResolveConflicts(Gesture* in_gesture)
         {
-            std::unique_lock<std::recursive_mutex> lock(m_mutex);
-            m_gestures.lock();
+            std::unique_lock<std::mutex> lock(m_mutex);
+            ConflictResolutionDelegate conflictResolutionDelegate = m_conflictResolutionDelegate;
+            lock.unlock();
             
             bool canActivate = true;
             
-            if (m_conflictResolutionDelegate != nullptr)
+            if (conflictResolutionDelegate != nullptr)
             {
-                for (const auto& gesture : m_gestures)
+                auto gestures = m_gestures.read();
+                for (const auto& entry : gestures)
                 {
-                    if (gesture.get() != in_gesture && gesture->IsActive() == true)
+                    const GestureSPtr& gesture = entry.m_gesture;
+                    if (gesture.get() != in_gesture && gesture->m_gestureSystem == this && gesture->IsActive() == true)
                     {
-                        ConflictResult conflictResult = m_conflictResolutionDelegate(gesture.get(), in_gesture);
+                        ConflictResult conflictResult = conflictResolutionDelegate(gesture.get(), in_gesture);
                         
                         switch (conflictResult)
                         {
@@ -162,7 +196,6 @@ namespace ChilliSource
                 }
             }
             
-            m_gestures.unlock();
             return canActivate;
         }
         //--------------------------------------------------------
@@ -188,15 +221,20 @@ namespace ChilliSource
         //--------------------------------------------------------
         void GestureSystem::OnUpdate(f32 in_deltaTime)
         {
-            std::unique_lock<std::recursive_mutex> lock(m_mutex);
-            m_gestures.lock();
-            
-            for (const auto& gesture : m_gestures)
             {
-                gesture->OnUpdate(in_deltaTime);
+                auto gestures = m_gestures.read();
+                for (const auto& entry : gestures)
+                {
+                    if (entry.m_gesture->m_gestureSystem == this)
+                    {
+                        entry.m_gesture->OnUpdate(in_deltaTime);
+                    }
+                }
             }
             
-            m_gestures.unlock();
+            //Versions of the list retired while it was being read, such as by a gesture removed during
+            //an event, still hold a reference to the removed gestures until they are reclaimed.
+            m_gestures.reclaim();
         }
         //--------------------------------------------------------
         //--------------------------------------------------------
@@ -204,44 +242,85 @@ namespace ChilliSource
         {
             if (in_filter.IsFiltered() == false)
             {
-                std::unique_lock<std::recursive_mutex> lock(m_mutex);
-                m_gestures.lock();
+                const Core::Vector2 position = in_pointer.GetPosition();
                 
-                for (const auto& gesture : m_gestures)
+                auto gestures = m_gestures.read();
+                for (const auto& entry : gestures)
                 {
+                    Gesture* gesture = entry.m_gesture.get();
+                    if (gesture->m_gestureSystem != this)
+                    {
+                        continue;
+                    }
+                    
+                    if (entry.m_hasRegion == true)
+                    {
+                        if (position.x < entry.m_regionMin.x || position.y < entry.m_regionMin.y || position.x > entry.m_regionMax.x || position.y > entry.m_regionMax.y)
+                        {
+                            continue;
+                        }
+                        
+                        if (std::find(gesture->m_regionPointers.begin(), gesture->m_regionPointers.end(), in_pointer.GetId()) == gesture->m_regionPointers.end())
+                        {
+                            gesture->m_regionPointers.push_back(in_pointer.GetId());
+                        }
+                    }
+                    
                     gesture->OnPointerDown(in_pointer, in_timestamp, in_inputType);
                 }
-                
-                m_gestures.unlock();
             }
         }
         //--------------------------------------------------------
         //--------------------------------------------------------
         void GestureSystem::OnPointerMoved(const Pointer& in_pointer, f64 in_timestamp)
         {
-            std::unique_lock<std::recursive_mutex> lock(m_mutex);
-            m_gestures.lock();
-            
-            for (const auto& gesture : m_gestures)
+            auto gestures = m_gestures.read();
+            for (const auto& entry : gestures)
             {
+                Gesture* gesture = entry.m_gesture.get();
+                if (gesture->m_gestureSystem != this)
+                {
+                    continue;
+                }
+                
+                if (entry.m_hasRegion == true && std::find(gesture->m_regionPointers.begin(), gesture->m_regionPointers.end(), in_pointer.GetId()) == gesture->m_regionPointers.end())
+                {
+                    continue;
+                }
+                
                 gesture->OnPointerMoved(in_pointer, in_timestamp);
             }
-            
-            m_gestures.unlock();
         }
         //--------------------------------------------------------
         //--------------------------------------------------------
         void GestureSystem::OnPointerUp(const Pointer& in_pointer, f64 in_timestamp, Pointer::InputType in_inputType)
         {
-            std::unique_lock<std::recursive_mutex> lock(m_mutex);
-            m_gestures.lock();
-            
-            for (const auto& gesture : m_gestures)
+            auto gestures = m_gestures.read();
+            for (const auto& entry : gestures)
             {
+                Gesture* gesture = entry.m_gesture.get();
+                if (gesture->m_gestureSystem != this)
+                {
+                    continue;
+                }
+                
+                if (entry.m_hasRegion == true)
+                {
+                    auto pointerIt = std::find(gesture->m_regionPointers.begin(), gesture->m_regionPointers.end(), in_pointer.GetId());
+                    if (pointerIt == gesture->m_regionPointers.end())
+                    {
+                        continue;
+                    }
+                    
+                    //The pointer is only released once all of its inputs are up.
+                    if (in_pointer.GetActiveInputs().empty() == true)
+                    {
+                        gesture->m_regionPointers.erase(pointerIt);
+                    }
+                }
+                
                 gesture->OnPointerUp(in_pointer, in_timestamp, in_inputType);
             }
-            
-            m_gestures.unlock();
         }
         //--------------------------------------------------------
         //--------------------------------------------------------
@@ -249,15 +328,24 @@ namespace ChilliSource
         {
             if (in_filter.IsFiltered() == false)
             {
-                std::unique_lock<std::recursive_mutex> lock(m_mutex);
-                m_gestures.lock();
+                const Core::Vector2 position = in_pointer.GetPosition();
                 
-                for (const auto& gesture : m_gestures)
+                auto gestures = m_gestures.read();
+                for (const auto& entry : gestures)
                 {
+                    Gesture* gesture = entry.m_gesture.get();
+                    if (gesture->m_gestureSystem != this)
+                    {
+                        continue;
+                    }
+                    
+                    if (entry.m_hasRegion == true && (position.x < entry.m_regionMin.x || position.y < entry.m_regionMin.y || position.x > entry.m_regionMax.x || position.y > entry.m_regionMax.y))
+                    {
+                        continue;
+                    }
+                    
                     gesture->OnPointerScrolled(in_pointer, in_timestamp, in_delta);
                 }
-                
-                m_gestures.unlock();
             }
         }
         //-------------------------------------------------------
@@ -271,24 +359,22 @@ namespace ChilliSource
         //--------------------------------------------------------
         void GestureSystem::OnDestroy()
         {
-            std::unique_lock<std::recursive_mutex> lock(m_mutex);
-            m_gestures.lock();
-            
-            m_conflictResolutionDelegate = nullptr;
-            
             m_pointerScrolledConnection.reset();
             m_pointerUpConnection.reset();
             m_pointerMovedConnection.reset();
             m_pointerDownConnection.reset();
             
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            m_conflictResolutionDelegate = nullptr;
             
-            for (const auto& gesture : m_gestures)
+            for (const auto& entry : m_gestures.read())
             {
-                gesture->SetGestureSystem(nullptr);
+                entry.m_gesture->SetGestureSystem(nullptr);
+                entry.m_gesture->m_regionPointers.clear();
             }
             m_gestures.clear();
-            
-            m_gestures.unlock();
+            m_gestures.reclaim();
         }
     }
 }
@@ -30,13 +30,16 @@
 #define _CHILLISOURCE_INPUT_GESTURE_GESTURESYSTEM_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Container/concurrent_vector.h>
+#include <ChilliSource/Core/Container/rcu_vector.h>
 #include <ChilliSource/Core/Event/Event.h>
+#include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/System/StateSystem.h>
 #include <ChilliSource/Input/Pointer/Pointer.h>
 
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -48,6 +51,14 @@ namespace ChilliSource
         /// events. Gesture collision resolution can also be handled
         /// through this system.
         ///
+        /// Events are dispatched from an immutable snapshot of the
+        /// gesture list, which is copied and republished whenever a
+        /// gesture is added, removed or has its region changed.
+        /// Dispatch therefore never holds a lock while calling into
+        /// gestures, and gestures can safely be added or removed
+        /// from within an event. Gestures with a region are only
+        /// passed events for pointers which went down inside it.
+        ///
         /// @author Ian Copland
         //---------------------------------------------------------------
         class GestureSystem final : public Core::StateSystem
@@ -150,6 +161,34 @@ namespace ChilliSource
             //--------------------------------------------------------
             GestureSystem() = default;
             //--------------------------------------------------------
+            /// An entry in the gesture list. The bounds of
+            /// the gesture's region are cached so that gestures can
+            /// be rejected without calling into them.
+            //--------------------------------------------------------
+            struct GestureEntry
+            {
+                GestureSPtr m_gesture;
+                bool m_hasRegion;
+                Core::Vector2 m_regionMin;
+                Core::Vector2 m_regionMax;
+            };
+            //--------------------------------------------------------
+            /// Builds the snapshot entry for the given gesture from
+            /// its current region.
+            ///
+            /// @param The gesture.
+            ///
+            /// @return The entry.
+            //--------------------------------------------------------
+            static GestureEntry CreateEntry(const GestureSPtr& in_gesture);
+            //--------------------------------------------------------
+            /// Called by a gesture when its region changes so that
+            /// the cached bounds in the snapshot can be updated.
+            ///
+            /// @param The gesture.
+            //--------------------------------------------------------
+            void UpdateGestureRegion(const Gesture* in_gesture);
+            //--------------------------------------------------------
             /// Process all deferred additions and removals to and
             /// from the gesture list.
             ///
@@ -258,8 +297,8 @@ namespace ChilliSource
             //--------------------------------------------------------
             void OnDestroy() override;
             
-            std::recursive_mutex m_mutex;
-            Core::concurrent_vector<GestureSPtr> m_gestures;
+            std::mutex m_mutex;
+            Core::rcu_vector<GestureEntry> m_gestures;
             
             ConflictResolutionDelegate m_conflictResolutionDelegate;
 
@@ -50,6 +50,14 @@ namespace ChilliSource
 {
     namespace Input
     {
+        namespace
+        {
+            const u32 k_eventRingSize = 256;
+            const u32 k_eventRingIndexMask = k_eventRingSize - 1;
+            
+            static_assert((k_eventRingSize & k_eventRingIndexMask) == 0, "The event ring size must be a power of two.");
+        }
+        
         CS_DEFINE_NAMEDTYPE(PointerSystem);
         //----------------------------------------------------
         //----------------------------------------------------
@@ -68,8 +76,12 @@ namespace ChilliSource
         //----------------------------------------------------
         //----------------------------------------------------
         PointerSystem::PointerSystem()
-            : m_nextUniqueId(0)
+            : m_eventRing(new PointerEventRecord[k_eventRingSize]), m_eventWriteIndex(0), m_eventReadIndex(0), m_hasOverflowEvents(false), m_nextUniqueId(0), m_isMoveCoalescingEnabled(false)
         {
+            for (u32 i = 0; i < k_eventRingSize; ++i)
+            {
+                m_eventRing[i].m_sequence.store(i, std::memory_order_relaxed);
+            }
         }
         //----------------------------------------------------
         //----------------------------------------------------
@@ -133,6 +145,32 @@ namespace ChilliSource
         }
         //----------------------------------------------------
         //----------------------------------------------------
+        void PointerSystem::SetMoveCoalescingEnabled(bool in_enabled)
+        {
+            m_isMoveCoalescingEnabled = in_enabled;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        bool PointerSystem::IsMoveCoalescingEnabled() const
+        {
+            return m_isMoveCoalescingEnabled;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        const std::vector<PointerSystem::PointerMoveSample>& PointerSystem::GetCoalescedMoves(Pointer::Id in_uniqueId) const
+        {
+            static const std::vector<PointerMoveSample> k_noMoves;
+            
+            auto it = m_coalescedMoves.find(in_uniqueId);
+            if (it != m_coalescedMoves.end())
+            {
+                return it->second;
+            }
+            
+            return k_noMoves;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
         bool PointerSystem::TryGetPointerWithId(Pointer::Id in_uniqueId, Pointer& out_pointer) const
         {
             for (const Pointer& pointer : m_pointers)
@@ -165,17 +203,12 @@ namespace ChilliSource
         //----------------------------------------------------
         void PointerSystem::ProcessQueuedInput()
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            std::queue<PointerEvent> eventQueue = m_eventQueue;
-            while (m_eventQueue.empty() == false)
-            {
-                m_eventQueue.pop();
-            }
-            lock.unlock();
+            PopEvents(m_pendingEvents);
             
-            while (eventQueue.empty() == false)
+            u32 index = 0;
+            while (index < m_pendingEvents.size())
             {
-                PointerEvent& event = eventQueue.front();
+                const PointerEvent& event = m_pendingEvents[index];
                 
                 switch (event.m_type)
                 {
@@ -186,8 +219,8 @@ namespace ChilliSource
                         PointerDown(event.m_pointerUniqueId, event.m_timestamp, event.m_InputType);
                         break;
                     case PointerEventType::k_move:
-                        PointerMoved(event.m_pointerUniqueId, event.m_timestamp, event.m_position);
-                        break;
+                        index = ProcessMoveEvents(index);
+                        continue;
                     case PointerEventType::k_up:
                         PointerUp(event.m_pointerUniqueId, event.m_timestamp, event.m_InputType);
                         break;
@@ -202,15 +235,15 @@ namespace ChilliSource
                         break;
                 }
                 
-                eventQueue.pop();
+                ++index;
             }
+            
+            m_pendingEvents.clear();
         }
         //----------------------------------------------------
         //----------------------------------------------------
         Pointer::Id PointerSystem::AddPointerCreateEvent(const Core::Vector2& in_position)
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
             PointerEvent event;
             event.m_type = PointerEventType::k_add;
             event.m_pointerUniqueId = m_nextUniqueId++;
@@ -218,7 +251,7 @@ namespace ChilliSource
             event.m_position = in_position;
             event.m_timestamp = 0.0;
             
-            m_eventQueue.push(event);
+            PushEvent(event);
             
             return event.m_pointerUniqueId;
         }
@@ -226,8 +259,6 @@ namespace ChilliSource
         //----------------------------------------------------
         void PointerSystem::AddPointerDownEvent(Pointer::Id in_pointerUniqueId, Pointer::InputType in_inputType)
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
             PointerEvent event;
             event.m_type = PointerEventType::k_down;
             event.m_pointerUniqueId = in_pointerUniqueId;
@@ -235,14 +266,12 @@ namespace ChilliSource
             event.m_position = Core::Vector2::k_zero;
             event.m_timestamp = ((f64)Core::Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
             
-            m_eventQueue.push(event);
+            PushEvent(event);
         }
         //----------------------------------------------------
         //----------------------------------------------------
         void PointerSystem::AddPointerMovedEvent(Pointer::Id in_pointerUniqueId, const Core::Vector2& in_position)
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
             PointerEvent event;
             event.m_type = PointerEventType::k_move;
             event.m_pointerUniqueId = in_pointerUniqueId;
@@ -250,14 +279,12 @@ namespace ChilliSource
             event.m_position = in_position;
             event.m_timestamp = ((f64)Core::Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
             
-            m_eventQueue.push(event);
+            PushEvent(event);
         }
         //----------------------------------------------------
         //----------------------------------------------------
         void PointerSystem::AddPointerUpEvent(Pointer::Id in_pointerUniqueId, Pointer::InputType in_inputType)
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
             PointerEvent event;
             event.m_type = PointerEventType::k_up;
             event.m_pointerUniqueId = in_pointerUniqueId;
@@ -265,14 +292,12 @@ namespace ChilliSource
             event.m_position = Core::Vector2::k_zero;
             event.m_timestamp = ((f64)Core::Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
             
-            m_eventQueue.push(event);
+            PushEvent(event);
         }
         //----------------------------------------------------
         //----------------------------------------------------
         void PointerSystem::AddPointerScrollEvent(Pointer::Id in_pointerUniqueId, const Core::Vector2& in_delta)
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
             PointerEvent event;
             event.m_type = PointerEventType::k_scroll;
             event.m_pointerUniqueId = in_pointerUniqueId;
@@ -280,14 +305,12 @@ namespace ChilliSource
             event.m_timestamp = ((f64)Core::Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
             event.m_position = in_delta;
             
-            m_eventQueue.push(event);
+            PushEvent(event);
         }
         //----------------------------------------------------
         //-----------------------------------------------------
         void PointerSystem::AddPointerRemoveEvent(Pointer::Id in_pointerUniqueId)
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
             PointerEvent event;
             event.m_type = PointerEventType::k_remove;
             event.m_pointerUniqueId = in_pointerUniqueId;
@@ -295,22 +318,155 @@ namespace ChilliSource
             event.m_position = Core::Vector2::k_zero;
             event.m_timestamp = 0.0;
             
-            m_eventQueue.push(event);
+            PushEvent(event);
         }
         //----------------------------------------------------
         //----------------------------------------------------
         void PointerSystem::RemoveAllPointers()
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
+            std::vector<PointerEvent> discardedEvents;
+            PopEvents(discardedEvents);
+            
+            std::unique_lock<std::mutex> lock(m_overflowMutex);
+            m_overflowEvents.clear();
+            m_hasOverflowEvents.store(false, std::memory_order_release);
+            lock.unlock();
             
-            while (m_eventQueue.empty() == false)
+            m_pointers.clear();
+            m_coalescedMoves.clear();
+        }
+        //----------------------------------------------------
+        //-----------------------------------------------------
+        void PointerSystem::PushEvent(const PointerEvent& in_event)
+        {
+            //Once an event has overflowed, all following events must also go to the overflow list
+            //until it has been processed, otherwise they could be processed out of order.
+            if (m_hasOverflowEvents.load(std::memory_order_acquire) == false && TryPushEventToRing(in_event) == true)
             {
-                m_eventQueue.pop();
+                return;
             }
             
-            lock.unlock();
+            std::unique_lock<std::mutex> lock(m_overflowMutex);
+            m_overflowEvents.push_back(in_event);
+            m_hasOverflowEvents.store(true, std::memory_order_release);
+        }
+        //----------------------------------------------------
+        //-----------------------------------------------------
+        bool PointerSystem::TryPushEventToRing(const PointerEvent& in_event)
+        {
+            u32 writeIndex = m_eventWriteIndex.load(std::memory_order_relaxed);
+            PointerEventRecord* record = nullptr;
+            while (true)
+            {
+                record = &m_eventRing[writeIndex & k_eventRingIndexMask];
+                const s32 difference = (s32)(record->m_sequence.load(std::memory_order_acquire) - writeIndex);
+                if (difference == 0)
+                {
+                    if (m_eventWriteIndex.compare_exchange_weak(writeIndex, writeIndex + 1, std::memory_order_relaxed) == true)
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    writeIndex = m_eventWriteIndex.load(std::memory_order_relaxed);
+                }
+            }
             
-            m_pointers.clear();
+            record->m_event = in_event;
+            record->m_sequence.store(writeIndex + 1, std::memory_order_release);
+            return true;
+        }
+        //----------------------------------------------------
+        //-----------------------------------------------------
+        void PointerSystem::PopEvents(std::vector<PointerEvent>& out_events)
+        {
+            //The overflow lock is held while reading the ring so that a producer cannot add to the
+            //overflow list between the ring being read and the overflow list being taken.
+            std::unique_lock<std::mutex> lock(m_overflowMutex);
+            
+            while (true)
+            {
+                PointerEventRecord& record = m_eventRing[m_eventReadIndex & k_eventRingIndexMask];
+                if (record.m_sequence.load(std::memory_order_acquire) != m_eventReadIndex + 1)
+                {
+                    break;
+                }
+                
+                out_events.push_back(record.m_event);
+                record.m_sequence.store(m_eventReadIndex + k_eventRingSize, std::memory_order_release);
+                ++m_eventReadIndex;
+            }
+            
+            //If a producer is still writing to the ring, the overflow events must wait until the
+            //next frame so that they are processed after it.
+            if (m_hasOverflowEvents.load(std::memory_order_relaxed) == true && m_eventWriteIndex.load(std::memory_order_acquire) == m_eventReadIndex)
+            {
+                out_events.insert(out_events.end(), m_overflowEvents.begin(), m_overflowEvents.end());
+                m_overflowEvents.clear();
+                m_hasOverflowEvents.store(false, std::memory_order_release);
+            }
+        }
+        //----------------------------------------------------
+        //-----------------------------------------------------
+        u32 PointerSystem::ProcessMoveEvents(u32 in_startIndex)
+        {
+            u32 endIndex = in_startIndex;
+            while (endIndex < m_pendingEvents.size() && m_pendingEvents[endIndex].m_type == PointerEventType::k_move)
+            {
+                ++endIndex;
+            }
+            
+            if (m_isMoveCoalescingEnabled == false)
+            {
+                for (u32 i = in_startIndex; i < endIndex; ++i)
+                {
+                    const PointerEvent& event = m_pendingEvents[i];
+                    auto& moves = m_coalescedMoves[event.m_pointerUniqueId];
+                    moves.clear();
+                    moves.push_back(PointerMoveSample{event.m_position, event.m_timestamp});
+                    PointerMoved(event.m_pointerUniqueId, event.m_timestamp, event.m_position);
+                }
+                
+                return endIndex;
+            }
+            
+            //Gather the moves for each pointer in a single pass, recording the order in which the
+            //pointers first moved and the index of each pointer's last move.
+            m_moveRunPointerIds.clear();
+            m_moveRunLastIndices.clear();
+            for (u32 i = in_startIndex; i < endIndex; ++i)
+            {
+                const PointerEvent& event = m_pendingEvents[i];
+                auto& moves = m_coalescedMoves[event.m_pointerUniqueId];
+                
+                auto lastIndexIt = m_moveRunLastIndices.find(event.m_pointerUniqueId);
+                if (lastIndexIt == m_moveRunLastIndices.end())
+                {
+                    moves.clear();
+                    m_moveRunPointerIds.push_back(event.m_pointerUniqueId);
+                    m_moveRunLastIndices.emplace(event.m_pointerUniqueId, i);
+                }
+                else
+                {
+                    lastIndexIt->second = i;
+                }
+                
+                moves.push_back(PointerMoveSample{event.m_position, event.m_timestamp});
+            }
+            
+            //Each pointer is dispatched once with the position and timestamp of its last move.
+            for (Pointer::Id uniqueId : m_moveRunPointerIds)
+            {
+                const PointerEvent& event = m_pendingEvents[m_moveRunLastIndices[uniqueId]];
+                PointerMoved(uniqueId, event.m_timestamp, event.m_position);
+            }
+            
+            return endIndex;
         }
         //----------------------------------------------------
         //-----------------------------------------------------
@@ -487,6 +643,7 @@ namespace ChilliSource
             CS_ASSERT(filteredInputIt != m_filteredPointerInput.end(), "Filtered input doesn't exist!");
             
             m_filteredPointerInput.erase(filteredInputIt);
+            m_coalescedMoves.erase(in_uniqueId);
             
             //remove the pointer.
             auto pointerIt = std::find_if(m_pointers.begin(), m_pointers.end(), [in_uniqueId](const Pointer& in_pointer)
@@ -30,15 +30,19 @@
 #define _CHILLISOURCE_INPUT_POINTER_POINTERSYSTEM_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Input/Pointer/Pointer.h>
 
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -49,6 +53,14 @@ namespace ChilliSource
         /// pointer devices. Pointers include touches on a touch
         /// screen and the mouse on a PC.
         ///
+        /// Events received from the OS are pushed into a lock-free
+        /// ring buffer and dispatched on the main thread the next
+        /// time ProcessQueuedInput() is called. Consecutive move
+        /// events for a pointer within a frame can optionally be
+        /// coalesced into a single pointer moved event; the
+        /// individual moves can still be accessed through
+        /// GetCoalescedMoves().
+        ///
         /// @author Ian Copland
         //--------------------------------------------------------
         class PointerSystem : public Core::AppSystem
@@ -67,7 +79,7 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
             //----------------------------------------------------
-            using PointerDownDelegate = std::function<void(const Pointer&, f64, Pointer::InputType)>;
+            using PointerDownDelegate = Core::InlineDelegate<void(const Pointer&, f64, Pointer::InputType)>;
             //----------------------------------------------------
             /// A delegate that is used to receive pointer moved
             /// events. This could be dragging a touch on screen
@@ -78,7 +90,7 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
             //----------------------------------------------------
-            using PointerMovedDelegate = std::function<void(const Pointer&, f64)>;
+            using PointerMovedDelegate = Core::InlineDelegate<void(const Pointer&, f64)>;
             //----------------------------------------------------
             /// A delegate that is used to receive pointer up
             /// events. This could be releasing a mouse button or
@@ -90,7 +102,7 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
             //----------------------------------------------------
-            using PointerUpDelegate = std::function<void(const Pointer&, f64, Pointer::InputType)>;
+            using PointerUpDelegate = Core::InlineDelegate<void(const Pointer&, f64, Pointer::InputType)>;
             //----------------------------------------------------
             /// A delegate that is used to receive pointer scroll events
             /// (i.e. mouse wheel).
@@ -101,7 +113,15 @@ namespace ChilliSource
             ///
             /// @author Scott Downie
             //----------------------------------------------------
-            using PointerScrollDelegate = std::function<void(const Pointer&, f64, const Core::Vector2&)>;
+            using PointerScrollDelegate = Core::InlineDelegate<void(const Pointer&, f64, const Core::Vector2&)>;
+            //----------------------------------------------------
+            /// A single move of a pointer as received from the OS.
+            //----------------------------------------------------
+            struct PointerMoveSample
+            {
+                Core::Vector2 m_position;
+                f64 m_timestamp;
+            };
             //----------------------------------------------------
             /// Creates a new platfrom specific instance of pointer
             /// system.
@@ -206,6 +226,36 @@ namespace ChilliSource
             //----------------------------------------------------
             std::vector<Pointer> GetPointers() const;
             //----------------------------------------------------
+            /// Sets whether or not consecutive move events for the
+            /// same pointer should be coalesced into a single
+            /// pointer moved event. Moves are only coalesced up to
+            /// the next down, up, scroll, add or remove event, so
+            /// the order of events is unaffected. This is disabled
+            /// by default, as listeners which need the path of the
+            /// pointer must then read it from GetCoalescedMoves().
+            ///
+            /// @param Whether or not moves should be coalesced.
+            //----------------------------------------------------
+            void SetMoveCoalescingEnabled(bool in_enabled);
+            //----------------------------------------------------
+            /// @return Whether or not moves are coalesced.
+            //----------------------------------------------------
+            bool IsMoveCoalescingEnabled() const;
+            //----------------------------------------------------
+            /// Returns the individual moves, in order, that made
+            /// up the most recent pointer moved event for the
+            /// given pointer. This is intended for listeners that
+            /// need the full path of the pointer, and should be
+            /// called from a pointer moved delegate. If moves are
+            /// not coalesced this only contains the latest move.
+            ///
+            /// @param The unique Id of the pointer.
+            ///
+            /// @return The move samples. This is empty if the
+            /// pointer has not moved.
+            //----------------------------------------------------
+            const std::vector<PointerMoveSample>& GetCoalescedMoves(Pointer::Id in_uniqueId) const;
+            //----------------------------------------------------
             /// Hide the pointer cursor if one exists
             ///
             /// @author S Downie
@@ -339,6 +389,53 @@ namespace ChilliSource
                 f64 m_timestamp;
             };
             //----------------------------------------------------
+            /// A single event in the ring buffer. The sequence
+            /// number tells producers and the main thread which of
+            /// them currently owns the record.
+            //----------------------------------------------------
+            struct PointerEventRecord
+            {
+                std::atomic<u32> m_sequence;
+                PointerEvent m_event;
+            };
+            //----------------------------------------------------
+            /// Adds an event to the ring buffer. If the ring buffer
+            /// is full the event is added to the overflow list
+            /// instead, so events are never dropped. This is
+            /// thread safe and can be called on any thread.
+            ///
+            /// @param The event.
+            //-----------------------------------------------------
+            void PushEvent(const PointerEvent& in_event);
+            //----------------------------------------------------
+            /// Tries to add an event to the ring buffer without
+            /// locking.
+            ///
+            /// @param The event.
+            ///
+            /// @return Whether or not there was space for the event.
+            //-----------------------------------------------------
+            bool TryPushEventToRing(const PointerEvent& in_event);
+            //----------------------------------------------------
+            /// Removes all pending events from the ring buffer and
+            /// overflow list, in the order they were added. This
+            /// must be called from the main thread.
+            ///
+            /// @param [Out] The list to append the events to.
+            //-----------------------------------------------------
+            void PopEvents(std::vector<PointerEvent>& out_events);
+            //----------------------------------------------------
+            /// Dispatches the run of consecutive move events that
+            /// starts at the given index in the pending events,
+            /// coalescing them per pointer if enabled.
+            ///
+            /// @param The index of the first move event.
+            ///
+            /// @return The index after the last move event in the
+            /// run.
+            //-----------------------------------------------------
+            u32 ProcessMoveEvents(u32 in_startIndex);
+            //----------------------------------------------------
             /// Creates and adds a new pointer to the list.
             ///
             /// @author Ian Copland
@@ -421,7 +518,7 @@ namespace ChilliSource
             ///
             /// @author S Downie
             //----------------------------------------------------
-            using PointerDownDelegateInternal = std::function<void(const Pointer&, f64, Pointer::InputType, Filter&)>;
+            using PointerDownDelegateInternal = Core::InlineDelegate<void(const Pointer&, f64, Pointer::InputType, Filter&)>;
             //----------------------------------------------------
             /// A delegate that is used to receive pointer scroll
             /// events (i.e. mouse wheel).
@@ -433,7 +530,7 @@ namespace ChilliSource
             ///
             /// @author S Downie
             //----------------------------------------------------
-            using PointerScrollDelegateInternal = std::function<void(const Pointer&, f64, const Core::Vector2&, Filter&)>;
+            using PointerScrollDelegateInternal = Core::InlineDelegate<void(const Pointer&, f64, const Core::Vector2&, Filter&)>;
             //----------------------------------------------------
             /// Event that is triggered when the pointer is first down.
             ///
@@ -464,10 +561,21 @@ namespace ChilliSource
             Core::Event<PointerDownDelegateInternal> m_pointerDownEventInternal;
             Core::Event<PointerScrollDelegateInternal> m_pointerScrolledEventInternal;
             
-            std::mutex m_mutex;
+            std::unique_ptr<PointerEventRecord[]> m_eventRing;
+            std::atomic<u32> m_eventWriteIndex;
+            u32 m_eventReadIndex;
+            std::mutex m_overflowMutex;
+            std::vector<PointerEvent> m_overflowEvents;
+            std::atomic<bool> m_hasOverflowEvents;
+            std::vector<PointerEvent> m_pendingEvents;
+            
             std::vector<Pointer> m_pointers;
-            std::queue<PointerEvent> m_eventQueue;
-            Pointer::Id m_nextUniqueId;
+            std::atomic<Pointer::Id> m_nextUniqueId;
+            
+            bool m_isMoveCoalescingEnabled;
+            std::unordered_map<Pointer::Id, std::vector<PointerMoveSample>> m_coalescedMoves;
+            std::vector<Pointer::Id> m_moveRunPointerIds;
+            std::unordered_map<Pointer::Id, u32> m_moveRunLastIndices;
             
             std::unordered_map<Pointer::Id, std::set<Pointer::InputType>> m_filteredPointerInput;
         };
@@ -35,10 +35,25 @@
 #include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/File/FileStream.h>
 #include <ChilliSource/Core/File/AppDataStore.h>
+#include <ChilliSource/Core/String/StringParser.h>
+#include <ChilliSource/Core/String/ToString.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/GUI/Base/GUIViewFactory.h>
 
+#include <md5/md5.h>
 #include <minizip/unzip.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
 namespace ChilliSource
 {
     namespace Networking
@@ -46,6 +61,32 @@ namespace ChilliSource
         namespace
         {
             const std::string k_adsKeyHasCached = "_CMSCachedDLC";
+            const u32 k_journalChunkSize = 64 * 1024;
+            const u32 k_extractBufferSize = 64 * 1024;
+            const u32 k_largeFileSize = 1024 * 1024;
+            const std::string k_checksumCacheFilePath = "ContentChecksums.cache";
+            const std::string k_stagingDirectory = "Staging";
+            
+            //--------------------------------------------------------
+            /// @param The package id.
+            ///
+            /// @return The path to the temp file the package is
+            /// downloaded to.
+            //--------------------------------------------------------
+            std::string GetPackageFilePath(const std::string& in_packageId)
+            {
+                return "Temp/" + in_packageId + ".packzip";
+            }
+            //--------------------------------------------------------
+            /// @param The package id.
+            ///
+            /// @return The path to the journal recording the checksum
+            /// of each chunk of the package downloaded so far.
+            //--------------------------------------------------------
+            std::string GetJournalFilePath(const std::string& in_packageId)
+            {
+                return "Temp/" + in_packageId + ".packjournal";
+            }
             
             //--------------------------------------------------------
             /// @author S Downie
@@ -88,7 +129,319 @@ namespace ChilliSource
                 
                 return "";
             }
+            //--------------------------------------------------------
+            /// @param The absolute path to a file.
+            /// @param [Out] The size of the file.
+            /// @param [Out] The last modification time of the file in
+            /// nanoseconds, where the platform provides it, so that
+            /// a file rewritten within the same second is noticed.
+            ///
+            /// @return Whether the file exists.
+            //--------------------------------------------------------
+            bool GetFileStats(const std::string& in_absolutePath, u32& out_size, s64& out_modifiedTime)
+            {
+                struct stat fileStats;
+                if(stat(in_absolutePath.c_str(), &fileStats) != 0)
+                {
+                    return false;
+                }
+                
+                out_size = (u32)fileStats.st_size;
+#if defined(CS_TARGETPLATFORM_IOS)
+                out_modifiedTime = (s64)fileStats.st_mtimespec.tv_sec * 1000000000 + (s64)fileStats.st_mtimespec.tv_nsec;
+#elif defined(CS_TARGETPLATFORM_ANDROID)
+                out_modifiedTime = (s64)fileStats.st_mtime * 1000000000 + (s64)fileStats.st_mtime_nsec;
+#else
+                out_modifiedTime = (s64)fileStats.st_mtime * 1000000000;
+#endif
+                return true;
+            }
+            //--------------------------------------------------------
+            /// Lists the directories that the files in the given zip
+            /// are extracted to.
+            ///
+            /// @param The absolute path to the zip.
+            /// @param [Out] The directory paths. Paths are added to
+            /// any already in the set.
+            ///
+            /// @return Whether the zip could be read.
+            //--------------------------------------------------------
+            bool GetDirectoryPathsInZip(const std::string& in_zipFilePath, std::set<std::string>& out_directoryPaths)
+            {
+                unzFile zippedFile = unzOpen(in_zipFilePath.c_str());
+                if(!zippedFile)
+                {
+                    return false;
+                }
+                
+                const u32 k_filenameLength = 256;
+                s8 fileName[k_filenameLength];
+                
+                bool success = true;
+                s32 status = unzGoToFirstFile(zippedFile);
+                while(status == UNZ_OK)
+                {
+                    unz_file_info fileInfo;
+                    if(unzGetCurrentFileInfo(zippedFile, &fileInfo, fileName, k_filenameLength, nullptr, 0, nullptr, 0) != UNZ_OK)
+                    {
+                        success = false;
+                        break;
+                    }
+                    
+                    std::string filePath(fileName);
+                    if(ContainsDirectoryPath(filePath))
+                    {
+                        out_directoryPaths.insert(GetPathExcludingFileName(filePath));
+                    }
+                    
+                    status = unzGoToNextFile(zippedFile);
+                }
+                
+                unzClose(zippedFile);
+                return success;
+            }
+            //--------------------------------------------------------
+            /// Extracts the current file in the zip to the staging
+            /// directory, streaming it through the given buffer. If
+            /// the file has a known checksum it is verified as the
+            /// file is written. The directory the file is extracted
+            /// to must already exist.
+            ///
+            /// @param The zip positioned at the file to extract.
+            /// @param The checksums of the files, keyed by path.
+            /// @param A buffer of k_extractBufferSize bytes.
+            /// @param [Out] The path of the file relative to the
+            /// staging directory.
+            ///
+            /// @return Whether the file was successfully extracted.
+            //--------------------------------------------------------
+            bool ExtractCurrentFile(unzFile in_zippedFile, const std::unordered_map<std::string, std::string>& in_fileChecksums, s8* in_buffer, std::string& out_filePath)
+            {
+                const u32 k_filenameLength = 256;
+                s8 fileName[k_filenameLength];
+                
+                unz_file_info fileInfo;
+                if(unzGetCurrentFileInfo(in_zippedFile, &fileInfo, fileName, k_filenameLength, nullptr, 0, nullptr, 0) != UNZ_OK)
+                {
+                    return false;
+                }
+                
+                std::string filePath(fileName);
+                out_filePath = filePath;
+                
+                if(IsFile(filePath) == false)
+                {
+                    return true;
+                }
+                
+                if(unzOpenCurrentFile(in_zippedFile) != UNZ_OK)
+                {
+                    CS_LOG_ERROR("CMS: Cannot open file in content package: " + filePath);
+                    return false;
+                }
+                
+                Core::FileStreamUPtr fileStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(Core::StorageLocation::k_DLC, k_stagingDirectory + "/" + filePath, Core::FileMode::k_writeBinary);
+                bool success = (fileStream != nullptr && fileStream->IsBad() == false);
+                
+                MD5 hash;
+                s32 bytesRead = 0;
+                while(success == true && (bytesRead = unzReadCurrentFile(in_zippedFile, in_buffer, k_extractBufferSize)) > 0)
+                {
+                    fileStream->Write(in_buffer, bytesRead);
+                    hash.update(in_buffer, (u32)bytesRead);
+                }
+                
+                //Closing the file also checks the CRC stored in the zip
+                if(bytesRead < 0 || unzCloseCurrentFile(in_zippedFile) != UNZ_OK)
+                {
+                    success = false;
+                }
+                fileStream.reset();
+                
+                auto checksumIt = in_fileChecksums.find(filePath);
+                if(success == true && checksumIt != in_fileChecksums.end())
+                {
+                    std::string checksum = Core::BaseEncoding::Base64Encode(hash.finalize().binarydigest());
+                    Core::StringUtils::ChopTrailingChars(checksum, '=');
+                    success = (checksum == checksumIt->second);
+                }
+                
+                if(success == false)
+                {
+                    CS_LOG_ERROR("CMS: Failed to extract file from content package: " + filePath);
+                }
+                return success;
+            }
         }
+        //--------------------------------------------------------
+        /// The state of a single package download. Chunks of the
+        /// package are streamed to a temp file and added to the
+        /// running checksum as they arrive, which may be on a
+        /// background thread, so access is guarded by the mutex.
+        /// The checksum of every complete journal chunk is recorded
+        /// in the journal so that an interrupted download can be
+        /// verified and resumed.
+        /// Downloads are shared with the downloader callback so
+        /// that late callbacks for cancelled downloads are safe.
+        //--------------------------------------------------------
+        struct ContentManagementSystem::PackageDownload
+        {
+            //--------------------------------------------------------
+            /// Appends a chunk of the package to the temp file and
+            /// the running checksum, unless the download has been
+            /// cancelled.
+            ///
+            /// @param The chunk of the package.
+            //--------------------------------------------------------
+            void Write(const std::string& in_data)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_isCancelled == true || m_fileStream == nullptr || in_data.empty() == true)
+                {
+                    return;
+                }
+                
+                m_fileStream->Write(in_data.data(), (s32)in_data.size());
+                m_hash.update(in_data.data(), in_data.size());
+                m_bytesWritten += in_data.size();
+                
+                u32 offset = 0;
+                while (offset < in_data.size())
+                {
+                    u32 size = std::min((u32)in_data.size() - offset, k_journalChunkSize - m_chunkSize);
+                    m_chunkHash.update(in_data.data() + offset, size);
+                    m_chunkSize += size;
+                    offset += size;
+                    
+                    if (m_chunkSize == k_journalChunkSize)
+                    {
+                        //The package data is flushed first so the journal never refers to data which hasn't been written.
+                        m_fileStream->Flush();
+                        m_journalStream->Write(m_chunkHash.finalize().hexdigest() + "\n");
+                        m_journalStream->Flush();
+                        
+                        m_chunkHash = MD5();
+                        m_chunkSize = 0;
+                    }
+                }
+            }
+            //--------------------------------------------------------
+            /// Discards any data already written, including resumed
+            /// data, and starts a new temp file and journal. This is
+            /// used when the server sends the whole package in
+            /// response to a request to resume it.
+            //--------------------------------------------------------
+            void Restart()
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_isCancelled == true)
+                {
+                    return;
+                }
+                
+                Core::FileSystem* fileSystem = Core::Application::Get()->GetFileSystem();
+                m_fileStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, GetPackageFilePath(m_packageId), Core::FileMode::k_writeBinary);
+                m_journalStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, GetJournalFilePath(m_packageId), Core::FileMode::k_write);
+                if (m_fileStream == nullptr || m_fileStream->IsBad() == true || m_journalStream == nullptr || m_journalStream->IsBad() == true)
+                {
+                    //Nothing further is written, so the package checksum will fail
+                    m_fileStream.reset();
+                    m_journalStream.reset();
+                }
+                else
+                {
+                    m_journalStream->Write(m_packageChecksum + "\n");
+                    m_journalStream->Flush();
+                }
+                
+                m_hash = MD5();
+                m_chunkHash = MD5();
+                m_chunkSize = 0;
+                m_bytesWritten = 0;
+            }
+            //--------------------------------------------------------
+            /// Closes the temp file and stops any further chunks from
+            /// being written.
+            //--------------------------------------------------------
+            void Cancel()
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_isCancelled = true;
+                m_fileStream.reset();
+                m_journalStream.reset();
+            }
+            //--------------------------------------------------------
+            /// @return Whether the download has been cancelled.
+            //--------------------------------------------------------
+            bool IsCancelled()
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                return m_isCancelled;
+            }
+            
+            u32 m_packageIndex = 0;
+            std::string m_packageId;
+            std::string m_packageChecksum;
+            u32 m_resumeOffset = 0;
+            std::atomic<u32> m_bytesWritten{0};
+            Core::FileStreamUPtr m_fileStream;
+            Core::FileStreamUPtr m_journalStream;
+            MD5 m_hash;
+            MD5 m_chunkHash;
+            u32 m_chunkSize = 0;
+            std::mutex m_mutex;
+            bool m_isCancelled = false;
+        };
+        
+        //--------------------------------------------------------
+        /// The state of an install shared by the extraction tasks.
+        //--------------------------------------------------------
+        struct ContentManagementSystem::InstallState
+        {
+            CompleteDelegate m_delegate;
+            Core::XMLSPtr m_serverManifest;
+            std::vector<std::string> m_removePackageIds;
+            std::vector<std::string> m_installPackageIds;
+            std::set<std::string> m_directoryPaths;
+            std::unordered_map<std::string, std::string> m_fileChecksums;
+            std::atomic<u32> m_numPendingTasks;
+            std::atomic<bool> m_succeeded;
+            
+            std::mutex m_extractedFilesMutex;
+            std::vector<std::string> m_extractedFilePaths;
+            std::vector<std::string> m_verifiedFilePaths;
+            
+            //--------------------------------------------------------
+            /// Records the result of extracting a file. This is
+            /// thread-safe.
+            ///
+            /// @param The path of the file.
+            /// @param Whether the file was successfully extracted.
+            //--------------------------------------------------------
+            void OnFileExtracted(const std::string& in_filePath, bool in_success)
+            {
+                if(in_success == false)
+                {
+                    m_succeeded = false;
+                }
+                else if(IsFile(in_filePath) == true)
+                {
+                    std::unique_lock<std::mutex> lock(m_extractedFilesMutex);
+                    m_extractedFilePaths.push_back(in_filePath);
+                    
+                    if(m_fileChecksums.find(in_filePath) != m_fileChecksums.end())
+                    {
+                        m_verifiedFilePaths.push_back(in_filePath);
+                    }
+                }
+            }
+            
+            InstallState()
+                : m_numPendingTasks(0), m_succeeded(true)
+            {
+            }
+        };
+        
         CS_DEFINE_NAMEDTYPE(ContentManagementSystem);
         //--------------------------------------------------------
         //--------------------------------------------------------
@@ -100,7 +453,8 @@ namespace ChilliSource
         //-----------------------------------------------------------
         ContentManagementSystem::ContentManagementSystem(IContentDownloader* in_contentDownloader)
             : m_contentDownloader(in_contentDownloader), m_serverManifest(nullptr),  m_runningToDownloadTotal(0),
-            m_runningDownloadedTotal(0), m_dlcCachePurged(false)
+            m_runningDownloadedTotal(0), m_nextPackageDownload(0), m_numPackagesDownloaded(0), m_maxConcurrentDownloads(1), m_isChecksumCacheLoaded(false),
+            m_isChecksumCacheDirty(false), m_dlcCachePurged(false)
         {
         }
         //------------------------------------------------------------
@@ -160,6 +514,13 @@ namespace ChilliSource
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
+        void ContentManagementSystem::SetMaxConcurrentDownloads(u32 in_maxConcurrentDownloads)
+        {
+            CS_ASSERT(in_maxConcurrentDownloads > 0, "CMS: The maximum number of concurrent downloads must be greater than 0.");
+            m_maxConcurrentDownloads = in_maxConcurrentDownloads;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
         void ContentManagementSystem::CheckForUpdates(const ContentManagementSystem::CheckForUpdateDelegate& in_delegate)
         {
             //Clear any stale data from last update check
@@ -190,14 +551,16 @@ namespace ChilliSource
         void ContentManagementSystem::DownloadUpdates(const ContentManagementSystem::CompleteDelegate& in_delegate)
         {
         	m_onDownloadCompleteDelegate = in_delegate;
-            m_currentPackageDownload = 0;
+            m_nextPackageDownload = 0;
+            m_numPackagesDownloaded = 0;
+            m_runningDownloadedTotal = 0;
             
             if(!m_packageDetails.empty())
             {
             	//Add a temp directory so that the packages are stored atomically and only overwrite
                 //the originals on full success
                 Core::Application::Get()->GetFileSystem()->CreateDirectoryPath(Core::StorageLocation::k_DLC, "Temp");
-                m_contentDownloader->DownloadPackage(m_packageDetails[m_currentPackageDownload].m_url, Core::MakeDelegate(this, &ContentManagementSystem::OnContentDownloadComplete));
+                DownloadNextPackage();
             }
             else
             {
@@ -208,58 +571,221 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void ContentManagementSystem::DownloadNextPackage()
         {
-            m_currentPackageDownload++;
-            m_contentDownloader->DownloadPackage(m_packageDetails[m_currentPackageDownload].m_url, Core::MakeDelegate(this, &ContentManagementSystem::OnContentDownloadComplete));
+            while(m_activeDownloads.size() < m_maxConcurrentDownloads && m_nextPackageDownload < m_packageDetails.size())
+            {
+                PackageDownloadSPtr download = std::make_shared<PackageDownload>();
+                download->m_packageIndex = m_nextPackageDownload++;
+                
+                const PackageDetails& details = m_packageDetails[download->m_packageIndex];
+                download->m_packageId = details.m_id;
+                download->m_packageChecksum = details.m_checksum;
+                if(OpenPackageFiles(*download) == false)
+                {
+                    CS_LOG_ERROR("CMS: Cannot create temp file for package: " + details.m_id);
+                    OnPackageDownloadFailed();
+                    return;
+                }
+                
+                if(download->m_resumeOffset == details.m_size)
+                {
+                    m_runningDownloadedTotal += details.m_size;
+                    m_numPackagesDownloaded++;
+                    continue;
+                }
+                
+                m_activeDownloads.push_back(download);
+                IContentDownloader::Delegate delegate = [this, download](IContentDownloader::Result in_result, const std::string& in_data)
+                {
+                    if(download->IsCancelled() == false)
+                    {
+                        OnContentDownloadComplete(download, in_result, in_data);
+                    }
+                };
+                
+                if(download->m_resumeOffset > 0)
+                {
+                    m_contentDownloader->ResumePackageDownload(details.m_url, download->m_resumeOffset, delegate);
+                }
+                else
+                {
+                    m_contentDownloader->DownloadPackage(details.m_url, delegate);
+                }
+            }
+            
+            //All of the remaining packages may have already been downloaded
+            if(m_numPackagesDownloaded >= m_packageDetails.size())
+            {
+                m_onDownloadCompleteDelegate(Result::k_succeeded);
+            }
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
         void ContentManagementSystem::InstallUpdates(const CompleteDelegate& inDelegate)
         {
-            if(!m_packageDetails.empty() || !m_removePackageIds.empty())
+            if(m_packageDetails.empty() && m_removePackageIds.empty())
             {
-				if(!m_packageDetails.empty())
-				{
-					//Unzip all the files and overwrite the old manifest
-					for (const auto& details : m_packageDetails)
-					{
-						ExtractFilesFromPackage(details);
-					}
-				}
-                
-                //Remove the temp zips
-                DeleteDirectory("Temp");
+                //Tell the delegate all is bad
+                ClearDownloadData();
+                inDelegate(Result::k_failed);
+                return;
+            }
+            
+            //The install takes its own copy of the update so that checking for updates in the meantime doesn't affect it
+            InstallStateSPtr installState = std::make_shared<InstallState>();
+            installState->m_delegate = inDelegate;
+            installState->m_serverManifest = m_serverManifest;
+            installState->m_removePackageIds = m_removePackageIds;
+            
+            if(m_packageDetails.empty())
+            {
+                FinishInstall(installState);
+                return;
+            }
+            
+            //Gather the checksums of all files so they can be verified as they are extracted
+            Core::XML::Node* serverPackageEl = Core::XMLUtils::GetFirstChildElement(Core::XMLUtils::GetFirstChildElement(installState->m_serverManifest->GetDocument()), "Package");
+            while(serverPackageEl)
+            {
+                std::string packageId = Core::XMLUtils::GetAttributeValue<std::string>(serverPackageEl, "ID", "");
+                Core::XML::Node* fileEl = Core::XMLUtils::GetFirstChildElement(serverPackageEl, "File");
+                while(fileEl)
+                {
+                    std::string filePath = Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Location", "");
+                    if(filePath.empty()) //Maintain backwards compatability with old versions
+                    {
+                        filePath = packageId + "/" + Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Name", "");
+                    }
+                    
+                    installState->m_fileChecksums.insert(std::make_pair(filePath, Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Checksum", "")));
+                    fileEl = Core::XMLUtils::GetNextSiblingElement(fileEl, "File");
+                }
                 
-                m_packageDetails.clear();
-			
-				if(!m_removePackageIds.empty())
-				{
-					//Remove any unused files from the documents
-					for (const auto& packageId : m_removePackageIds)
-					{
-						DeleteDirectory(packageId);
-					}
-				}
-                
-                //Save the new content manifest
-                CSCore::XMLUtils::WriteDocument(m_serverManifest->GetDocument(), Core::StorageLocation::k_DLC, "ContentManifest.moman");
-                
-                m_dlcCachePurged = false;
-                
-                //Store that we have DLC cached. If there is no DLC on next check then 
-                //we know the cache has been purged and we have to block on download
-                Core::AppDataStore* ads = Core::Application::Get()->GetSystem<Core::AppDataStore>();
-                ads->SetValue(k_adsKeyHasCached, true);
+                serverPackageEl = Core::XMLUtils::GetNextSiblingElement(serverPackageEl, "Package");
+            }
+            
+            //The packages are extracted to a staging directory and only replace the installed
+            //packages once all of them have succeeded. The directories are created up front
+            //as the file system is not safe to modify from multiple tasks.
+            DeleteDirectory(k_stagingDirectory);
+            for (const auto& details : m_packageDetails)
+            {
+                installState->m_installPackageIds.push_back(details.m_id);
                 
-                //Tell the delegate all is good
-                inDelegate(Result::k_succeeded);
+                if(GetDirectoryPathsInZip(m_contentDirectory + "/" + GetPackageFilePath(details.m_id), installState->m_directoryPaths) == false)
+                {
+                    CS_LOG_ERROR("CMS: Cannot unzip content package: " + details.m_id);
+                    installState->m_succeeded = false;
+                    FinishInstall(installState);
+                    return;
+                }
             }
-            else
+            
+            Core::FileSystem* fileSystem = Core::Application::Get()->GetFileSystem();
+            fileSystem->CreateDirectoryPath(Core::StorageLocation::k_DLC, k_stagingDirectory);
+            for (const auto& directoryPath : installState->m_directoryPaths)
             {
-                //Tell the delegate all is bad
-                inDelegate(Result::k_failed);
+                fileSystem->CreateDirectoryPath(Core::StorageLocation::k_DLC, k_stagingDirectory + "/" + directoryPath);
             }
             
-            ClearDownloadData();
+            //Unzip all the packages concurrently
+            installState->m_numPendingTasks = m_packageDetails.size();
+            for (const auto& details : m_packageDetails)
+            {
+                Core::Application::Get()->GetTaskScheduler()->ScheduleTask([this, details, installState]()
+                {
+                    ExtractFilesFromPackage(details, installState);
+                });
+            }
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::OnInstallTaskComplete(const InstallStateSPtr& in_installState)
+        {
+            if(--in_installState->m_numPendingTasks == 0)
+            {
+                Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask([this, in_installState]()
+                {
+                    FinishInstall(in_installState);
+                });
+            }
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::FinishInstall(const InstallStateSPtr& in_installState)
+        {
+            //Remove the temp zips
+            DeleteDirectory("Temp");
+            
+            if(in_installState->m_succeeded == true)
+            {
+                //Replace the installed packages with the newly extracted ones
+                Core::FileSystem* fileSystem = Core::Application::Get()->GetFileSystem();
+                for (const auto& packageId : in_installState->m_installPackageIds)
+                {
+                    DeleteDirectory(packageId);
+                }
+                for (const auto& directoryPath : in_installState->m_directoryPaths)
+                {
+                    fileSystem->CreateDirectoryPath(Core::StorageLocation::k_DLC, directoryPath);
+                }
+                for (const auto& filePath : in_installState->m_extractedFilePaths)
+                {
+                    std::string stagedFilePath = m_contentDirectory + "/" + k_stagingDirectory + "/" + filePath;
+                    if(std::rename(stagedFilePath.c_str(), (m_contentDirectory + "/" + filePath).c_str()) != 0)
+                    {
+                        CS_LOG_ERROR("CMS: Failed to install file from content package: " + filePath);
+                        in_installState->m_succeeded = false;
+                    }
+                }
+            }
+            
+            DeleteDirectory(k_stagingDirectory);
+            
+            //Cached GUI layouts may have been replaced or removed by the install
+            GUI::GUIViewFactory::ClearLayoutCache();
+            
+            if(in_installState->m_succeeded == false)
+            {
+                //The old manifest is kept so the corrupt packages will be downloaded again on the next update
+                if(m_serverManifest == in_installState->m_serverManifest)
+                {
+                    ClearDownloadData();
+                }
+                in_installState->m_delegate(Result::k_failed);
+                return;
+            }
+            
+            //Remove any unused files from the documents
+            for (const auto& packageId : in_installState->m_removePackageIds)
+            {
+                DeleteDirectory(packageId);
+            }
+            
+            //The extracted files have already been verified so their checksums can be cached
+            for (const auto& filePath : in_installState->m_verifiedFilePaths)
+            {
+                AddToChecksumCache(filePath, in_installState->m_fileChecksums[filePath]);
+            }
+            SaveChecksumCache();
+            
+            //Save the new content manifest
+            CSCore::XMLUtils::WriteDocument(in_installState->m_serverManifest->GetDocument(), Core::StorageLocation::k_DLC, "ContentManifest.moman");
+            
+            m_dlcCachePurged = false;
+            
+            //Store that we have DLC cached. If there is no DLC on next check then
+            //we know the cache has been purged and we have to block on download
+            Core::AppDataStore* ads = Core::Application::Get()->GetSystem<Core::AppDataStore>();
+            ads->SetValue(k_adsKeyHasCached, true);
+            
+            //Keep the data of any update check made since the install started
+            if(m_serverManifest == in_installState->m_serverManifest)
+            {
+                ClearDownloadData();
+            }
+            
+            //Tell the delegate all is good
+            in_installState->m_delegate(Result::k_succeeded);
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
@@ -279,6 +805,9 @@ namespace ChilliSource
                 case IContentDownloader::Result::k_flushed:
                     m_serverManifestData += in_manifest;
                     break;
+                case IContentDownloader::Result::k_restarted:
+                    m_serverManifestData.clear();
+                    break;
             };
             
             //Reset the listener
@@ -286,44 +815,66 @@ namespace ChilliSource
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
-        void ContentManagementSystem::OnContentDownloadComplete(IContentDownloader::Result in_result, const std::string& in_data)
+        void ContentManagementSystem::OnContentDownloadComplete(const PackageDownloadSPtr& in_download, IContentDownloader::Result in_result, const std::string& in_data)
         {
         	switch(in_result)
             {
                 case IContentDownloader::Result::k_succeeded:
                 {
+                    const PackageDetails& details = m_packageDetails[in_download->m_packageIndex];
+                    
+                    in_download->Write(in_data);
                     
-                    if(SavePackageToFile(m_packageDetails[m_currentPackageDownload], in_data, true))
+                    //The checksum has been calculated as the file was written so there is no need to re-read it
+                    std::string checksum;
                     {
-                        m_runningDownloadedTotal += m_packageDetails[m_currentPackageDownload].m_size;
-                        
-                        //Don't overwrite the old manifest until all the content has been downloaded 
-                        if(m_currentPackageDownload >= (m_packageDetails.size() - 1))
-                        {
-                            m_onDownloadCompleteDelegate(Result::k_succeeded);
-                        }
-                        else
-                        {
-                            DownloadNextPackage();
-                        }
+                        std::unique_lock<std::mutex> lock(in_download->m_mutex);
+                        in_download->m_fileStream.reset();
+                        in_download->m_journalStream.reset();
+                        checksum = Core::BaseEncoding::Base64Encode(in_download->m_hash.finalize().binarydigest());
+                    }
+                    Core::StringUtils::ChopTrailingChars(checksum, '=');
+                    
+                    if(checksum != details.m_checksum)
+                    {
+                        CS_LOG_ERROR("CMS: " + details.m_id + " Package download corrupted");
                         
+                        //The corrupt package can't be resumed so it is downloaded in full next time
+                        Core::Application::Get()->GetFileSystem()->DeleteFile(Core::StorageLocation::k_DLC, GetPackageFilePath(details.m_id));
+                        Core::Application::Get()->GetFileSystem()->DeleteFile(Core::StorageLocation::k_DLC, GetJournalFilePath(details.m_id));
+                        OnPackageDownloadFailed();
                         break;
                     }
-                }
-                case IContentDownloader::Result::k_failed:
-                {
-                    //Delete all temp zip files and cancel the outstanding requests
-                    DeleteDirectory("Temp");
                     
-                    if(m_onDownloadCompleteDelegate)
+                    m_runningDownloadedTotal += details.m_size;
+                    m_numPackagesDownloaded++;
+                    m_activeDownloads.erase(std::find(m_activeDownloads.begin(), m_activeDownloads.end(), in_download));
+                    
+                    //Don't overwrite the old manifest until all the content has been downloaded
+                    if(m_numPackagesDownloaded >= m_packageDetails.size())
+                    {
+                        m_onDownloadCompleteDelegate(Result::k_succeeded);
+                    }
+                    else
                     {
-                        m_onDownloadCompleteDelegate(Result::k_failed);
+                        DownloadNextPackage();
                     }
                     break;
                 }
+                case IContentDownloader::Result::k_failed:
+                {
+                    OnPackageDownloadFailed();
+                    break;
+                }
                 case IContentDownloader::Result::k_flushed:
                 {
-                    SavePackageToFile(m_packageDetails[m_currentPackageDownload], in_data, false);
+                    in_download->Write(in_data);
+                    break;
+                }
+                case IContentDownloader::Result::k_restarted:
+                {
+                    CS_LOG_VERBOSE("CMS: Server cannot resume package " + in_download->m_packageId + ", restarting download");
+                    in_download->Restart();
                     break;
                 }
             }
@@ -401,6 +952,32 @@ namespace ChilliSource
                     }
                 }
 				
+                //Calculate the checksums of the local files that need validating up front, so that any which
+                //aren't cached can be hashed concurrently
+                std::vector<std::string> localFilePaths;
+                Core::XML::Node* serverPackageEl = Core::XMLUtils::GetFirstChildElement(serverManifestRootNode, "Package");
+                while(serverPackageEl)
+                {
+                    std::string packageId = Core::XMLUtils::GetAttributeValue<std::string>(serverPackageEl, "ID", "");
+                    std::unordered_map<std::string, std::string>::iterator it = mapPackageIDToChecksum.find(packageId);
+                    if(it != mapPackageIDToChecksum.end() && it->second == Core::XMLUtils::GetAttributeValue<std::string>(serverPackageEl, "Checksum", ""))
+                    {
+                        Core::XML::Node* fileEl = Core::XMLUtils::GetFirstChildElement(serverPackageEl, "File");
+                        while(fileEl)
+                        {
+                            std::string filePath = Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Location", "");
+                            if(filePath.empty()) //Maintain backwards compatability with old versions
+                            {
+                                filePath = packageId + "/" + Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Name", "");
+                            }
+                            localFilePaths.push_back(filePath);
+                            fileEl = Core::XMLUtils::GetNextSiblingElement(fileEl, "File");
+                        }
+                    }
+                    serverPackageEl = Core::XMLUtils::GetNextSiblingElement(serverPackageEl, "Package");
+                }
+                CacheDLCFileChecksums(localFilePaths);
+                
                 //Now process the server manifest and see whats different between the two
                 Core::XML::Node* pServerPackageEl = Core::XMLUtils::GetFirstChildElement(serverManifestRootNode, "Package");
                 while(pServerPackageEl)
@@ -479,6 +1056,8 @@ namespace ChilliSource
                 }
             }
             
+            SaveChecksumCache();
+            
             //Notify the delegate of our completion and whether the need to update anything
             bool bRequiresUpdating = (!m_removePackageIds.empty() || !m_packageDetails.empty());
             
@@ -538,88 +1117,239 @@ namespace ChilliSource
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
-        bool ContentManagementSystem::SavePackageToFile(const PackageDetails& in_packageDetails, const std::string& in_zippedPackage, bool in_fullyDownloaded)
+        bool ContentManagementSystem::OpenPackageFiles(PackageDownload& in_download) const
         {
-            std::string strFile = "Temp/" + in_packageDetails.m_id + ".packzip";
-
-            //Append to the file as it can take multiple writes
-            Core::FileStreamSPtr pFileStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(Core::StorageLocation::k_DLC, strFile, Core::FileMode::k_writeBinaryAppend);
-			pFileStream->Write((s8*)in_zippedPackage.data(), (s32)in_zippedPackage.size());
-            pFileStream->Close();
+            Core::FileSystem* fileSystem = Core::Application::Get()->GetFileSystem();
+            const PackageDetails& details = m_packageDetails[in_download.m_packageIndex];
             
-            //Check if the full file has been written and perform a checksum validation 
-            if(in_fullyDownloaded)
+            in_download.m_resumeOffset = ResumePartialPackage(in_download);
+            in_download.m_bytesWritten = in_download.m_resumeOffset;
+            if(in_download.m_resumeOffset == details.m_size)
             {
-                std::string strChecksum = CalculateChecksum(Core::StorageLocation::k_DLC, strFile);
-                if(strChecksum != in_packageDetails.m_checksum)
+                //The package was fully downloaded previously so nothing more needs to be written
+                return true;
+            }
+            else if(in_download.m_resumeOffset > 0)
+            {
+                in_download.m_fileStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, GetPackageFilePath(details.m_id), Core::FileMode::k_writeBinaryAppend);
+            }
+            else
+            {
+                //Any partial data from a previous attempt is discarded
+                in_download.m_hash = MD5();
+                in_download.m_chunkHash = MD5();
+                in_download.m_chunkSize = 0;
+                
+                in_download.m_fileStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, GetPackageFilePath(details.m_id), Core::FileMode::k_writeBinary);
+                in_download.m_journalStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, GetJournalFilePath(details.m_id), Core::FileMode::k_write);
+                if(in_download.m_journalStream != nullptr && in_download.m_journalStream->IsBad() == false)
                 {
-                    CS_LOG_ERROR("CMS: " + in_packageDetails.m_id + " Package download corrupted");
-                    return false;
+                    in_download.m_journalStream->Write(details.m_checksum + "\n");
+                    in_download.m_journalStream->Flush();
                 }
             }
+            
+            return (in_download.m_fileStream != nullptr && in_download.m_fileStream->IsBad() == false && in_download.m_journalStream != nullptr && in_download.m_journalStream->IsBad() == false);
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        u32 ContentManagementSystem::ResumePartialPackage(PackageDownload& in_download) const
+        {
+            Core::FileSystem* fileSystem = Core::Application::Get()->GetFileSystem();
+            const PackageDetails& details = m_packageDetails[in_download.m_packageIndex];
+            
+            Core::FileStreamUPtr packageStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, GetPackageFilePath(details.m_id), Core::FileMode::k_readBinary);
+            Core::FileStreamUPtr journalStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, GetJournalFilePath(details.m_id), Core::FileMode::k_read);
+            if(packageStream == nullptr || packageStream->IsBad() == true || journalStream == nullptr || journalStream->IsBad() == true)
+            {
+                return 0;
+            }
+            
+            //The journal is only valid for the same version of the package
+            std::string line;
+            journalStream->GetLine(line);
+            if(line != details.m_checksum)
+            {
+                return 0;
+            }
+            
+            packageStream->SeekG(0, Core::SeekDir::k_end);
+            u32 partialSize = (u32)packageStream->TellG();
+            packageStream->SeekG(0);
+            
+            std::unique_ptr<s8[]> chunk(new s8[k_journalChunkSize]);
+            if(partialSize == details.m_size)
+            {
+                //The package finished downloading but was never installed. It is kept if it matches the package checksum.
+                MD5 hash;
+                u32 remainingSize = partialSize;
+                while(remainingSize > 0)
+                {
+                    const u32 size = std::min(remainingSize, k_journalChunkSize);
+                    packageStream->Read(chunk.get(), size);
+                    hash.update(chunk.get(), size);
+                    remainingSize -= size;
+                }
+                
+                MD5 finalHash = hash;
+                std::string checksum = Core::BaseEncoding::Base64Encode(finalHash.finalize().binarydigest());
+                Core::StringUtils::ChopTrailingChars(checksum, '=');
+                if(packageStream->IsBad() == true || checksum != details.m_checksum)
+                {
+                    CS_LOG_WARNING("CMS: Downloaded package " + details.m_id + " is corrupt, restarting download");
+                    return 0;
+                }
                 
-            return true;
+                in_download.m_hash = hash;
+                CS_LOG_VERBOSE("CMS: Package " + details.m_id + " is already downloaded");
+                return partialSize;
+            }
+            
+            if(partialSize == 0 || partialSize > details.m_size || m_contentDownloader->IsResumeSupported() == false)
+            {
+                return 0;
+            }
+            
+            //Verify each complete chunk against the journal, rebuilding the package checksum as we go. Every
+            //complete chunk must have been journaled; a missing or malformed entry means the partial package
+            //can't be trusted.
+            std::vector<std::string> chunkChecksums;
+            const u32 numChunks = partialSize / k_journalChunkSize;
+            for(u32 i = 0; i < numChunks; ++i)
+            {
+                packageStream->Read(chunk.get(), k_journalChunkSize);
+                
+                MD5 chunkHash;
+                chunkHash.update(chunk.get(), k_journalChunkSize);
+                std::string chunkChecksum = chunkHash.finalize().hexdigest();
+                
+                line.clear();
+                journalStream->GetLine(line);
+                if(line != chunkChecksum)
+                {
+                    CS_LOG_WARNING("CMS: Partial download of package " + details.m_id + " is corrupt, restarting download");
+                    return 0;
+                }
+                
+                in_download.m_hash.update(chunk.get(), k_journalChunkSize);
+                chunkChecksums.push_back(chunkChecksum);
+            }
+            
+            //The rest of the partial package is the start of the next chunk. It is verified by the package checksum.
+            const u32 remainingSize = partialSize - numChunks * k_journalChunkSize;
+            packageStream->Read(chunk.get(), remainingSize);
+            in_download.m_hash.update(chunk.get(), remainingSize);
+            in_download.m_chunkHash.update(chunk.get(), remainingSize);
+            in_download.m_chunkSize = remainingSize;
+            
+            packageStream.reset();
+            journalStream.reset();
+            
+            //Rewrite the journal with only the verified chunks
+            in_download.m_journalStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, GetJournalFilePath(details.m_id), Core::FileMode::k_write);
+            if(in_download.m_journalStream == nullptr || in_download.m_journalStream->IsBad() == true)
+            {
+                return 0;
+            }
+            
+            in_download.m_journalStream->Write(details.m_checksum + "\n");
+            for(const auto& chunkChecksum : chunkChecksums)
+            {
+                in_download.m_journalStream->Write(chunkChecksum + "\n");
+            }
+            in_download.m_journalStream->Flush();
+            
+            CS_LOG_VERBOSE("CMS: Resuming download of package " + details.m_id + " from " + Core::ToString(partialSize) + " bytes");
+            return partialSize;
         }
-
         //-----------------------------------------------------------
         //-----------------------------------------------------------
-        void ContentManagementSystem::ExtractFilesFromPackage(const ContentManagementSystem::PackageDetails& in_packageDetails) const
+        void ContentManagementSystem::OnPackageDownloadFailed()
+        {
+            //Cancel the outstanding downloads. If the downloader can't cancel its requests they will still complete
+            //but the results are ignored. The partially downloaded packages are kept in the temp directory so they
+            //can be resumed.
+            m_contentDownloader->CancelPackageDownloads();
+            for(const auto& download : m_activeDownloads)
+            {
+                download->Cancel();
+            }
+            m_activeDownloads.clear();
+            m_nextPackageDownload = m_packageDetails.size();
+            
+            if(m_onDownloadCompleteDelegate)
+            {
+                m_onDownloadCompleteDelegate(Result::k_failed);
+            }
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::ExtractFilesFromPackage(const ContentManagementSystem::PackageDetails& in_packageDetails, const InstallStateSPtr& in_installState)
         {
 			//Open zip
-			std::string strZipFilePath(m_contentDirectory + "/Temp/" + in_packageDetails.m_id + ".packzip");
+			std::string zipFilePath(m_contentDirectory + "/" + GetPackageFilePath(in_packageDetails.m_id));
 			
-			unzFile ZippedFile = unzOpen(strZipFilePath.c_str());
-			if(!ZippedFile)
+			unzFile zippedFile = unzOpen(zipFilePath.c_str());
+			if(!zippedFile)
 			{
 				CS_LOG_ERROR("CMS: Cannot unzip content package: " + in_packageDetails.m_id);
+                in_installState->m_succeeded = false;
+                OnInstallTaskComplete(in_installState);
 				return;
 			}
 
-            //Remove old content before installing the new stuff
-            DeleteDirectory(in_packageDetails.m_id);
-            
-            //Go to the first file in the zip
-            const u64 uddwFilenameLength = 256;
-            s8 byaFileName[uddwFilenameLength];
+            std::unique_ptr<s8[]> buffer(new s8[k_extractBufferSize]);
             
-            s32 dwStatus = unzGoToFirstFile(ZippedFile);
-            
-            while(dwStatus == UNZ_OK)
+            s32 status = unzGoToFirstFile(zippedFile);
+            while(status == UNZ_OK)
             {
-                //Open the next file
-                if (unzOpenCurrentFile(ZippedFile) != UNZ_OK)
-                    break;
-                
-                //Get file information
-                unz_file_info FileInfo;
-                unzGetCurrentFileInfo(ZippedFile, &FileInfo, byaFileName, uddwFilenameLength, nullptr, 0, nullptr, 0);
-                
-                //Load the file into memory and then save it out to the directory
-                s8* pbyDataBuffer =  new s8[FileInfo.uncompressed_size];
-                unzReadCurrentFile(ZippedFile, pbyDataBuffer, FileInfo.uncompressed_size);
+                unz_file_info fileInfo;
+                unzGetCurrentFileInfo(zippedFile, &fileInfo, nullptr, 0, nullptr, 0, nullptr, 0);
                 
-                //Create new stuff
-                std::string strFilePath = std::string(byaFileName);
-                if(ContainsDirectoryPath(strFilePath))
+                if(fileInfo.uncompressed_size >= k_largeFileSize)
                 {
-                    //There is a nested folder so we need to create the directory structure
-                    std::string strPath = GetPathExcludingFileName(strFilePath);
-                    Core::Application::Get()->GetFileSystem()->CreateDirectoryPath(Core::StorageLocation::k_DLC, "/" + strPath);
+                    //Large files are extracted in their own task using a separate handle to the zip
+                    unz_file_pos filePos;
+                    unzGetFilePos(zippedFile, &filePos);
+                    
+                    in_installState->m_numPendingTasks++;
+                    Core::Application::Get()->GetTaskScheduler()->ScheduleTask([this, zipFilePath, filePos, in_installState]()
+                    {
+                        unz_file_pos largeFilePos = filePos;
+                        unzFile largeZippedFile = unzOpen(zipFilePath.c_str());
+                        std::unique_ptr<s8[]> largeBuffer(new s8[k_extractBufferSize]);
+                        
+                        if(largeZippedFile && unzGoToFilePos(largeZippedFile, &largeFilePos) == UNZ_OK)
+                        {
+                            std::string filePath;
+                            bool success = ExtractCurrentFile(largeZippedFile, in_installState->m_fileChecksums, largeBuffer.get(), filePath);
+                            in_installState->OnFileExtracted(filePath, success);
+                        }
+                        else
+                        {
+                            in_installState->m_succeeded = false;
+                        }
+                        
+                        if(largeZippedFile)
+                        {
+                            unzClose(largeZippedFile);
+                        }
+                        OnInstallTaskComplete(in_installState);
+                    });
                 }
-                
-                if(IsFile(strFilePath))
+                else
                 {
-                    Core::Application::Get()->GetFileSystem()->WriteFile(Core::StorageLocation::k_DLC, "/" + strFilePath, pbyDataBuffer, FileInfo.uncompressed_size);
+                    std::string filePath;
+                    bool success = ExtractCurrentFile(zippedFile, in_installState->m_fileChecksums, buffer.get(), filePath);
+                    in_installState->OnFileExtracted(filePath, success);
                 }
                 
-                //Close current file and jump to the next
-                CS_SAFEDELETE_ARRAY(pbyDataBuffer);
-                unzCloseCurrentFile(ZippedFile);
-                dwStatus = unzGoToNextFile(ZippedFile);
+                status = unzGoToNextFile(zippedFile);
             }
             
             //Close the zip
-            unzClose(ZippedFile);
+            unzClose(zippedFile);
+            OnInstallTaskComplete(in_installState);
         }
 		//-----------------------------------------------------------
 		//-----------------------------------------------------------
@@ -631,7 +1361,13 @@ namespace ChilliSource
 		//-----------------------------------------------------------
 		u32 ContentManagementSystem::GetRunningTotalDownloaded()
 		{
-			return m_runningDownloadedTotal + m_contentDownloader->GetCurrentDownloadedBytes();
+			//Active downloads count the data they resumed from as well as the data received
+			u32 downloaded = m_runningDownloadedTotal;
+			for(const auto& download : m_activeDownloads)
+			{
+				downloaded += download->m_bytesWritten;
+			}
+			return downloaded;
 		}
         //-----------------------------------------------------------
         //-----------------------------------------------------------
@@ -658,7 +1394,7 @@ namespace ChilliSource
                 if(Core::Application::Get()->GetFileSystem()->DoesFileExist(Core::StorageLocation::k_DLC, in_filename))
                 {
                     //Check if the file has become corrupted
-                    return (CalculateChecksum(Core::StorageLocation::k_DLC, in_filename) == in_checksum);
+                    return (GetDLCFileChecksum(in_filename) == in_checksum);
                 }
                 
                 return false;
@@ -666,9 +1402,188 @@ namespace ChilliSource
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
+        std::string ContentManagementSystem::GetDLCFileChecksum(const std::string& in_filePath)
+        {
+            LoadChecksumCache();
+            
+            u32 size = 0;
+            s64 modifiedTime = 0;
+            if(GetFileStats(m_contentDirectory + "/" + in_filePath, size, modifiedTime) == false)
+            {
+                if(m_checksumCache.erase(in_filePath) > 0)
+                {
+                    m_isChecksumCacheDirty = true;
+                }
+                return CalculateChecksum(Core::StorageLocation::k_DLC, in_filePath);
+            }
+            
+            auto it = m_checksumCache.find(in_filePath);
+            if(it != m_checksumCache.end() && it->second.m_size == size && it->second.m_modifiedTime == modifiedTime)
+            {
+                return it->second.m_checksum;
+            }
+            
+            std::string checksum = CalculateChecksum(Core::StorageLocation::k_DLC, in_filePath);
+            m_checksumCache[in_filePath] = CachedChecksum { size, modifiedTime, checksum };
+            m_isChecksumCacheDirty = true;
+            return checksum;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::CacheDLCFileChecksums(const std::vector<std::string>& in_filePaths)
+        {
+            LoadChecksumCache();
+            
+            std::vector<std::string> uncachedFilePaths;
+            for(const auto& filePath : in_filePaths)
+            {
+                u32 size = 0;
+                s64 modifiedTime = 0;
+                if(GetFileStats(m_contentDirectory + "/" + filePath, size, modifiedTime) == true)
+                {
+                    auto it = m_checksumCache.find(filePath);
+                    if(it == m_checksumCache.end() || it->second.m_size != size || it->second.m_modifiedTime != modifiedTime)
+                    {
+                        uncachedFilePaths.push_back(filePath);
+                    }
+                }
+            }
+            
+            if(uncachedFilePaths.empty() == true)
+            {
+                return;
+            }
+            
+            //The calling thread takes files from the same list as the tasks, so the files are all hashed even if
+            //no task gets to run, such as when this is called from a task or every thread is busy. It then only
+            //waits on files that a task has already started. The state is shared as tasks may start after return.
+            struct HashState
+            {
+                std::vector<std::string> m_filePaths;
+                std::vector<std::string> m_checksums;
+                std::atomic<u32> m_nextFile;
+                std::mutex m_mutex;
+                std::condition_variable m_condition;
+                u32 m_numRemaining;
+            };
+            
+            auto state = std::make_shared<HashState>();
+            state->m_filePaths = std::move(uncachedFilePaths);
+            state->m_checksums.resize(state->m_filePaths.size());
+            state->m_nextFile = 0;
+            state->m_numRemaining = state->m_filePaths.size();
+            
+            auto hashFiles = [state]()
+            {
+                u32 fileIndex = 0;
+                while((fileIndex = state->m_nextFile++) < state->m_filePaths.size())
+                {
+                    state->m_checksums[fileIndex] = CalculateChecksum(Core::StorageLocation::k_DLC, state->m_filePaths[fileIndex]);
+                    
+                    std::unique_lock<std::mutex> lock(state->m_mutex);
+                    if(--state->m_numRemaining == 0)
+                    {
+                        state->m_condition.notify_one();
+                    }
+                }
+            };
+            
+            for(u32 i = 1; i < state->m_filePaths.size(); ++i)
+            {
+                Core::Application::Get()->GetTaskScheduler()->ScheduleTask(hashFiles);
+            }
+            hashFiles();
+            
+            std::unique_lock<std::mutex> lock(state->m_mutex);
+            state->m_condition.wait(lock, [&state]() { return state->m_numRemaining == 0; });
+            lock.unlock();
+            
+            for(u32 i = 0; i < state->m_filePaths.size(); ++i)
+            {
+                AddToChecksumCache(state->m_filePaths[i], state->m_checksums[i]);
+            }
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::AddToChecksumCache(const std::string& in_filePath, const std::string& in_checksum)
+        {
+            LoadChecksumCache();
+            
+            u32 size = 0;
+            s64 modifiedTime = 0;
+            if(in_checksum.empty() == false && GetFileStats(m_contentDirectory + "/" + in_filePath, size, modifiedTime) == true)
+            {
+                m_checksumCache[in_filePath] = CachedChecksum { size, modifiedTime, in_checksum };
+                m_isChecksumCacheDirty = true;
+            }
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::LoadChecksumCache()
+        {
+            if(m_isChecksumCacheLoaded == true)
+            {
+                return;
+            }
+            m_isChecksumCacheLoaded = true;
+            
+            Core::FileStreamUPtr fileStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(Core::StorageLocation::k_DLC, k_checksumCacheFilePath, Core::FileMode::k_read);
+            if(fileStream == nullptr || fileStream->IsBad() == true)
+            {
+                return;
+            }
+            
+            //Each line contains the checksum, size, modification time and path of a file
+            std::string line;
+            while(fileStream->EndOfFile() == false)
+            {
+                line.clear();
+                fileStream->GetLine(line);
+                
+                std::vector<std::string> values = Core::StringUtils::Split(line, "\t", 3);
+                if(values.size() == 4)
+                {
+                    m_checksumCache[values[3]] = CachedChecksum { Core::ParseU32(values[1]), Core::ParseS64(values[2]), values[0] };
+                }
+            }
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::SaveChecksumCache()
+        {
+            if(m_isChecksumCacheDirty == false)
+            {
+                return;
+            }
+            
+            Core::FileStreamUPtr fileStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(Core::StorageLocation::k_DLC, k_checksumCacheFilePath, Core::FileMode::k_write);
+            if(fileStream == nullptr || fileStream->IsBad() == true)
+            {
+                CS_LOG_WARNING("CMS: Cannot save checksum cache");
+                return;
+            }
+            
+            for(const auto& entry : m_checksumCache)
+            {
+                fileStream->Write(entry.second.m_checksum + "\t" + Core::ToString(entry.second.m_size) + "\t" + Core::ToString(entry.second.m_modifiedTime) + "\t" + entry.first + "\n");
+            }
+            
+            m_isChecksumCacheDirty = false;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
         void ContentManagementSystem::DeleteDirectory(const std::string& in_directory) const
         {
             CSCore::Application::Get()->GetFileSystem()->DeleteDirectory(Core::StorageLocation::k_DLC, in_directory);
         }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        ContentManagementSystem::~ContentManagementSystem()
+        {
+            for(const auto& download : m_activeDownloads)
+            {
+                download->Cancel();
+            }
+        }
     }
 }
@@ -35,6 +35,10 @@
 #include <ChilliSource/Core/XML/XMLUtils.h>
 #include <ChilliSource/Networking/ContentDownload/IContentDownloader.h>
 
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 namespace ChilliSource
 {
     namespace Networking
@@ -136,6 +140,14 @@ namespace ChilliSource
             /// Call GetDownloadProgress to get the progress value
             /// to update any progress UI
             ///
+            /// Up to the maximum number of concurrent downloads are
+            /// in progress at once. Each package is streamed to a
+            /// temporary file as it arrives and its checksum is
+            /// calculated as it is written. If a previous download was
+            /// interrupted and the content downloader supports it, the
+            /// partial package is verified and only the remainder is
+            /// downloaded.
+            ///
             /// @author S Downie
             ///
             /// @param Delegate to call when download is complete
@@ -145,20 +157,38 @@ namespace ChilliSource
             /// Having downloaded the update packages this method
             /// unzips the packages and overwrites any old assets
             ///
+            /// The packages are extracted concurrently on background
+            /// threads and each file is streamed to disk, verifying
+            /// its checksum as it is written. The delegate is called
+            /// on the main thread once all packages are installed and
+            /// will report failure if any file is corrupt.
+            ///
             /// @author S Downie
             ///
             /// @param Delegate to call when Install is complete
             //-----------------------------------------------------------
             void InstallUpdates(const CompleteDelegate& in_delegate);
             //-----------------------------------------------------------
-            /// Data is cached in memory and only written to disc
-            /// when the download is successful; at which point
-            /// we can clear the data and delete any temp files
+            /// Clears the manifest data and the list of packages
+            /// from the last update check.
             ///
             /// @author S Downie
             //-----------------------------------------------------------
             void ClearDownloadData();
             //-----------------------------------------------------------
+            /// Sets the maximum number of packages that can be
+            /// downloaded at once. This defaults to 1. Values greater
+            /// than 1 require a content downloader that supports
+            /// multiple concurrent package downloads.
+            ///
+            /// @param The maximum number of concurrent downloads.
+            //-----------------------------------------------------------
+            void SetMaxConcurrentDownloads(u32 in_maxConcurrentDownloads);
+            //-----------------------------------------------------------
+            /// Destructor
+            //-----------------------------------------------------------
+            ~ContentManagementSystem();
+            //-----------------------------------------------------------
             /// @author S Downie
             ///
             /// @param File name
@@ -205,6 +235,21 @@ namespace ChilliSource
                 std::string m_checksum;
                 u32 m_size;
             };
+            
+            struct PackageDownload;
+            using PackageDownloadSPtr = std::shared_ptr<PackageDownload>;
+            struct InstallState;
+            using InstallStateSPtr = std::shared_ptr<InstallState>;
+            //-----------------------------------------------------------
+            /// The checksum of a DLC file along with the size and
+            /// modification time of the file when it was calculated.
+            //-----------------------------------------------------------
+            struct CachedChecksum
+            {
+                u32 m_size;
+                s64 m_modifiedTime;
+                std::string m_checksum;
+            };
             //------------------------------------------------------------
             /// Initialisation method called at a time when all App Systems
             /// have been created. System initialisation occurs in the order
@@ -242,15 +287,18 @@ namespace ChilliSource
             //-----------------------------------------------------------
             void OnContentManifestDownloadComplete(IContentDownloader::Result in_result, const std::string& in_manifest);
             //-----------------------------------------------------------
-            /// The file has downloaded we can now save it to the the 
-            /// cache
+            /// Called when a chunk of a package has downloaded or the
+            /// download has finished. Flushed chunks may be received
+            /// on a background thread and are streamed straight to the
+            /// package's temp file.
             ///
             /// @author S Downie
             ///
+            /// @param The package download.
             /// @param Request result
             /// @param Request response
             //-----------------------------------------------------------
-            void OnContentDownloadComplete(IContentDownloader::Result in_result, const std::string& in_data);
+            void OnContentDownloadComplete(const PackageDownloadSPtr& in_download, IContentDownloader::Result in_result, const std::string& in_data);
             //-----------------------------------------------------------
             /// Check if an existing content manifest exists and
             /// construct a list of the files that require updating
@@ -271,25 +319,66 @@ namespace ChilliSource
             //-----------------------------------------------------------
             void AddToDownloadListIfNotInBundle(Core::XML::Node* in_packageEl);
             //-----------------------------------------------------------
-            /// Save the zip file to documents directory
+            /// Opens the temp file and journal for a package download.
+            /// If the package was previously partially downloaded and
+            /// the content downloader supports resuming, the partial
+            /// package is verified and the download continues from the
+            /// end of it.
             ///
-            /// @author S Downie
+            /// @param The package download.
             ///
-            /// @param Package details
-            /// @param Binary zip
-            /// @param Whether the file has finished downloading
-            /// @return Success
+            /// @return Whether the files were successfully opened.
             //-----------------------------------------------------------
-            bool SavePackageToFile(const PackageDetails& in_packageDetails, const std::string& in_zippedPackage, bool in_fullyDownloaded);
+            bool OpenPackageFiles(PackageDownload& in_download) const;
+            //-----------------------------------------------------------
+            /// Verifies the chunks of a partially downloaded package
+            /// against its journal and restores the package and chunk
+            /// checksums from the data. The journal is re-opened for
+            /// writing with only the verified chunks. A package that
+            /// was fully downloaded is verified against the package
+            /// checksum instead and needn't be downloaded again.
+            ///
+            /// @param The package download.
+            ///
+            /// @return The number of bytes that can be resumed from, the
+            /// package size if it is already downloaded, or 0 if the
+            /// download must start from the beginning.
+            //-----------------------------------------------------------
+            u32 ResumePartialPackage(PackageDownload& in_download) const;
+            //-----------------------------------------------------------
+            /// Cancels all package downloads in progress and notifies
+            /// the delegate of the failure. Partially downloaded
+            /// packages are kept so they can be resumed.
+            //-----------------------------------------------------------
+            void OnPackageDownloadFailed();
             //-----------------------------------------------------------
             /// Unzip the package and save all the files to the
-            /// documents directory
+            /// staging directory. This is called on a background
+            /// thread. Large files are extracted in their own tasks.
             ///
             /// @author S Downie
             ///
             /// @param Zipped package
+            /// @param The state of the install.
+            //-----------------------------------------------------------
+            void ExtractFilesFromPackage(const PackageDetails& in_packageDetails, const InstallStateSPtr& in_installState);
             //-----------------------------------------------------------
-            void ExtractFilesFromPackage(const PackageDetails& in_packageDetails) const;
+            /// Called when an extraction task has finished. Once all
+            /// tasks have finished the install is completed on the
+            /// main thread. This is thread-safe.
+            ///
+            /// @param The state of the install.
+            //-----------------------------------------------------------
+            void OnInstallTaskComplete(const InstallStateSPtr& in_installState);
+            //-----------------------------------------------------------
+            /// Removes the temp packages. If every package was
+            /// extracted the installed packages are replaced with the
+            /// staged ones, any unused packages removed and the new
+            /// manifest saved. Then notifies the delegate.
+            ///
+            /// @param The state of the install.
+            //-----------------------------------------------------------
+            void FinishInstall(const InstallStateSPtr& in_installState);
             //-----------------------------------------------------------
 			/// Deletes a directory from the DLC Storage Location.
             ///
@@ -310,7 +399,46 @@ namespace ChilliSource
             ///
             /// @return Whether the file exists
             //-----------------------------------------------------------
-            static bool DoesFileExist(const std::string& in_filename, const std::string in_checksum, bool in_checkOnlyBundle);
+            bool DoesFileExist(const std::string& in_filename, const std::string in_checksum, bool in_checkOnlyBundle);
+            //-----------------------------------------------------------
+            /// Gets the checksum of a file in the DLC directory. The
+            /// checksum is read from the cache if the size and
+            /// modification time of the file are unchanged, otherwise
+            /// it is calculated and added to the cache.
+            ///
+            /// @param File path
+            ///
+            /// @return Checksum string
+            //-----------------------------------------------------------
+            std::string GetDLCFileChecksum(const std::string& in_filePath);
+            //-----------------------------------------------------------
+            /// Calculates the checksums of any of the given DLC files
+            /// which are not in the cache. The files are hashed
+            /// concurrently on the task scheduler, with the calling
+            /// thread also hashing files rather than just waiting, and
+            /// this blocks until they are all complete.
+            ///
+            /// @param The file paths.
+            //-----------------------------------------------------------
+            void CacheDLCFileChecksums(const std::vector<std::string>& in_filePaths);
+            //-----------------------------------------------------------
+            /// Adds the checksum of a DLC file to the cache using the
+            /// current size and modification time of the file.
+            ///
+            /// @param File path
+            /// @param Checksum string
+            //-----------------------------------------------------------
+            void AddToChecksumCache(const std::string& in_filePath, const std::string& in_checksum);
+            //-----------------------------------------------------------
+            /// Loads the checksum cache from the DLC directory if it
+            /// has not already been loaded.
+            //-----------------------------------------------------------
+            void LoadChecksumCache();
+            //-----------------------------------------------------------
+            /// Saves the checksum cache to the DLC directory if it has
+            /// changed since it was loaded.
+            //-----------------------------------------------------------
+            void SaveChecksumCache();
             //-----------------------------------------------------------
             /// Calculate a checksum for the file. This involves
             /// performing an MD5 hash of the file and converting that
@@ -324,7 +452,9 @@ namespace ChilliSource
             //-----------------------------------------------------------
             static std::string CalculateChecksum(Core::StorageLocation in_location, const std::string& in_filePath);
             //-----------------------------------------------------------
-            /// Perform the HTTP request for the next DLC package.
+            /// Perform the HTTP requests for the next DLC packages
+            /// until the maximum number of concurrent downloads are
+            /// in progress.
             ///
             /// @author S Downie
             //-----------------------------------------------------------
@@ -337,7 +467,7 @@ namespace ChilliSource
 			u32	m_runningToDownloadTotal;
 			u32 m_runningDownloadedTotal;
             
-            Core::XMLUPtr m_serverManifest;
+            Core::XMLSPtr m_serverManifest;
             
             IContentDownloader* m_contentDownloader;
             
@@ -347,7 +477,14 @@ namespace ChilliSource
             std::string m_serverManifestData;
             std::string m_contentDirectory;
 			
-            u32 m_currentPackageDownload;
+            std::vector<PackageDownloadSPtr> m_activeDownloads;
+            u32 m_nextPackageDownload;
+            u32 m_numPackagesDownloaded;
+            u32 m_maxConcurrentDownloads;
+            
+            std::unordered_map<std::string, CachedChecksum> m_checksumCache;
+            bool m_isChecksumCacheLoaded;
+            bool m_isChecksumCacheDirty;
             
             bool m_dlcCachePurged;
         };
@@ -49,7 +49,8 @@ namespace ChilliSource
         public:
             //----------------------------------------------------------
             /// An enum describing the possible results from a download
-            /// request.
+            /// request. k_restarted is only used when resuming a package
+            /// download, see ResumePackageDownload().
             ///
             /// @author S Downie
             //----------------------------------------------------------
@@ -57,7 +58,8 @@ namespace ChilliSource
             {
                 k_succeeded,
                 k_failed,
-                k_flushed
+                k_flushed,
+                k_restarted
             };
             //----------------------------------------------------------
             /// A delegate that can be used to get the response from a
@@ -80,7 +82,12 @@ namespace ChilliSource
             //----------------------------------------------------------
             virtual bool DownloadContentManifest(const Delegate& in_delegate) = 0;
             //----------------------------------------------------------
-            /// Download the package file from the given URL
+            /// Download the package file from the given URL. The content
+            /// management system may call this again before previous
+            /// packages have finished downloading if it has been set
+            /// to allow multiple concurrent downloads. Flushed chunks
+            /// can be delivered on any thread but the final result
+            /// should be delivered on the main thread.
             ///
             /// @author S Downie
             ///
@@ -91,8 +98,40 @@ namespace ChilliSource
             //---------------------------------------------------------
             /// @author S Downie
             ///
-            /// @return The amount of bytes read by the current request,
-            /// if any
+            /// @return Whether or not this downloader can resume
+            /// partially downloaded packages. If not, interrupted
+            /// packages are downloaded again from the beginning.
+            //---------------------------------------------------------
+            virtual bool IsResumeSupported() const { return false; }
+            //---------------------------------------------------------
+            /// Download the remainder of the package file at the given
+            /// URL, starting from the given byte offset. The data passed
+            /// to the delegate must begin at the offset. If the server
+            /// sends the whole package instead, the delegate must be
+            /// called with k_restarted before any of the data, and the
+            /// data already downloaded is discarded. This will only be
+            /// called if IsResumeSupported() returns true.
+            ///
+            /// @param URL string
+            /// @param The offset in bytes to resume from.
+            /// @param Delegate
+            //---------------------------------------------------------
+            virtual void ResumePackageDownload(const std::string& in_url, u32 in_offset, const Delegate& in_delegate)
+            {
+                CS_LOG_FATAL("This content downloader does not support resuming package downloads.");
+            }
+            //---------------------------------------------------------
+            /// Cancels all package downloads that are in progress. The
+            /// delegates of cancelled downloads will not be called. This
+            /// is used to stop the remaining downloads when one of them
+            /// fails. Downloaders that can't cancel requests can leave
+            /// this empty, as the results of the remaining downloads
+            /// are ignored.
+            //---------------------------------------------------------
+            virtual void CancelPackageDownloads() {}
+            //---------------------------------------------------------
+            /// @return The amount of bytes read by all package requests
+            /// currently in progress, if any
             //---------------------------------------------------------
             virtual u32 GetCurrentDownloadedBytes() const = 0;
             //---------------------------------------------------------
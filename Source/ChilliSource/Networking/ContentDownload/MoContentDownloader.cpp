@@ -31,9 +31,12 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Device.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
+#include <ChilliSource/Core/String/ToString.h>
 
 #include <json/json.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace Networking
@@ -102,19 +105,70 @@ namespace ChilliSource
         //----------------------------------------------------------------
         /// Download Package
         ///
-        /// Download the package file from the given URL
+        /// Download the package file from the given URL. Multiple
+        /// packages can be downloaded concurrently.
         ///
         /// @param URL string
         /// @param Delegate
         //----------------------------------------------------------------
         void MoContentDownloader::DownloadPackage(const std::string& instrURL, const Delegate& inDelegate)
         {
-            mOnContentDownloadCompleteDelegate = inDelegate;
-            
             HttpRequest::Desc requestDesc;
             requestDesc.m_url = instrURL;
             requestDesc.m_type = HttpRequest::Type::k_get;
-            mpCurrentRequest = mpHttpRequestSystem->MakeRequest(requestDesc, Core::MakeDelegate(this, &MoContentDownloader::OnContentDownloadComplete));
+            MakePackageRequest(requestDesc, std::make_shared<bool>(false), inDelegate);
+        }
+        //----------------------------------------------------------------
+        /// Is Resume Supported
+        ///
+        /// @return Whether partial package downloads can be resumed
+        //----------------------------------------------------------------
+        bool MoContentDownloader::IsResumeSupported() const
+        {
+            return true;
+        }
+        //----------------------------------------------------------------
+        /// Resume Package Download
+        ///
+        /// Download the remainder of the package file from the given
+        /// URL using a range request. If the server ignores the range
+        /// the delegate is told the download has restarted before
+        /// the data is passed on.
+        ///
+        /// @param URL string
+        /// @param Offset in bytes to resume from
+        /// @param Delegate
+        //----------------------------------------------------------------
+        void MoContentDownloader::ResumePackageDownload(const std::string& instrURL, u32 inudwOffset, const Delegate& inDelegate)
+        {
+            HttpRequest::Desc requestDesc;
+            requestDesc.m_url = instrURL;
+            requestDesc.m_type = HttpRequest::Type::k_get;
+            requestDesc.m_headers.SetValue("Range", "bytes=" + Core::ToString(inudwOffset) + "-");
+            MakePackageRequest(requestDesc, std::make_shared<bool>(true), inDelegate);
+        }
+        //----------------------------------------------------------------
+        /// Make Package Request
+        ///
+        /// Starts the request for a package and tracks it until it
+        /// has completed
+        ///
+        /// @param Request description
+        /// @param Whether the request is resuming a package that the
+        /// server has not yet responded to in full
+        /// @param Delegate for the package
+        //----------------------------------------------------------------
+        void MoContentDownloader::MakePackageRequest(const HttpRequest::Desc& inDesc, const std::shared_ptr<bool>& inpbIsResuming, const Delegate& inDelegate)
+        {
+            HttpRequest* pRequest = mpHttpRequestSystem->MakeRequest(inDesc, [this, inpbIsResuming, inDelegate](HttpRequest* inpRequest, HttpRequest::Result ineResult)
+            {
+                OnContentDownloadComplete(inpbIsResuming, inDelegate, inpRequest, ineResult);
+            });
+            
+            if(pRequest != nullptr)
+            {
+                mapCurrentRequests.push_back(pRequest);
+            }
         }
         //----------------------------------------------------------------
         /// On Content Manifest Download Complete
@@ -182,15 +236,45 @@ namespace ChilliSource
         //----------------------------------------------------------------
         /// On Content Download Complete
         ///
-        /// Triggered when a package download has completed
+        /// Triggered when a package download has completed. Flushed
+        /// chunks may be received on a background thread so the list
+        /// of current requests is only changed once the request has
+        /// finished.
         ///
+        /// @param Whether the request is resuming a package that the
+        /// server has not yet responded to in full
+        /// @param Delegate for the package
         /// @param Request response
         /// @param Request result
         //----------------------------------------------------------------
-        void MoContentDownloader::OnContentDownloadComplete(HttpRequest* inpRequest, HttpRequest::Result ineResult)
+        void MoContentDownloader::OnContentDownloadComplete(const std::shared_ptr<bool>& inpbIsResuming, const Delegate& inDelegate, HttpRequest* inpRequest, HttpRequest::Result ineResult)
         {
-            if(mpCurrentRequest == inpRequest)
-                mpCurrentRequest = nullptr;
+            if(ineResult != HttpRequest::Result::k_flushed)
+            {
+                std::vector<HttpRequest*>::iterator itRequest = std::find(mapCurrentRequests.begin(), mapCurrentRequests.end(), inpRequest);
+                if(itRequest != mapCurrentRequests.end())
+                {
+                    mapCurrentRequests.erase(itRequest);
+                }
+            }
+            
+            const std::string strNoResponse;
+            const std::string* pstrResponse = &inpRequest->GetResponse();
+            if(*inpbIsResuming == true)
+            {
+                if(inpRequest->GetResponseCode() == HttpResponseCode::k_ok)
+                {
+                    //The server ignored the range and is sending the whole package, so the data we already have is discarded
+                    *inpbIsResuming = false;
+                    inDelegate(Result::k_restarted, strNoResponse);
+                }
+                else if(inpRequest->GetResponseCode() == HttpResponseCode::k_rangeNotSatisfiable)
+                {
+                    //The body is an error rather than package data. The package is only accepted if the data we already
+                    //have passes the package checksum.
+                    pstrResponse = &strNoResponse;
+                }
+            }
             
             switch(ineResult)
             {
@@ -202,7 +286,7 @@ namespace ChilliSource
                         default:   //OK
                         case HttpResponseCode::k_ok:
                         {
-                            mOnContentDownloadCompleteDelegate(Result::k_succeeded, inpRequest->GetResponse());
+                            inDelegate(Result::k_succeeded, *pstrResponse);
                             break;
                         }
                         case HttpResponseCode::k_movedTemporarily:      // Redirected
@@ -215,7 +299,7 @@ namespace ChilliSource
                                 requestDetails.m_url = requestDetails.m_redirectionUrl;
                                 requestDetails.m_redirectionUrl = "";
                                 requestDetails.m_type = HttpRequest::Type::k_get;
-                                mpCurrentRequest = mpHttpRequestSystem->MakeRequest(requestDetails, Core::MakeDelegate(this, &MoContentDownloader::OnContentDownloadComplete));
+                                MakePackageRequest(requestDetails, inpbIsResuming, inDelegate);
                                 break;
                             }
                         }
@@ -226,29 +310,48 @@ namespace ChilliSource
                 case HttpRequest::Result::k_failed:
                 case HttpRequest::Result::k_cancelled:
                 {
-                    mOnContentDownloadCompleteDelegate(Result::k_failed, inpRequest->GetResponse());
+                    inDelegate(Result::k_failed, inpRequest->GetResponse());
                     break;
                 }
                 case HttpRequest::Result::k_flushed:
                 {
-                    mOnContentDownloadCompleteDelegate(Result::k_flushed, inpRequest->GetResponse());
+                    if(pstrResponse->empty() == false)
+                    {
+                        inDelegate(Result::k_flushed, *pstrResponse);
+                    }
                     break;
                 }
             }
         }
         
+        //----------------------------------------------------------------
+        /// Cancel Package Downloads
+        ///
+        /// Cancels all package requests that are in progress. Their
+        /// delegates will not be called.
+        //----------------------------------------------------------------
+        void MoContentDownloader::CancelPackageDownloads()
+        {
+            for(HttpRequest* pRequest : mapCurrentRequests)
+            {
+                pRequest->Cancel();
+            }
+            mapCurrentRequests.clear();
+        }
         //----------------------------------------------------------------
         /// Get CurrentDownloaded Bytes
         ///
-        /// @return The amount of bytes read by the current request, if any
+        /// @return The amount of bytes read by all package requests
+        /// currently in progress
         //----------------------------------------------------------------
         u32 MoContentDownloader::GetCurrentDownloadedBytes() const
         {
-            if(mpCurrentRequest)
+            u32 udwBytesRead = 0;
+            for(HttpRequest* pRequest : mapCurrentRequests)
             {
-                return mpCurrentRequest->GetBytesRead();
+                udwBytesRead += pRequest->GetBytesRead();
             }
-            return 0;
+            return udwBytesRead;
         }
     }
 }
\ No newline at end of file
@@ -33,6 +33,8 @@
 #include <ChilliSource/Networking/ContentDownload/IContentDownloader.h>
 #include <ChilliSource/Networking/Http/HttpRequestSystem.h>
 
+#include <memory>
+
 namespace ChilliSource
 {
     namespace Networking
@@ -61,16 +63,44 @@ namespace ChilliSource
             //----------------------------------------------------------------
             /// Download Package
             ///
-            /// Download the package file from the given URL
+            /// Download the package file from the given URL. Multiple
+            /// packages can be downloaded concurrently.
             ///
             /// @param URL string
             /// @param Delegate
             //----------------------------------------------------------------
             void DownloadPackage(const std::string& instrURL, const Delegate& inDelegate);
             //----------------------------------------------------------------
+            /// Is Resume Supported
+            ///
+            /// @return Whether partial package downloads can be resumed
+            //----------------------------------------------------------------
+            bool IsResumeSupported() const;
+            //----------------------------------------------------------------
+            /// Resume Package Download
+            ///
+            /// Download the remainder of the package file from the given
+            /// URL using a range request. If the server ignores the range
+            /// the delegate is told the download has restarted before
+            /// the data is passed on.
+            ///
+            /// @param URL string
+            /// @param Offset in bytes to resume from
+            /// @param Delegate
+            //----------------------------------------------------------------
+            void ResumePackageDownload(const std::string& instrURL, u32 inudwOffset, const Delegate& inDelegate);
+            //----------------------------------------------------------------
+            /// Cancel Package Downloads
+            ///
+            /// Cancels all package requests that are in progress. Their
+            /// delegates will not be called.
+            //----------------------------------------------------------------
+            void CancelPackageDownloads();
+            //----------------------------------------------------------------
             /// Get CurrentDownloaded Bytes
             ///
-            /// @return The amount of bytes read by the current request, if any
+            /// @return The amount of bytes read by all package requests
+            /// currently in progress
             //----------------------------------------------------------------
             u32 GetCurrentDownloadedBytes() const;
             //----------------------------------------------------------------
@@ -97,14 +127,29 @@ namespace ChilliSource
             //----------------------------------------------------------------
             void OnContentManifestDownloadComplete(HttpRequest* inpRequest, HttpRequest::Result ineResult);
             //----------------------------------------------------------------
+            /// Make Package Request
+            ///
+            /// Starts the request for a package and tracks it until it
+            /// has completed
+            ///
+            /// @param Request description
+            /// @param Whether the request is resuming a package that the
+            /// server has not yet responded to in full
+            /// @param Delegate for the package
+            //----------------------------------------------------------------
+            void MakePackageRequest(const HttpRequest::Desc& inDesc, const std::shared_ptr<bool>& inpbIsResuming, const Delegate& inDelegate);
+            //----------------------------------------------------------------
             /// On Content Download Complete
             ///
             /// Triggered when a package download has completed
             ///
+            /// @param Whether the request is resuming a package that the
+            /// server has not yet responded to in full
+            /// @param Delegate for the package
             /// @param Request response
             /// @param Request result
             //----------------------------------------------------------------
-            void OnContentDownloadComplete(HttpRequest* inpRequest, HttpRequest::Result ineResult);
+            void OnContentDownloadComplete(const std::shared_ptr<bool>& inpbIsResuming, const Delegate& inDelegate, HttpRequest* inpRequest, HttpRequest::Result ineResult);
             
         private:
             
@@ -112,11 +157,10 @@ namespace ChilliSource
             
             std::string mstrAssetServerURL;
             Delegate mOnContentManifestDownloadCompleteDelegate;
-            Delegate mOnContentDownloadCompleteDelegate;
             
             HttpRequestSystem* mpHttpRequestSystem;
             
-            HttpRequest* mpCurrentRequest;
+            std::vector<HttpRequest*> mapCurrentRequests;
         };
     }
 }
@@ -30,6 +30,7 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/ColourUtils.h>
+#include <ChilliSource/Core/Base/FrameAllocator.h>
 #include <ChilliSource/Core/Math/MathUtils.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/String/UTF8StringUtils.h>
@@ -127,6 +128,11 @@ namespace ChilliSource
                 return totalWidth;
             }
             //----------------------------------------------------------------------------
+            /// A line of text, described by the range of the source string it covers
+            /// so that splitting text into lines doesn't need to copy it.
+            //----------------------------------------------------------------------------
+            using TextLine = std::pair<std::string::const_iterator, std::string::const_iterator>;
+            //----------------------------------------------------------------------------
             /// Split the given text into lines based on any '\n' characters. The newline
             /// characters do not appear in the returned lines
             ///
@@ -135,28 +141,25 @@ namespace ChilliSource
             /// @param Text (UTF-8)
             /// @param [Out] Array of lines split by '\n'
             //----------------------------------------------------------------------------
-            void SplitByNewLine(const std::string& in_text, std::vector<std::string>& out_lines)
+            void SplitByNewLine(const std::string& in_text, Core::FrameVector<TextLine>& out_lines)
             {
-                auto it = in_text.begin();
-                std::string line;
-                while(it < in_text.end())
+                auto it = in_text.cbegin();
+                auto lineStart = it;
+                while(it < in_text.cend())
                 {
+                    auto characterStart = it;
                     auto character = Core::UTF8StringUtils::Next(it);
                     
-                    if(character != '\n')
-                    {
-                        Core::UTF8StringUtils::Append(character, line);
-                    }
-                    else
+                    if(character == '\n')
                     {
-                        out_lines.push_back(line);
-                        line.clear();
+                        out_lines.push_back(TextLine(lineStart, characterStart));
+                        lineStart = it;
                     }
                 }
                 
-                if(line.size() > 0)
+                if(lineStart < in_text.cend())
                 {
-                    out_lines.push_back(line);
+                    out_lines.push_back(TextLine(lineStart, in_text.cend()));
                 }
             }
             //----------------------------------------------------------------------------
@@ -166,22 +169,23 @@ namespace ChilliSource
             ///
             /// @author S Downie
             ///
-            /// @param Text (UTF-8)
+            /// @param Line of text (UTF-8)
             /// @param Font
             /// @param Text scale
             /// @param Bounds
             /// @param [Out] Array of lines split to fit in bounds
             //----------------------------------------------------------------------------
-            void SplitByBounds(const std::string& in_text, const FontCSPtr& in_font, f32 in_textScale, const Core::Vector2& in_bounds, std::vector<std::string>& out_lines)
+            void SplitByBounds(const TextLine& in_text, const FontCSPtr& in_font, f32 in_textScale, const Core::Vector2& in_bounds, Core::FrameVector<TextLine>& out_lines)
             {
                 f32 maxLineWidth = in_bounds.x;
  
-                auto it = in_text.begin();
-                std::string line;
+                auto it = in_text.first;
+                auto lineStart = it;
                 f32 currentLineWidth = 0.0f;
                 
-                while(it < in_text.end())
+                while(it < in_text.second)
                 {
+                    auto characterStart = it;
                     auto character = Core::UTF8StringUtils::Next(it);
                     currentLineWidth += (GetCharacterWidth(character, in_font) * in_textScale);
                     
@@ -190,12 +194,13 @@ namespace ChilliSource
                     //whether we need to wrap now
                     if(IsBreakableCharacter(character) == true)
                     {
-                        f32 nextBreakWidth = currentLineWidth + (CalculateDistanceToNextBreak(it, in_text.end(), in_font) * in_textScale);
+                        f32 nextBreakWidth = currentLineWidth + (CalculateDistanceToNextBreak(it, in_text.second, in_font) * in_textScale);
                         
-                        if(nextBreakWidth >= maxLineWidth && line.size() > 0)
+                        if(nextBreakWidth >= maxLineWidth && characterStart > lineStart)
                         {
-                            out_lines.push_back(line);
-                            line.clear();
+                            //The breaking character is dropped
+                            out_lines.push_back(TextLine(lineStart, characterStart));
+                            lineStart = it;
                             currentLineWidth = 0.0f;
                             continue;
                         }
@@ -204,7 +209,7 @@ namespace ChilliSource
                     //If text has no characters to break on then we need break anyway should
                     //we exceed the bounds.
                     f32 nextCharacterWidth = 0.0f;
-                    if(it < in_text.end())
+                    if(it < in_text.second)
                     {
                         auto itNext = it;
                         auto nextCharacter = Core::UTF8StringUtils::Next(itNext);
@@ -213,17 +218,15 @@ namespace ChilliSource
                     
                     if((currentLineWidth + nextCharacterWidth) >= maxLineWidth)
                     {
-                        out_lines.push_back(line);
-                        line.clear();
+                        out_lines.push_back(TextLine(lineStart, characterStart));
+                        lineStart = characterStart;
                         currentLineWidth = 0.0f;
                     }
-                    
-                    Core::UTF8StringUtils::Append(character, line);
                 }
                 
-                if(line.size() > 0)
+                if(lineStart < in_text.second)
                 {
-                    out_lines.push_back(line);
+                    out_lines.push_back(TextLine(lineStart, in_text.second));
                 }
             }
             //----------------------------------------------------------------------------
@@ -549,7 +552,8 @@ namespace ChilliSource
 			m_overlayBatcher->Render(m_canvasSprite);
             
 #ifdef CS_ENABLE_DEBUGSTATS
-            Core::Application::Get()->GetDebugStats()->AddToEvent("GUI", 1);
+            static const Debugging::DebugStats::CounterHandle k_guiCounter = Debugging::DebugStats::RegisterCounter("GUI");
+            Core::Application::Get()->GetDebugStats()->IncrementCounter(k_guiCounter);
 #endif
         }
         //----------------------------------------------------------------------------
@@ -568,7 +572,8 @@ namespace ChilliSource
             //Split the string into lines by the forced line breaks (i.e. the \n)
             //- |The quick brown fox| jumped over
             //- |the ferocious honey| badger
-            std::vector<std::string> linesOnNewLine;
+            Core::FrameAllocator* frameAllocator = Core::Application::Get()->GetFrameAllocator();
+            Core::FrameVector<TextLine> linesOnNewLine(frameAllocator);
             SplitByNewLine(in_text, linesOnNewLine);
             
             //Split the lines further based on the line width, breakable characters and the bounds
@@ -576,7 +581,7 @@ namespace ChilliSource
             //- |jumped over        |
             //- |the ferocious honey|
             //- |badger             |
-            std::vector<std::string> linesOnBounds;
+            Core::FrameVector<TextLine> linesOnBounds(frameAllocator);
             for(const auto& line : linesOnNewLine)
             {
                 SplitByBounds(line, in_font, in_textScale, in_bounds, linesOnBounds);
@@ -599,8 +604,8 @@ namespace ChilliSource
             {
                 u32 lineStartIdx = result.m_characters.size();
 
-                auto characterIt = linesOnBounds[lineIdx].begin();
-                while(characterIt < linesOnBounds[lineIdx].end())
+                auto characterIt = linesOnBounds[lineIdx].first;
+                while(characterIt < linesOnBounds[lineIdx].second)
                 {
                     auto character = Core::UTF8StringUtils::Next(characterIt);
                     auto builtCharacter(BuildCharacter(character, in_font, cursorX, cursorY, in_textScale));
@@ -645,7 +650,8 @@ namespace ChilliSource
 			}
             
 #ifdef CS_ENABLE_DEBUGSTATS
-            Core::Application::Get()->GetDebugStats()->AddToEvent("GUI", 1);
+            static const Debugging::DebugStats::CounterHandle k_guiCounter = Debugging::DebugStats::RegisterCounter("GUI");
+            Core::Application::Get()->GetDebugStats()->IncrementCounter(k_guiCounter);
 #endif
 		}
         //----------------------------------------------------------------------------
@@ -36,7 +36,8 @@ namespace ChilliSource
     {
         bool ViewportCullPredicate::CullItem(CameraComponent* inpCamera, RenderComponent* inpItem) const
         {
-            return false;
+            //An orthographic frustum is a box, so this is a test of the item's rectangle against the view.
+            return !inpCamera->GetFrustum().OOBBCullTest(inpItem->GetOOBB());
         }
         
         bool FrustumCullPredicate::CullItem(CameraComponent* inpCamera, RenderComponent* inpItem) const
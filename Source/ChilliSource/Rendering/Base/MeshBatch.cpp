@@ -29,11 +29,16 @@
 #include <ChilliSource/Rendering/Model/StaticMeshComponent.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Base/MeshBatch.h>
 #include <ChilliSource/Rendering/Base/MeshBuffer.h>
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
+#include <ChilliSource/Rendering/Model/Mesh.h>
 #include <ChilliSource/Rendering/Model/SubMesh.h>
 
+#include <algorithm>
+#include <limits>
+
 #ifdef CS_ENABLE_DEBUGSTATS
 #include <ChilliSource/Debugging/Base/DebugStats.h>
 #endif
@@ -42,12 +47,98 @@ namespace ChilliSource
 {
 	namespace Rendering
 	{
+        namespace
+        {
+            const u32 k_noDirtyEntry = std::numeric_limits<u32>::max();
+            const u32 k_maxVertices = std::numeric_limits<u16>::max() + 1;
+            
+            //------------------------------------------------------
+            /// Transforms a stream of vertices by the given matrix.
+            /// The matrix is loaded once up front and each vertex is
+            /// transformed with straight line arithmetic rather than
+            /// through the general vector and matrix operators, which
+            /// keeps the loop free of temporaries and lets the
+            /// compiler vectorise it.
+            ///
+            /// The normals are transformed by the upper 3x3 of the
+            /// matrix. NOTE: This will NOT be correct if there is a
+            /// non-uniform scale component to the transform.
+            ///
+            /// @param The source vertices.
+            /// @param The number of vertices.
+            /// @param The transform.
+            /// @param [Out] The transformed vertices. This must not
+            /// overlap the source.
+            //------------------------------------------------------
+            void TransformVertices(const MeshBatchVertex* in_source, u32 in_numVertices, const Core::Matrix4& in_transform, MeshBatchVertex* out_dest)
+            {
+                const f32 m00 = in_transform.m[0], m01 = in_transform.m[1], m02 = in_transform.m[2], m03 = in_transform.m[3];
+                const f32 m10 = in_transform.m[4], m11 = in_transform.m[5], m12 = in_transform.m[6], m13 = in_transform.m[7];
+                const f32 m20 = in_transform.m[8], m21 = in_transform.m[9], m22 = in_transform.m[10], m23 = in_transform.m[11];
+                const f32 m30 = in_transform.m[12], m31 = in_transform.m[13], m32 = in_transform.m[14], m33 = in_transform.m[15];
+                
+                for (u32 i = 0; i < in_numVertices; ++i)
+                {
+                    const MeshBatchVertex& source = in_source[i];
+                    MeshBatchVertex& dest = out_dest[i];
+                    
+                    const f32 px = source.Pos.x, py = source.Pos.y, pz = source.Pos.z, pw = source.Pos.w;
+                    dest.Pos.x = px * m00 + py * m10 + pz * m20 + pw * m30;
+                    dest.Pos.y = px * m01 + py * m11 + pz * m21 + pw * m31;
+                    dest.Pos.z = px * m02 + py * m12 + pz * m22 + pw * m32;
+                    dest.Pos.w = px * m03 + py * m13 + pz * m23 + pw * m33;
+                    
+                    const f32 nx = source.Norm.x, ny = source.Norm.y, nz = source.Norm.z;
+                    dest.Norm.x = nx * m00 + ny * m10 + nz * m20;
+                    dest.Norm.y = nx * m01 + ny * m11 + nz * m21;
+                    dest.Norm.z = nx * m02 + ny * m12 + nz * m22;
+                    
+                    dest.Tex = source.Tex;
+                }
+            }
+            //------------------------------------------------------
+            /// Copies a stream of indices, offsetting each by the
+            /// given amount.
+            ///
+            /// @param The source indices.
+            /// @param The number of indices.
+            /// @param The offset.
+            /// @param [Out] The offset indices.
+            //------------------------------------------------------
+            void OffsetIndices(const u16* in_source, u32 in_numIndices, u32 in_offset, u16* out_dest)
+            {
+                const u16 offset = u16(in_offset);
+                for (u32 i = 0; i < in_numIndices; ++i)
+                {
+                    out_dest[i] = in_source[i] + offset;
+                }
+            }
+            //------------------------------------------------------
+            /// @param The entry.
+            ///
+            /// @return The number of vertices the entry occupies.
+            //------------------------------------------------------
+            template <typename TEntry> u32 GetNumVertices(const TEntry& in_entry)
+            {
+                return u32(in_entry.m_geometry->m_vertices.size());
+            }
+            //------------------------------------------------------
+            /// @param The entry.
+            ///
+            /// @return The number of indices the entry occupies.
+            //------------------------------------------------------
+            template <typename TEntry> u32 GetNumIndices(const TEntry& in_entry)
+            {
+                return u32(in_entry.m_geometry->m_indices.size());
+            }
+        }
 		//------------------------------------------------------
 		/// Constructor
 		///
 		/// Default
 		//------------------------------------------------------
-		MeshBatch::MeshBatch() : mpMeshBuffer(nullptr), mudwVertexCount(0), mudwIndexCount(0), mdwTag(0)
+		MeshBatch::MeshBatch()
+            : mdwTag(0), mpRenderSystem(nullptr), mpMeshBuffer(nullptr), m_firstDirtyEntry(k_noDirtyEntry), m_lastDirtyEntry(0), m_isLayoutDirty(false)
 		{
 
 		}
@@ -55,46 +146,24 @@ namespace ChilliSource
 		/// Create Static Buffer
 		///
 		/// Get the render system to build a static mesh
-		/// buffer.
+		/// buffer and fill it with the current contents of
+		/// the batch.
 		///
 		/// @param Render system
 		//------------------------------------------------------
 		void MeshBatch::CreateStaticBuffer(RenderSystem* inpRenderSystem)
 		{
-			//Sum up the total number of vertices
-			u32 VBufferSize	= 0;
-			u32 IBufferSize	= 0;
-			
-			for(MapMeshToTransform::const_iterator it = mmapMeshCache.begin(); it != mmapMeshCache.end(); ++it)
-			{
-				MeshCSPtr pMesh = it->first->GetMesh();
-				
-				for (u32 i = 0; i < pMesh->GetNumSubMeshes(); i++)
-				{
-					const SubMesh* pSubMesh = pMesh->GetSubMeshAtIndex(i);
-					VBufferSize += pSubMesh->GetInternalMeshBuffer()->GetVertexCapacity();
-					IBufferSize += pSubMesh->GetInternalMeshBuffer()->GetIndexCapacity();
-					
-					//insure this is using the correct vertex declaration.
-					VertexDeclaration declaration = pSubMesh->GetInternalMeshBuffer()->GetVertexDeclaration();
-					if (!(declaration == VertexLayout::kMesh))
-						CS_LOG_ERROR("Mesh in mesh batch is not using the correct vertex layout!");
-				}
-                
-                mudwVertexCount += pMesh->GetNumVerts();
-                mudwIndexCount += pMesh->GetNumIndices();
-			}
-			
-			BufferDescription desc;
-			desc.eUsageFlag = BufferUsage::k_static;
-			desc.VertexDataCapacity = VBufferSize; 
-			desc.IndexDataCapacity  = IBufferSize;
-			desc.ePrimitiveType = PrimitiveType::k_tri;
-			desc.eAccessFlag = BufferAccess::k_read;
-			desc.VertexLayout = VertexLayout::kMesh;
-			desc.IndexSize = 2;
-			
-			mpMeshBuffer = inpRenderSystem->CreateBuffer(desc);
+            CS_ASSERT(inpRenderSystem != nullptr, "Cannot create a mesh batch buffer without a render system.");
+            
+            mpRenderSystem = inpRenderSystem;
+            CS_SAFEDELETE(mpMeshBuffer);
+            
+            //The new buffer is empty so everything needs to be written to it.
+            if (m_entries.empty() == false)
+            {
+                InvalidateEntries(0, u32(m_entries.size()) - 1);
+            }
+            m_isLayoutDirty = true;
 			
 			//Fill the mesh buffer with the vertex data
 			Build();
@@ -109,135 +178,431 @@ namespace ChilliSource
 		//------------------------------------------------------
 		void MeshBatch::AddMesh(const StaticMeshComponentSPtr &inpMesh, const Core::Matrix4& inmatTransform)
 		{
-			mmapMeshCache.insert(std::make_pair(inpMesh, inmatTransform));
+            CS_ASSERT(inpMesh != nullptr && inpMesh->GetMesh() != nullptr, "Cannot add a null mesh to a mesh batch.");
+            
+            auto it = FindEntry(inpMesh.get());
+            if (it != m_entries.end())
+            {
+                SetMeshTransform(inpMesh, inmatTransform);
+                return;
+            }
+            
+            Entry entry;
+            entry.m_mesh = StaticMeshComponent::GetPool().GetHandle(inpMesh.get());
+            if (entry.m_mesh.Get() == nullptr)
+            {
+                CS_LOG_ERROR("Cannot add a static mesh component which wasn't allocated from its pool to a mesh batch.");
+                return;
+            }
+            
+            entry.m_sourceMesh = inpMesh->GetMesh();
+            entry.m_geometry = GetSourceGeometry(entry.m_sourceMesh);
+            entry.m_transform = inmatTransform;
+            m_entries.push_back(entry);
+            
+            u32 index = u32(m_entries.size()) - 1;
+            InvalidateEntries(index, index);
+            m_isLayoutDirty = true;
 		}
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void MeshBatch::RemoveMesh(const StaticMeshComponentSPtr& in_mesh)
+        {
+            auto it = FindEntry(in_mesh.get());
+            if (it != m_entries.end())
+            {
+                RemoveEntry(u32(it - m_entries.begin()));
+            }
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void MeshBatch::SetMeshTransform(const StaticMeshComponentSPtr& in_mesh, const Core::Matrix4& in_transform)
+        {
+            auto it = FindEntry(in_mesh.get());
+            if (it == m_entries.end())
+            {
+                CS_LOG_ERROR("Cannot set the transform of a mesh which is not in the mesh batch.");
+                return;
+            }
+            
+            it->m_transform = in_transform;
+            
+            u32 index = u32(it - m_entries.begin());
+            InvalidateEntries(index, index);
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        std::vector<MeshBatch::Entry>::iterator MeshBatch::FindEntry(const StaticMeshComponent* in_mesh)
+        {
+            return std::find_if(m_entries.begin(), m_entries.end(), [in_mesh](const Entry& in_entry) { return in_entry.m_mesh.Get() == in_mesh; });
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void MeshBatch::RemoveEntry(u32 in_index)
+        {
+            SourceGeometryCSPtr geometry = m_entries[in_index].m_geometry;
+            MeshCSPtr mesh = m_entries[in_index].m_sourceMesh;
+            m_entries.erase(m_entries.begin() + in_index);
+            
+            //Release the source geometry if this was the last entry using it.
+            auto geometryIt = std::find_if(m_entries.begin(), m_entries.end(), [&geometry](const Entry& in_entry) { return in_entry.m_geometry == geometry; });
+            if (geometryIt == m_entries.end())
+            {
+                m_sourceGeometry.erase(mesh);
+            }
+            
+            //Everything after the removed mesh moves down in the buffer.
+            if (in_index < m_entries.size())
+            {
+                InvalidateEntries(in_index, u32(m_entries.size()) - 1);
+            }
+            m_isLayoutDirty = true;
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void MeshBatch::RemoveDestroyedMeshes()
+        {
+            for (u32 i = u32(m_entries.size()); i > 0; --i)
+            {
+                if (m_entries[i - 1].m_mesh.Get() == nullptr)
+                {
+                    RemoveEntry(i - 1);
+                }
+            }
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        u32 MeshBatch::GetNumMeshes() const
+        {
+            return u32(m_entries.size());
+        }
 		//------------------------------------------------------
 		/// Build
 		///
-		/// Finalise the batch. Nothing can be changed once
-		/// the batch is built
+		/// Rebuilds and uploads the parts of the buffer which
+		/// have changed since the last build.
 		//------------------------------------------------------
 		void MeshBatch::Build()
 		{
 			//Sanity check
-			if(mmapMeshCache.empty() || !mpMeshBuffer) return;
-			
-			mpMeshBuffer->Bind();
-			
-			mpMeshBuffer->SetVertexCount(mudwVertexCount);
-			mpMeshBuffer->SetIndexCount(mudwIndexCount);
-			
-			//Get the buffer locations
-			MeshBatchVertex* pVBatchBuffer = nullptr;
-			mpMeshBuffer->LockVertex((f32**)&pVBatchBuffer, 0, 0);
-			u16* pIBatchBuffer = nullptr;
-			mpMeshBuffer->LockIndex(&pIBatchBuffer, 0, 0);
+			if(mpRenderSystem == nullptr) return;
             
-            MeshBatchVertex sTempVert;
-			u32 VertexStride = sizeof(MeshBatchVertex);
-            u32 IndexStride = sizeof(u16);
+            //Any build in progress is superseded by this one, so its entries need to be included.
+            if (m_pendingJob != nullptr)
+            {
+                m_pendingJob->m_batch = nullptr;
+                
+                u32 firstEntry = m_pendingJob->m_firstEntry;
+                u32 lastEntry = firstEntry + u32(m_pendingJob->m_entries.size()) - 1;
+                if (m_pendingJob->m_entries.empty() == false && firstEntry < m_entries.size())
+                {
+                    InvalidateEntries(firstEntry, std::min(lastEntry, u32(m_entries.size()) - 1));
+                }
+                m_isLayoutDirty = true;
+                
+                m_pendingJob.reset();
+            }
             
-            u32 udwIndexOffset = 0;
+            BuildJobSPtr job = CreateBuildJob();
+            if (job != nullptr)
+            {
+                PerformBuildJob(job.get());
+                UploadBuildJob(job.get());
+            }
+		}
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void MeshBatch::BuildAsync()
+        {
+            //If a build is already in progress another will be started when it completes.
+            if (mpRenderSystem == nullptr || m_pendingJob != nullptr) return;
             
-            //---------------------------------------------------
-            // Meshes
-            //---------------------------------------------------
-			//Load the mesh data into the buffer and offset the indices
-			for(MapMeshToTransform::const_iterator it = mmapMeshCache.begin(); it != mmapMeshCache.end(); ++it)
-			{
-				//build the normal matrix. NOTE: This normal matrix will NOT work if there is a scale component to the transform.
-				Core::Matrix4 NormalMatrix = it->second;
-				NormalMatrix.m[12] = 0.0f;
-				NormalMatrix.m[13] = 0.0f;
-				NormalMatrix.m[14] = 0.0f;
-				
-				
-				//---------------------------------------------------
-                // Sub-Meshes
-                //---------------------------------------------------
-				for(auto jt = it->first->GetMesh()->m_subMeshes.begin(); jt != it->first->GetMesh()->m_subMeshes.end(); ++jt)
-				{
-					MeshBuffer* pSubBuffer = (*jt)->GetInternalMeshBuffer();
-					pSubBuffer->Bind();
-                    
-                    //----------------------------------
-                    // Vertices
-                    //----------------------------------
-                    //Loop round each vertex in the mesh and store it in the temp so we can manipulate it
-                    u32 NumVerts = pSubBuffer->GetVertexCount();
-                    
-					//Copy the vertex data into the buffer
-					MeshBatchVertex* _pVSubBuffer = nullptr;
-					pSubBuffer->LockVertex((f32**)&_pVSubBuffer, 0, 0);
-                    
-                    //Get the vertex data and transform it before we load it into the batch buffer
-                    for(u32 i=0; i<NumVerts; ++i)
-                    {
-                        //Grab the vertex
-                        memcpy(&sTempVert, _pVSubBuffer + i, VertexStride);
-                        
-                        //Transform the vertex
-						sTempVert.Pos = sTempVert.Pos * it->second;
-						sTempVert.Norm = sTempVert.Norm * NormalMatrix;
-                        
-                        //Copy the vertex into our new buffer
-                        memcpy(pVBatchBuffer, &sTempVert, VertexStride);
-                        pVBatchBuffer++;
-                    }
-                    
-					pSubBuffer->UnlockVertex();
-                    //----------------------------------
-                    //----------------------------------
-					
-                    //----------------------------------
-                    // Indices
-                    //----------------------------------
-                    //Loop round each index in the mesh and store it in the temp so we can manipulate it
-                    u32 NumIndices = pSubBuffer->GetIndexCount();
-                    
-                    //Lock the data we need to copy
-                    u16* _pISubBuffer = nullptr;
-                    pSubBuffer->LockIndex(&_pISubBuffer, 0, 0);
-                    
-                    //Get the index data and offset it before we load it into the batch buffer
-                    for(u32 i=0; i<NumIndices; ++i)
+            m_pendingJob = CreateBuildJob();
+            if (m_pendingJob == nullptr) return;
+            
+            m_pendingJob->m_batch = this;
+            
+            BuildJobSPtr job = m_pendingJob;
+            Core::TaskScheduler* taskScheduler = Core::Application::Get()->GetTaskScheduler();
+            taskScheduler->ScheduleTask([job, taskScheduler]()
+            {
+                PerformBuildJob(job.get());
+                
+                taskScheduler->ScheduleMainThreadTask([job]()
+                {
+                    if (job->m_batch != nullptr)
                     {
-                        u16 Index = 0;
-                        
-                        //Grab the index
-                        memcpy(&Index, _pISubBuffer +  i, IndexStride);
-                        
-                        //Offset the index
-                        Index += udwIndexOffset;
-                        
-                        //Copy the index into our new buffer
-                        memcpy(pIBatchBuffer, &Index, IndexStride);
-                        pIBatchBuffer++;
+                        job->m_batch->OnBuildJobComplete(job);
                     }
-                    
-                    udwIndexOffset += NumVerts;
-                    
-                    //Unlock and offset the new buffer
+                });
+            });
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        bool MeshBatch::IsBuilding() const
+        {
+            return (m_pendingJob != nullptr);
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        MeshBatch::SourceGeometryCSPtr MeshBatch::GetSourceGeometry(const MeshCSPtr& in_mesh)
+        {
+            auto it = m_sourceGeometry.find(in_mesh);
+            if (it != m_sourceGeometry.end())
+            {
+                return it->second;
+            }
+            
+            std::shared_ptr<SourceGeometry> geometry(new SourceGeometry());
+            geometry->m_vertices.reserve(in_mesh->GetNumVerts());
+            geometry->m_indices.reserve(in_mesh->GetNumIndices());
+            
+            //---------------------------------------------------
+            // Sub-Meshes
+            //---------------------------------------------------
+            for (const auto& subMesh : in_mesh->m_subMeshes)
+            {
+                MeshBuffer* pSubBuffer = subMesh->GetInternalMeshBuffer();
+                
+                //insure this is using the correct vertex declaration.
+                if (!(pSubBuffer->GetVertexDeclaration() == VertexLayout::kMesh))
+                {
+                    CS_LOG_ERROR("Mesh in mesh batch is not using the correct vertex layout!");
+                    continue;
+                }
+                
+                pSubBuffer->Bind();
+                
+                //Indices are stored relative to the start of the mesh rather than the sub-mesh.
+                u32 udwIndexOffset = u32(geometry->m_vertices.size());
+                
+                u32 NumVerts = pSubBuffer->GetVertexCount();
+                MeshBatchVertex* _pVSubBuffer = nullptr;
+                if (NumVerts > 0 && pSubBuffer->LockVertex((f32**)&_pVSubBuffer, 0, 0) == true)
+                {
+                    geometry->m_vertices.insert(geometry->m_vertices.end(), _pVSubBuffer, _pVSubBuffer + NumVerts);
+                    pSubBuffer->UnlockVertex();
+                }
+                
+                u32 NumIndices = pSubBuffer->GetIndexCount();
+                u16* _pISubBuffer = nullptr;
+                if (NumIndices > 0 && pSubBuffer->LockIndex(&_pISubBuffer, 0, 0) == true)
+                {
+                    u32 udwFirstIndex = u32(geometry->m_indices.size());
+                    geometry->m_indices.resize(udwFirstIndex + NumIndices);
+                    OffsetIndices(_pISubBuffer, NumIndices, udwIndexOffset, geometry->m_indices.data() + udwFirstIndex);
                     pSubBuffer->UnlockIndex();
-                    //----------------------------------
-                    //----------------------------------
-				}
-			}
-			
-			//---End mapping - Vertex
-			mpMeshBuffer->UnlockVertex();
-			
-			//---End mapping - Index
-			mpMeshBuffer->UnlockIndex();
+                }
+            }
+            
+            m_sourceGeometry.insert(std::make_pair(in_mesh, geometry));
+            return geometry;
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void MeshBatch::InvalidateEntries(u32 in_first, u32 in_last)
+        {
+            if (m_firstDirtyEntry == k_noDirtyEntry)
+            {
+                m_firstDirtyEntry = in_first;
+                m_lastDirtyEntry = in_last;
+            }
+            else
+            {
+                m_firstDirtyEntry = std::min(m_firstDirtyEntry, in_first);
+                m_lastDirtyEntry = std::max(m_lastDirtyEntry, in_last);
+            }
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        MeshBatch::BuildJobSPtr MeshBatch::CreateBuildJob()
+        {
+            RemoveDestroyedMeshes();
+            
+            if (m_firstDirtyEntry == k_noDirtyEntry && m_isLayoutDirty == false)
+            {
+                return nullptr;
+            }
+            
+            //Removals may have left the dirty range past the end of the entries.
+            if (m_firstDirtyEntry != k_noDirtyEntry)
+            {
+                if (m_firstDirtyEntry >= m_entries.size())
+                {
+                    m_firstDirtyEntry = k_noDirtyEntry;
+                }
+                else
+                {
+                    m_lastDirtyEntry = std::min(m_lastDirtyEntry, u32(m_entries.size()) - 1);
+                }
+            }
+            
+            //Only the dirty entries can have moved, everything before them is where it was.
+            if (m_firstDirtyEntry != k_noDirtyEntry)
+            {
+                u32 udwVertexOffset = 0;
+                u32 udwIndexOffset = 0;
+                if (m_firstDirtyEntry > 0)
+                {
+                    const Entry& previous = m_entries[m_firstDirtyEntry - 1];
+                    udwVertexOffset = previous.m_vertexOffset + GetNumVertices(previous);
+                    udwIndexOffset = previous.m_indexOffset + GetNumIndices(previous);
+                }
+                
+                for (u32 i = m_firstDirtyEntry; i <= m_lastDirtyEntry; ++i)
+                {
+                    Entry& entry = m_entries[i];
+                    entry.m_vertexOffset = udwVertexOffset;
+                    entry.m_indexOffset = udwIndexOffset;
+                    udwVertexOffset += GetNumVertices(entry);
+                    udwIndexOffset += GetNumIndices(entry);
+                }
+            }
+            
+            BuildJobSPtr job(new BuildJob());
+            if (m_entries.empty() == false)
+            {
+                const Entry& last = m_entries.back();
+                job->m_totalVertices = last.m_vertexOffset + GetNumVertices(last);
+                job->m_totalIndices = last.m_indexOffset + GetNumIndices(last);
+            }
+            
+            CS_ASSERT(job->m_totalVertices <= k_maxVertices, "Mesh batch contains too many vertices for 16-bit indices.");
+            
+            //There is no need for a buffer until there is something to put in it.
+            if (job->m_totalVertices == 0 && mpMeshBuffer == nullptr)
+            {
+                m_firstDirtyEntry = k_noDirtyEntry;
+                m_lastDirtyEntry = 0;
+                m_isLayoutDirty = false;
+                return nullptr;
+            }
+            
+            //If the buffer needs to be created or grown its previous contents are lost, so everything is rebuilt.
+            u32 vertexBytes = job->m_totalVertices * sizeof(MeshBatchVertex);
+            u32 indexBytes = job->m_totalIndices * sizeof(u16);
+            if (mpMeshBuffer == nullptr || vertexBytes > mpMeshBuffer->GetVertexCapacity() || indexBytes > mpMeshBuffer->GetIndexCapacity())
+            {
+                job->m_recreateBuffer = true;
+                
+                //Allow some room for growth when resizing an existing buffer so that adding meshes one at a time doesn't recreate it each time.
+                if (mpMeshBuffer == nullptr)
+                {
+                    job->m_vertexCapacity = vertexBytes;
+                    job->m_indexCapacity = indexBytes;
+                }
+                else
+                {
+                    job->m_vertexCapacity = std::max(vertexBytes, mpMeshBuffer->GetVertexCapacity() + mpMeshBuffer->GetVertexCapacity() / 2);
+                    job->m_indexCapacity = std::max(indexBytes, mpMeshBuffer->GetIndexCapacity() + mpMeshBuffer->GetIndexCapacity() / 2);
+                }
+                
+                if (m_entries.empty() == false)
+                {
+                    InvalidateEntries(0, u32(m_entries.size()) - 1);
+                }
+            }
+            
+            if (m_firstDirtyEntry != k_noDirtyEntry)
+            {
+                job->m_firstEntry = m_firstDirtyEntry;
+                job->m_entries.assign(m_entries.begin() + m_firstDirtyEntry, m_entries.begin() + m_lastDirtyEntry + 1);
+                job->m_vertexOffset = job->m_entries.front().m_vertexOffset;
+                job->m_indexOffset = job->m_entries.front().m_indexOffset;
+            }
+            
+            m_firstDirtyEntry = k_noDirtyEntry;
+            m_lastDirtyEntry = 0;
+            m_isLayoutDirty = false;
+            
+            return job;
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void MeshBatch::PerformBuildJob(BuildJob* in_job)
+        {
+            if (in_job->m_entries.empty() == true)
+            {
+                return;
+            }
+            
+            const BuildEntry& last = in_job->m_entries.back();
+            in_job->m_vertices.resize(last.m_vertexOffset + GetNumVertices(last) - in_job->m_vertexOffset);
+            in_job->m_indices.resize(last.m_indexOffset + GetNumIndices(last) - in_job->m_indexOffset);
+            
+            for (const BuildEntry& entry : in_job->m_entries)
+            {
+                TransformVertices(entry.m_geometry->m_vertices.data(), GetNumVertices(entry), entry.m_transform, in_job->m_vertices.data() + (entry.m_vertexOffset - in_job->m_vertexOffset));
+                OffsetIndices(entry.m_geometry->m_indices.data(), GetNumIndices(entry), entry.m_vertexOffset, in_job->m_indices.data() + (entry.m_indexOffset - in_job->m_indexOffset));
+            }
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void MeshBatch::UploadBuildJob(const BuildJob* in_job)
+        {
+            if (in_job->m_recreateBuffer == true)
+            {
+                CS_SAFEDELETE(mpMeshBuffer);
+                
+                BufferDescription desc;
+                desc.eUsageFlag = BufferUsage::k_static;
+                desc.VertexDataCapacity = in_job->m_vertexCapacity;
+                desc.IndexDataCapacity  = in_job->m_indexCapacity;
+                desc.ePrimitiveType = PrimitiveType::k_tri;
+                desc.eAccessFlag = BufferAccess::k_read;
+                desc.VertexLayout = VertexLayout::kMesh;
+                desc.IndexSize = 2;
+                
+                mpMeshBuffer = mpRenderSystem->CreateBuffer(desc);
+            }
+            
+			mpMeshBuffer->Bind();
 			
-			//We can now ditch our local meshes
-			mmapMeshCache.clear();
-		}
-		
+			mpMeshBuffer->SetVertexCount(in_job->m_totalVertices);
+			mpMeshBuffer->SetIndexCount(in_job->m_totalIndices);
+            
+            //Only the changed range is written, the rest of the buffer keeps its existing contents.
+            if (in_job->m_vertices.empty() == false)
+            {
+                MeshBatchVertex* pVBatchBuffer = nullptr;
+                if (mpMeshBuffer->LockVertex((f32**)&pVBatchBuffer, 0, 0) == true)
+                {
+                    memcpy(pVBatchBuffer + in_job->m_vertexOffset, in_job->m_vertices.data(), in_job->m_vertices.size() * sizeof(MeshBatchVertex));
+                    mpMeshBuffer->UnlockVertex();
+                }
+            }
+            
+            if (in_job->m_indices.empty() == false)
+            {
+                u16* pIBatchBuffer = nullptr;
+                if (mpMeshBuffer->LockIndex(&pIBatchBuffer, 0, 0) == true)
+                {
+                    memcpy(pIBatchBuffer + in_job->m_indexOffset, in_job->m_indices.data(), in_job->m_indices.size() * sizeof(u16));
+                    mpMeshBuffer->UnlockIndex();
+                }
+            }
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void MeshBatch::OnBuildJobComplete(const BuildJobSPtr& in_job)
+        {
+            CS_ASSERT(m_pendingJob == in_job, "Completed mesh batch build is not the pending build.");
+            
+            m_pendingJob.reset();
+            UploadBuildJob(in_job.get());
+            
+            //Start another build if anything changed while this one was in progress.
+            if (m_firstDirtyEntry != k_noDirtyEntry || m_isLayoutDirty == true)
+            {
+                BuildAsync();
+            }
+        }
 		//------------------------------------------------------
 		//------------------------------------------------------
 		void MeshBatch::Render(RenderSystem* inpRenderSystem, ShaderPass in_shaderPass) const
 		{
+            if (mpMeshBuffer == nullptr || mpMeshBuffer->GetIndexCount() == 0) return;
+            
 			//If we own the mesh buffer then the batcher won't be calling bind for us.
 			mpMeshBuffer->Bind();
 		
@@ -288,7 +653,13 @@ namespace ChilliSource
 		//------------------------------------------------------
 		MeshBatch::~MeshBatch() 
 		{
+            //Any build in progress will complete without anywhere to upload to.
+            if (m_pendingJob != nullptr)
+            {
+                m_pendingJob->m_batch = nullptr;
+            }
+            
 			CS_SAFEDELETE(mpMeshBuffer)
 		}
 	}
-}
\ No newline at end of file
+}
@@ -30,8 +30,13 @@
 #define _CHILLISOURCE_RENDERING_MESH_BATCH_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/ObjectPool.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Rendering/Base/VertexLayouts.h>
 
+#include <unordered_map>
+#include <vector>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -54,6 +59,22 @@ namespace ChilliSource
 		};
 		
 		
+		//--------------------------------------------------------------
+		/// A single static buffer containing the transformed geometry of
+		/// a number of static meshes which share a material, allowing
+		/// them to be rendered with one draw call.
+		///
+		/// Meshes can be added, removed and moved after the batch has
+		/// been built. Only the portion of the buffer affected by the
+		/// changes is rebuilt and uploaded on the next build. The vertex
+		/// transformation can optionally be performed on a background
+		/// thread, in which case only the upload happens on the main
+		/// thread.
+		///
+		/// The batch doesn't keep its mesh components alive. If a
+		/// component is destroyed without being removed, its geometry
+		/// is removed from the batch on the next build.
+		//--------------------------------------------------------------
 		class MeshBatch
 		{
 		public:
@@ -62,13 +83,37 @@ namespace ChilliSource
 			//------------------------------------------------------
 			/// Add Mesh
 			///
-			/// Insert a mesh into this batch.
+			/// Insert a mesh into this batch. If the mesh is already
+			/// in the batch its transform is updated instead. The
+			/// geometry of the mesh is captured at this point, so this
+			/// must be called on the main thread. The component must
+			/// have been allocated from the static mesh component
+			/// pool.
 			///
 			/// @param Static mesh component
 			/// @param Transform
 			//------------------------------------------------------
 			void AddMesh(const StaticMeshComponentSPtr &inpSprite, const Core::Matrix4& inmatTransform);
 			//------------------------------------------------------
+			/// Removes a mesh from the batch. The geometry following
+			/// the mesh in the buffer is rebuilt on the next build.
+			///
+			/// @param Static mesh component
+			//------------------------------------------------------
+			void RemoveMesh(const StaticMeshComponentSPtr& in_mesh);
+			//------------------------------------------------------
+			/// Changes the transform of a mesh in the batch. Only the
+			/// geometry of this mesh is rebuilt on the next build.
+			///
+			/// @param Static mesh component
+			/// @param Transform
+			//------------------------------------------------------
+			void SetMeshTransform(const StaticMeshComponentSPtr& in_mesh, const Core::Matrix4& in_transform);
+			//------------------------------------------------------
+			/// @return The number of meshes in the batch.
+			//------------------------------------------------------
+			u32 GetNumMeshes() const;
+			//------------------------------------------------------
 			/// Set Material
 			///
 			/// @param Material
@@ -105,7 +150,9 @@ namespace ChilliSource
 			/// Create Static Buffer
 			///
 			/// Get the render system to build a static mesh
-			/// buffer.
+			/// buffer and fill it with the current contents of
+			/// the batch. The buffer is recreated by later builds
+			/// if the batch outgrows it.
 			///
 			/// @param Render system
 			//------------------------------------------------------
@@ -113,27 +160,169 @@ namespace ChilliSource
 			//------------------------------------------------------
 			/// Build
 			///
-			/// Finalise the batch. Nothing can be changed once
-			/// the batch is builtı
+			/// Rebuilds and uploads the parts of the buffer which
+			/// have changed since the last build. This must be
+			/// called on the main thread.
 			//------------------------------------------------------
 			void Build();
+			//------------------------------------------------------
+			/// Rebuilds the parts of the buffer which have changed
+			/// since the last build. The vertices are transformed
+			/// on a background thread and the result is uploaded on
+			/// the main thread once complete. If the batch is changed
+			/// while the build is in progress another build is
+			/// started once the current one has finished. This must
+			/// be called on the main thread.
+			//------------------------------------------------------
+			void BuildAsync();
+			//------------------------------------------------------
+			/// @return Whether or not a background build is in
+			/// progress.
+			//------------------------------------------------------
+			bool IsBuilding() const;
 
 		private:
+			//------------------------------------------------------
+			/// The source geometry of a mesh, copied out of its
+			/// sub-mesh buffers so that it can be read from a
+			/// background thread. This is shared between all
+			/// entries using the same mesh.
+			//------------------------------------------------------
+			struct SourceGeometry
+			{
+				std::vector<MeshBatchVertex> m_vertices;
+				std::vector<u16> m_indices;
+			};
+			typedef std::shared_ptr<const SourceGeometry> SourceGeometryCSPtr;
+			//------------------------------------------------------
+			/// The geometry of a mesh in the batch and its location
+			/// within the buffer. This is all a build needs, so
+			/// build jobs take copies of these rather than of the
+			/// entries, and never hold references to components.
+			//------------------------------------------------------
+			struct BuildEntry
+			{
+				SourceGeometryCSPtr m_geometry;
+				Core::Matrix4 m_transform;
+				u32 m_vertexOffset = 0;
+				u32 m_indexOffset = 0;
+			};
+			//------------------------------------------------------
+			/// A mesh in the batch. The component is referenced by a
+			/// pool handle, so the entry doesn't keep it alive.
+			//------------------------------------------------------
+			struct Entry : BuildEntry
+			{
+				Core::ObjectPool<StaticMeshComponent>::Handle m_mesh;
+				MeshCSPtr m_sourceMesh;
+			};
+			//------------------------------------------------------
+			/// The output of a build: the transformed geometry for a
+			/// contiguous range of entries. This is shared with the
+			/// background task so that it can safely complete after
+			/// the batch has been destroyed.
+			//------------------------------------------------------
+			struct BuildJob
+			{
+				MeshBatch* m_batch = nullptr;
+				bool m_recreateBuffer = false;
+				u32 m_vertexCapacity = 0;
+				u32 m_indexCapacity = 0;
+				u32 m_firstEntry = 0;
+				u32 m_vertexOffset = 0;
+				u32 m_indexOffset = 0;
+				u32 m_totalVertices = 0;
+				u32 m_totalIndices = 0;
+				std::vector<BuildEntry> m_entries;
+				std::vector<MeshBatchVertex> m_vertices;
+				std::vector<u16> m_indices;
+			};
+			typedef std::shared_ptr<BuildJob> BuildJobSPtr;
+			//------------------------------------------------------
+			/// @param The mesh.
+			///
+			/// @return The source geometry for the mesh, reading it
+			/// from the mesh buffers if no other entry is using it.
+			//------------------------------------------------------
+			SourceGeometryCSPtr GetSourceGeometry(const MeshCSPtr& in_mesh);
+			//------------------------------------------------------
+			/// @param The static mesh component.
+			///
+			/// @return The entry for the component, or the end of
+			/// the entries if it is not in the batch.
+			//------------------------------------------------------
+			std::vector<Entry>::iterator FindEntry(const StaticMeshComponent* in_mesh);
+			//------------------------------------------------------
+			/// Removes the entry at the given index, releasing its
+			/// source geometry if no other entry is using it.
+			///
+			/// @param The index of the entry.
+			//------------------------------------------------------
+			void RemoveEntry(u32 in_index);
+			//------------------------------------------------------
+			/// Removes the entries for any components which have
+			/// been destroyed without being removed.
+			//------------------------------------------------------
+			void RemoveDestroyedMeshes();
+			//------------------------------------------------------
+			/// Marks the given range of entries as requiring a
+			/// rebuild.
+			///
+			/// @param The first entry.
+			/// @param The last entry.
+			//------------------------------------------------------
+			void InvalidateEntries(u32 in_first, u32 in_last);
+			//------------------------------------------------------
+			/// Lays out the entries in the buffer and captures the
+			/// dirty range into a new build job.
+			///
+			/// @return The build job, or null if nothing has
+			/// changed.
+			//------------------------------------------------------
+			BuildJobSPtr CreateBuildJob();
+			//------------------------------------------------------
+			/// Transforms the geometry of the job's entries into the
+			/// job's output buffers. This only accesses the job so is
+			/// safe to call from any thread.
+			///
+			/// @param The build job.
+			//------------------------------------------------------
+			static void PerformBuildJob(BuildJob* in_job);
+			//------------------------------------------------------
+			/// Writes the output of a build job into the mesh buffer,
+			/// recreating the buffer if it is not large enough. This
+			/// must be called on the main thread.
+			///
+			/// @param The build job.
+			//------------------------------------------------------
+			void UploadBuildJob(const BuildJob* in_job);
+			//------------------------------------------------------
+			/// Called on the main thread when a background build has
+			/// completed.
+			///
+			/// @param The build job.
+			//------------------------------------------------------
+			void OnBuildJobComplete(const BuildJobSPtr& in_job);
 			
 			s32 mdwTag;
 			
-			u32 mudwVertexCount;
-			u32 mudwIndexCount;
-			
 			//The shared material
 			MaterialCSPtr mpMaterial;
 			
 			//---Render Buffer
+			RenderSystem* mpRenderSystem;
 			MeshBuffer* mpMeshBuffer;
 			
-			//List of sprites in the batch
-			typedef std::unordered_map<StaticMeshComponentSPtr, Core::Matrix4> MapMeshToTransform;
-			MapMeshToTransform mmapMeshCache;
+			//The meshes in the batch, in buffer order
+			std::vector<Entry> m_entries;
+			std::unordered_map<MeshCSPtr, SourceGeometryCSPtr> m_sourceGeometry;
+			
+			//The range of entries which have changed since the last build
+			u32 m_firstDirtyEntry;
+			u32 m_lastDirtyEntry;
+			bool m_isLayoutDirty;
+			
+			BuildJobSPtr m_pendingJob;
 		};
 	}
 }
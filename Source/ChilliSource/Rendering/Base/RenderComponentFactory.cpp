@@ -187,7 +187,7 @@ namespace ChilliSource
             {
                 const auto& properties = in_effect->GetEmitterDesc(i);
                 const std::string& type = properties.GetValue("Type");
-                auto emitter = m_emitterFactory->CreateParticleEmitter(type, properties, material, particleComp);
+                auto emitter = m_emitterFactory->CreateParticleEmitter(type, properties, in_effect->GetEmitterProperties(i), material, particleComp);
                 CS_ASSERT(emitter != nullptr, "Cannot create particle emitter of type " + type);
                 emitter->SetTextureAtlas(in_effect->GetAtlas());
                 emitter->SetTextureAtlasId(in_effect->GetAtlasId());
@@ -197,9 +197,19 @@ namespace ChilliSource
             u32 numAffectors = in_effect->GetNumAffectors();
             for(u32 i=0; i<numAffectors; ++i)
             {
+                ParticleAffectorUPtr affector;
+                const ParticleAffector* prototype = in_effect->GetAffectorPrototype(i);
+                if (prototype != nullptr)
+                {
+                    affector = prototype->Clone();
+                }
+                
                 const auto& properties = in_effect->GetAffectorDesc(i);
                 const std::string& type = properties.GetValue("Type");
-                auto affector = m_affectorFactory->CreateParticleAffector(type, properties);
+                if (affector == nullptr)
+                {
+                    affector = m_affectorFactory->CreateParticleAffector(type, properties);
+                }
                 CS_ASSERT(affector != nullptr, "Cannot create particle affector of type " + type);
                 particleComp->AddAffector(std::move(affector));
             }
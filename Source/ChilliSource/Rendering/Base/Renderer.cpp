@@ -31,6 +31,7 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
+#include <ChilliSource/Core/Scene/Scene.h>
 #include <ChilliSource/GUI/Base/Window.h>
 #include <ChilliSource/Rendering/Base/BlendMode.h>
 #include <ChilliSource/Rendering/Base/CullingPredicates.h>
@@ -47,6 +48,7 @@
 #include <ChilliSource/Rendering/Texture/Texture.h>
 
 #include <algorithm>
+#include <typeinfo>
 
 namespace ChilliSource
 {
@@ -165,15 +167,17 @@ namespace ChilliSource
 		//----------------------------------------------------------
 		void Renderer::RenderSceneToTarget(Core::Scene* inpScene, RenderTarget* inpRenderTarget)
         {
-			//Traverse the scene graph and get all renderable objects
-            std::vector<RenderComponent*> aPreFilteredRenderCache;
-            std::vector<CameraComponent*> aCameraCache;
-            std::vector<DirectionalLightComponent*> aDirLightCache;
-            std::vector<PointLightComponent*> aPointLightCache;
+			//Traverse the scene graph and get all renderable objects. The scene lists are
+            //reused between frames, while the lists derived from them use the frame allocator.
+            m_preFilteredRenderCache.clear();
+            m_cameraCache.clear();
+            m_dirLightCache.clear();
+            m_pointLightCache.clear();
+            Core::FrameAllocator* pFrameAllocator = Core::Application::Get()->GetFrameAllocator();
             AmbientLightComponent* pAmbientLight = nullptr;
             
-			FindRenderableObjectsInScene(inpScene, aPreFilteredRenderCache, aCameraCache, aDirLightCache, aPointLightCache, pAmbientLight);
-            mpActiveCamera = (aCameraCache.empty() ? nullptr : aCameraCache.back());
+			FindRenderableObjectsInScene(inpScene, m_preFilteredRenderCache, m_cameraCache, m_dirLightCache, m_pointLightCache, pAmbientLight);
+            mpActiveCamera = (m_cameraCache.empty() ? nullptr : m_cameraCache.back());
             
             if(mpActiveCamera)
             {
@@ -183,13 +187,13 @@ namespace ChilliSource
 				matViewProjCache = mpActiveCamera->GetView() * mpActiveCamera->GetProjection();
                 
                 //Render shadow maps
-                RenderShadowMap(mpActiveCamera, aDirLightCache, aPreFilteredRenderCache);
+                RenderShadowMap(mpActiveCamera, m_dirLightCache, m_preFilteredRenderCache);
                 
                 //Cull items based on camera
-                std::vector<RenderComponent*> aCameraRenderCache;
-                std::vector<RenderComponent*> aCameraOpaqueCache;
-                std::vector<RenderComponent*> aCameraTransparentCache;
-                CullRenderables(mpActiveCamera, aPreFilteredRenderCache, aCameraRenderCache);
+                Core::FrameVector<RenderComponent*> aCameraRenderCache(pFrameAllocator);
+                Core::FrameVector<RenderComponent*> aCameraOpaqueCache(pFrameAllocator);
+                Core::FrameVector<RenderComponent*> aCameraTransparentCache(pFrameAllocator);
+                CullRenderables(inpScene, mpActiveCamera, m_preFilteredRenderCache, aCameraRenderCache);
                 FilterSceneRenderables(aCameraRenderCache, aCameraOpaqueCache, aCameraTransparentCache);
                 
                 //Render scene
@@ -201,7 +205,7 @@ namespace ChilliSource
                 Render(mpActiveCamera, ShaderPass::k_ambient, aCameraOpaqueCache);
                 
                 //Perform the diffuse pass
-                if(aDirLightCache.empty() == false || aPointLightCache.empty() == false)
+                if(m_dirLightCache.empty() == false || m_pointLightCache.empty() == false)
                 {
                     mpRenderSystem->SetBlendFunction(BlendMode::k_one, BlendMode::k_one);
                     mpRenderSystem->LockBlendFunction();
@@ -212,17 +216,38 @@ namespace ChilliSource
                     mpRenderSystem->EnableAlphaBlending(true);
                     mpRenderSystem->LockAlphaBlending();
                     
-                    for(u32 i=0; i<aDirLightCache.size(); ++i)
+                    for(u32 i=0; i<m_dirLightCache.size(); ++i)
                     {
-                        mpRenderSystem->SetLight(aDirLightCache[i]);
+                        mpRenderSystem->SetLight(m_dirLightCache[i]);
                         Render(mpActiveCamera, ShaderPass::k_directional, aCameraOpaqueCache);
                     }
                     
-                    for(u32 i=0; i<aPointLightCache.size(); ++i)
+                    //Split the opaque renderables into those held in the scene's bounding volume hierarchy
+                    //and those that are not, so that each point light can query the hierarchy.
+                    RenderComponentSet aIndexedOpaqueCache(0, std::hash<RenderComponent*>(), std::equal_to<RenderComponent*>(), pFrameAllocator);
+                    Core::FrameVector<RenderComponent*> aUnindexedOpaqueCache(pFrameAllocator);
+                    if(m_pointLightCache.empty() == false)
                     {
-                        mpRenderSystem->SetLight(aPointLightCache[i]);
-                        std::vector<RenderComponent*> aPointLightOpaqueCache;
-                        CullRenderables(aPointLightCache[i], aCameraOpaqueCache, aPointLightOpaqueCache);
+                        aIndexedOpaqueCache.reserve(aCameraOpaqueCache.size());
+                        for(u32 i=0; i<aCameraOpaqueCache.size(); ++i)
+                        {
+                            if(aCameraOpaqueCache[i]->IsA(Core::VolumeComponent::InterfaceID) == true)
+                            {
+                                aIndexedOpaqueCache.insert(aCameraOpaqueCache[i]);
+                            }
+                            else
+                            {
+                                aUnindexedOpaqueCache.push_back(aCameraOpaqueCache[i]);
+                            }
+                        }
+                    }
+                    
+                    for(u32 i=0; i<m_pointLightCache.size(); ++i)
+                    {
+                        mpRenderSystem->SetLight(m_pointLightCache[i]);
+                        Core::FrameVector<RenderComponent*> aPointLightOpaqueCache(pFrameAllocator);
+                        CullRenderables(inpScene, m_pointLightCache[i], aIndexedOpaqueCache, aUnindexedOpaqueCache, aPointLightOpaqueCache);
+                        SortOpaque(mpActiveCamera, aPointLightOpaqueCache);
                         Render(mpActiveCamera, ShaderPass::k_point, aPointLightOpaqueCache);
                     }
                     
@@ -311,7 +336,7 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Sort Opaque
         //----------------------------------------------------------
-        void Renderer::SortOpaque(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const
+        void Renderer::SortOpaque(CameraComponent* inpCameraComponent, Core::FrameVector<RenderComponent*>& inaRenderables) const
         {
             RendererSortPredicateSPtr pOpaqueSort = inpCameraComponent->GetOpaqueSortPredicate();
             if(!pOpaqueSort)
@@ -328,7 +353,7 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Sort Transparent
         //----------------------------------------------------------
-        void Renderer::SortTransparent(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const
+        void Renderer::SortTransparent(CameraComponent* inpCameraComponent, Core::FrameVector<RenderComponent*>& inaRenderables) const
         {
             RendererSortPredicateSPtr pTransparentSort = inpCameraComponent->GetTransparentSortPredicate();
             if(!pTransparentSort)
@@ -345,9 +370,9 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Render Shadow Map
         //----------------------------------------------------------
-        void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, std::vector<RenderComponent*>& inaRenderables)
+        void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, const std::vector<RenderComponent*>& inaRenderables)
         {
-            std::vector<RenderComponent*> aFilteredShadowMapRenderCache;
+            Core::FrameVector<RenderComponent*> aFilteredShadowMapRenderCache(Core::Application::Get()->GetFrameAllocator());
             
             if(inaLightComponents.size() > 0)
             {
@@ -367,7 +392,7 @@ namespace ChilliSource
         //----------------------------------------------------------
 		/// Render Shadow Map
 		//----------------------------------------------------------
-		void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, DirectionalLightComponent* inpLightComponent, std::vector<RenderComponent*>& inaRenderables)
+		void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, DirectionalLightComponent* inpLightComponent, const Core::FrameVector<RenderComponent*>& inaRenderables)
 		{
 			//Create a new offscreen render target using the given texture
 			RenderTarget* pRenderTarget = mpRenderSystem->CreateRenderTarget(inpLightComponent->GetShadowMapPtr()->GetWidth(), inpLightComponent->GetShadowMapPtr()->GetHeight());
@@ -376,7 +401,7 @@ namespace ChilliSource
             mpRenderSystem->BeginFrame(pRenderTarget);
             
             //Only opaque objects cast and receive shadows
-            for(std::vector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
+            for(Core::FrameVector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
             {
                 (*it)->RenderShadowMap(mpRenderSystem, inpCameraComponent, m_staticDirShadowMaterial, m_animDirShadowMaterial);
             }
@@ -388,9 +413,9 @@ namespace ChilliSource
         //----------------------------------------------------------
 		/// Render
 		//----------------------------------------------------------
-		void Renderer::Render(CameraComponent* inpCameraComponent, ShaderPass ineShaderPass, std::vector<RenderComponent*>& inaRenderables)
+		void Renderer::Render(CameraComponent* inpCameraComponent, ShaderPass ineShaderPass, const Core::FrameVector<RenderComponent*>& inaRenderables)
 		{
-            for(std::vector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
+            for(Core::FrameVector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
             {
                 (*it)->Render(mpRenderSystem, inpCameraComponent, ineShaderPass);
             }
@@ -409,18 +434,40 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Cull Renderables
         //----------------------------------------------------------
-		void Renderer::CullRenderables(CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const
+		void Renderer::CullRenderables(Core::Scene* inpScene, CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, Core::FrameVector<RenderComponent*>& outaRenderCache) const
 		{
             ICullingPredicate * pCullingPredicate = GetCullPredicate(inpCamera).get();
             
             if(pCullingPredicate == nullptr)
             {
-                outaRenderCache = inaRenderCache;
+                outaRenderCache.assign(inaRenderCache.begin(), inaRenderCache.end());
                 return;
             }
             
             outaRenderCache.reserve(inaRenderCache.size());
             
+            //The default predicates only test the item's bounds against the camera frustum, so the scene's
+            //bounding volume hierarchy can be used to find the candidates for everything it contains. Only
+            //exact matches are used as derived predicates may behave differently.
+            bool bUseHierarchy = (typeid(*pCullingPredicate) == typeid(FrustumCullPredicate) || typeid(*pCullingPredicate) == typeid(ViewportCullPredicate));
+            if(bUseHierarchy == true)
+            {
+                std::vector<Core::VolumeComponent*> aCandidateVolumes;
+                inpScene->QuerySceneForPotentialIntersection(inpCamera->GetFrustum(), aCandidateVolumes);
+                
+                for(std::vector<Core::VolumeComponent*>::const_iterator it = aCandidateVolumes.begin(); it != aCandidateVolumes.end(); ++it)
+                {
+                    if((*it)->IsA(RenderComponent::InterfaceID) == true)
+                    {
+                        RenderComponent* pRenderable = static_cast<RenderComponent*>(*it);
+                        if(pRenderable->IsVisible() == true && pRenderable->IsCullingEnabled() == true && pCullingPredicate->CullItem(inpCamera, pRenderable) == false)
+                        {
+                            outaRenderCache.push_back(pRenderable);
+                        }
+                    }
+                }
+            }
+            
 			for(std::vector<RenderComponent*>::const_iterator it = inaRenderCache.begin(); it != inaRenderCache.end(); ++it)
 			{
 				RenderComponent* pRenderable = (*it);
@@ -430,26 +477,53 @@ namespace ChilliSource
                     continue;
                 }
                 
-                if(pRenderable->IsCullingEnabled() == false || pCullingPredicate->CullItem(inpCamera, pRenderable) == false)
+                if(pRenderable->IsCullingEnabled() == false)
                 {
                     outaRenderCache.push_back(pRenderable);
                     continue;
                 }
+                
+                if(bUseHierarchy == true && pRenderable->IsA(Core::VolumeComponent::InterfaceID) == true)
+                {
+                    //already handled by the hierarchy query
+                    continue;
+                }
+                
+                if(pCullingPredicate->CullItem(inpCamera, pRenderable) == false)
+                {
+                    outaRenderCache.push_back(pRenderable);
+                }
 			}
 		}
         //----------------------------------------------------------
         /// Cull Renderables
         //----------------------------------------------------------
-		void Renderer::CullRenderables(PointLightComponent* inpLightComponent, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const
+		void Renderer::CullRenderables(Core::Scene* inpScene, PointLightComponent* inpLightComponent, const RenderComponentSet& inaIndexedRenderCache, const Core::FrameVector<RenderComponent*>& inaUnindexedRenderCache, Core::FrameVector<RenderComponent*>& outaRenderCache) const
         {
-            //Reserve estimated space
-            outaRenderCache.reserve(inaRenderCache.size());
-            
             Core::Sphere aLightSphere;
             aLightSphere.vOrigin = inpLightComponent->GetWorldPosition();
             aLightSphere.fRadius = inpLightComponent->GetRangeOfInfluence();
             
-            for(std::vector<RenderComponent*>::const_iterator it = inaRenderCache.begin(); it != inaRenderCache.end(); ++it)
+            std::vector<Core::VolumeComponent*> aLitVolumes;
+            inpScene->QuerySceneForIntersection(aLightSphere, aLitVolumes);
+            
+            //Reserve estimated space
+            outaRenderCache.reserve(aLitVolumes.size() + inaUnindexedRenderCache.size());
+            
+            //The query covers the whole scene, so only keep those in the given set
+            for(std::vector<Core::VolumeComponent*>::const_iterator it = aLitVolumes.begin(); it != aLitVolumes.end(); ++it)
+            {
+                if((*it)->IsA(RenderComponent::InterfaceID) == true)
+                {
+                    RenderComponent* pRenderable = static_cast<RenderComponent*>(*it);
+                    if(inaIndexedRenderCache.find(pRenderable) != inaIndexedRenderCache.end())
+                    {
+                        outaRenderCache.push_back(pRenderable);
+                    }
+                }
+            }
+            
+            for(Core::FrameVector<RenderComponent*>::const_iterator it = inaUnindexedRenderCache.begin(); it != inaUnindexedRenderCache.end(); ++it)
             {
                 if(Core::ShapeIntersection::Intersects(aLightSphere, (*it)->GetBoundingSphere()) == true)
                 {
@@ -460,13 +534,13 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Filter Scene Renderables
         //----------------------------------------------------------
-		void Renderer::FilterSceneRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaOpaque, std::vector<RenderComponent*>& outaTransparent) const
+		void Renderer::FilterSceneRenderables(const Core::FrameVector<RenderComponent*>& inaRenderables, Core::FrameVector<RenderComponent*>& outaOpaque, Core::FrameVector<RenderComponent*>& outaTransparent) const
 		{
             //Reserve estimated space
             outaOpaque.reserve(inaRenderables.size());
             outaTransparent.reserve(inaRenderables.size());
             
-			for(std::vector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
+			for(Core::FrameVector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
 			{
 				RenderComponent* pRenderable = (*it);
                 pRenderable->IsTransparent() ? outaTransparent.push_back(pRenderable) : outaOpaque.push_back(pRenderable);
@@ -475,7 +549,7 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Filter Shadow Map Renderables
         //----------------------------------------------------------
-        void Renderer::FilterShadowMapRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaRenderables) const
+        void Renderer::FilterShadowMapRenderables(const std::vector<RenderComponent*>& inaRenderables, Core::FrameVector<RenderComponent*>& outaRenderables) const
         {
             //Reserve estimated space
             outaRenderables.reserve(inaRenderables.size());
@@ -30,9 +30,12 @@
 #define _CHILLISOURCE_RENDERING_BASE_RENDERER_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/FrameAllocator.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Rendering/Base/CanvasRenderer.h>
 
+#include <unordered_set>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -119,6 +122,8 @@ namespace ChilliSource
 			
 		private:
             friend class Core::Application;
+            
+            using RenderComponentSet = std::unordered_set<RenderComponent*, std::hash<RenderComponent*>, std::equal_to<RenderComponent*>, Core::FrameAllocatorAdapter<RenderComponent*>>;
             //-------------------------------------------------------
             /// Factory method
             ///
@@ -155,7 +160,7 @@ namespace ChilliSource
             /// @param Light components
             /// @param Render components
             //----------------------------------------------------------
-            void RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, std::vector<RenderComponent*>& inaRenderables);
+            void RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, const std::vector<RenderComponent*>& inaRenderables);
             //----------------------------------------------------------
             /// Render Shadow Map
             ///
@@ -165,7 +170,7 @@ namespace ChilliSource
             /// @param Light component
             /// @param Render components
             //----------------------------------------------------------
-            void RenderShadowMap(CameraComponent* inpCameraComponent, DirectionalLightComponent* inpLightComponent, std::vector<RenderComponent*>& inaRenderables);
+            void RenderShadowMap(CameraComponent* inpCameraComponent, DirectionalLightComponent* inpLightComponent, const Core::FrameVector<RenderComponent*>& inaRenderables);
 			//----------------------------------------------------------
 			/// Render
 			///
@@ -177,7 +182,7 @@ namespace ChilliSource
             /// @param The shader pass.
             /// @param Renderables
 			//----------------------------------------------------------
-			void Render(CameraComponent* inpCameraComponent, ShaderPass ineShaderPass, std::vector<RenderComponent*>& inaRenderables);
+			void Render(CameraComponent* inpCameraComponent, ShaderPass ineShaderPass, const Core::FrameVector<RenderComponent*>& inaRenderables);
             //----------------------------------------------------------
 			/// Render UI
             ///
@@ -213,19 +218,30 @@ namespace ChilliSource
             //----------------------------------------------------------
             /// Cull Renderables
             ///
+            /// When the default frustum culling is in use, the scene's
+            /// bounding volume hierarchy is queried rather than testing
+            /// each renderable.
+            ///
+            /// @param The scene the renderables belong to
             /// @param Camera to cull against
             /// @param Renderables to cull
             /// @param [Out]: Visible renderables
             //----------------------------------------------------------
-            void CullRenderables(CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const;
+            void CullRenderables(Core::Scene* inpScene, CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, Core::FrameVector<RenderComponent*>& outaRenderCache) const;
             //----------------------------------------------------------
             /// Cull Renderables
             ///
+            /// Finds the renderables lit by the given point light by
+            /// querying the scene's bounding volume hierarchy.
+            ///
+            /// @param The scene the renderables belong to
             /// @param Light to cull against
-            /// @param Renderables to cull
+            /// @param Renderables to cull which are volume components,
+            /// and so are held in the scene's hierarchy
+            /// @param Renderables to cull which are not volume components
             /// @param [Out]: Visible renderables
             //----------------------------------------------------------
-            void CullRenderables(PointLightComponent* inpLightComponent, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const;
+            void CullRenderables(Core::Scene* inpScene, PointLightComponent* inpLightComponent, const RenderComponentSet& inaIndexedRenderCache, const Core::FrameVector<RenderComponent*>& inaUnindexedRenderCache, Core::FrameVector<RenderComponent*>& outaRenderCache) const;
 			//----------------------------------------------------------
 			/// Filter Scene Renderables
 			///
@@ -235,7 +251,7 @@ namespace ChilliSource
             /// @param Out: Opaque renderables
             /// @param Out: Transparent renderables
 			//----------------------------------------------------------
-			void FilterSceneRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaOpaque, std::vector<RenderComponent*>& outaTransparent) const;
+			void FilterSceneRenderables(const Core::FrameVector<RenderComponent*>& inaRenderables, Core::FrameVector<RenderComponent*>& outaOpaque, Core::FrameVector<RenderComponent*>& outaTransparent) const;
             //----------------------------------------------------------
 			/// Filter Shadow Map Renderables
 			///
@@ -245,7 +261,7 @@ namespace ChilliSource
             /// @param List of renderable objects
             /// @param Out: renderables
 			//----------------------------------------------------------
-			void FilterShadowMapRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaRenderables) const;
+			void FilterShadowMapRenderables(const std::vector<RenderComponent*>& inaRenderables, Core::FrameVector<RenderComponent*>& outaRenderables) const;
             //----------------------------------------------------------
             /// Get Cull Predicate
             ///
@@ -270,7 +286,7 @@ namespace ChilliSource
             /// @param Camera component
             /// @param Renderables
             //----------------------------------------------------------
-            void SortOpaque(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const;
+            void SortOpaque(CameraComponent* inpCameraComponent, Core::FrameVector<RenderComponent*>& inaRenderables) const;
             //----------------------------------------------------------
             /// Sort Transparent
             ///
@@ -280,7 +296,7 @@ namespace ChilliSource
             /// @param Camera component
             /// @param Renderables
             //----------------------------------------------------------
-            void SortTransparent(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const;
+            void SortTransparent(CameraComponent* inpCameraComponent, Core::FrameVector<RenderComponent*>& inaRenderables) const;
             //------------------------------------------------
             /// Called when the application is being destroyed.
             /// This should be used to cleanup memory and
@@ -306,6 +322,11 @@ namespace ChilliSource
             
             MaterialCSPtr m_staticDirShadowMaterial;
             MaterialCSPtr m_animDirShadowMaterial;
+            
+            std::vector<RenderComponent*> m_preFilteredRenderCache;
+            std::vector<CameraComponent*> m_cameraCache;
+            std::vector<DirectionalLightComponent*> m_dirLightCache;
+            std::vector<PointLightComponent*> m_pointLightCache;
 		};
 	}
 }
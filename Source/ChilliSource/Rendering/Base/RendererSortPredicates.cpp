@@ -39,7 +39,7 @@ namespace ChilliSource
 {
 	namespace Rendering
     {
-		void BackToFrontSortPredicate::PrepareForSort(std::vector<RenderComponent*> * inpRenderable)
+		void BackToFrontSortPredicate::PrepareForSort(Core::FrameVector<RenderComponent*> * inpRenderable)
         {
 			mCameraViewProj = Renderer::matViewProjCache;
             
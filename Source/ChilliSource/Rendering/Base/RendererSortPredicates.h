@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_RENDERING_RENDERERSORTPREDICATES_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/FrameAllocator.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 
 #include <vector>
@@ -45,7 +46,7 @@ namespace ChilliSource
         {
 		public:
 			virtual ~RendererSortPredicate(){}
-			virtual void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) = 0;
+			virtual void PrepareForSort(Core::FrameVector<RenderComponent*> * inpRenderables = nullptr) = 0;
 			virtual bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const = 0;
 			bool operator()(const RenderComponent* p1, const RenderComponent* p2) const
             {
@@ -59,7 +60,7 @@ namespace ChilliSource
 		class NullSortPredicate final : public RendererSortPredicate
         {
 		public:
-            void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) override {}
+            void PrepareForSort(Core::FrameVector<RenderComponent*> * inpRenderables = nullptr) override {}
             bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const override {return false;}
 		};
 		
@@ -69,7 +70,7 @@ namespace ChilliSource
 		class BackToFrontSortPredicate final : public RendererSortPredicate
         {
 		public:
-            void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) override;
+            void PrepareForSort(Core::FrameVector<RenderComponent*> * inpRenderables = nullptr) override;
             bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const override;
 		private:
 			Core::Matrix4 mCameraViewProj;
@@ -81,7 +82,7 @@ namespace ChilliSource
 		class MaterialSortPredicate final : public RendererSortPredicate
         {
 		public:
-            void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) override {}
+            void PrepareForSort(Core::FrameVector<RenderComponent*> * inpRenderables = nullptr) override {}
             bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const override;
 		};
 	}
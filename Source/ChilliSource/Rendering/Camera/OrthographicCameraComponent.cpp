@@ -37,6 +37,7 @@ namespace ChilliSource
 	namespace Rendering
 	{
 		CS_DEFINE_NAMEDTYPE(OrthographicCameraComponent);
+		CS_DEFINE_POOLEDTYPE(OrthographicCameraComponent);
         //----------------------------------------------------------
         //----------------------------------------------------------
         OrthographicCameraComponent::OrthographicCameraComponent(const Core::Vector2& in_viewportSize, ViewportResizePolicy in_resizePolicy, f32 in_nearClip, f32 in_farClip)
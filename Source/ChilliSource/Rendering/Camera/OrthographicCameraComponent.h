@@ -29,6 +29,7 @@
 #ifndef _CHILLISOURCE_RENDERING_CAMERA_ORTHOGRAPHICCAMERACOMPONENT_H_
 #define _CHILLISOURCE_RENDERING_CAMERA_ORTHOGRAPHICCAMERACOMPONENT_H_
 
+#include <ChilliSource/Core/Container/ObjectPool.h>
 #include <ChilliSource/Rendering/Camera/CameraComponent.h>
 
 namespace ChilliSource
@@ -46,6 +47,7 @@ namespace ChilliSource
 		public:
 
 			CS_DECLARE_NAMEDTYPE(OrthographicCameraComponent);
+			CS_DECLARE_POOLEDTYPE(OrthographicCameraComponent);
             //----------------------------------------------------------
             /// Constructor
             ///
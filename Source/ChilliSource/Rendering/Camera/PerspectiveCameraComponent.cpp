@@ -37,6 +37,7 @@ namespace ChilliSource
 	namespace Rendering
 	{
 		CS_DEFINE_NAMEDTYPE(PerspectiveCameraComponent);
+		CS_DEFINE_POOLEDTYPE(PerspectiveCameraComponent);
         //----------------------------------------------------------
         //----------------------------------------------------------
         PerspectiveCameraComponent::PerspectiveCameraComponent(f32 in_aspectRatio, f32 in_fov, ViewportResizePolicy in_resizePolicy, f32 in_nearClip, f32 in_farClip)
@@ -29,6 +29,7 @@
 #ifndef _CHILLISOURCE_RENDERING_CAMERA_PERSPECTIVECAMERACOMPONENT_H_
 #define _CHILLISOURCE_RENDERING_CAMERA_PERSPECTIVECAMERACOMPONENT_H_
 
+#include <ChilliSource/Core/Container/ObjectPool.h>
 #include <ChilliSource/Rendering/Camera/CameraComponent.h>
 
 namespace ChilliSource
@@ -45,6 +46,7 @@ namespace ChilliSource
 		{
 		public:
 			CS_DECLARE_NAMEDTYPE(PerspectiveCameraComponent);
+			CS_DECLARE_POOLEDTYPE(PerspectiveCameraComponent);
             //----------------------------------------------------------
             /// Constructor
             ///
@@ -101,6 +101,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(SkinnedAnimation);
         CS_FORWARDDECLARE_STRUCT(SkeletonNode);
         CS_FORWARDDECLARE_CLASS(SkinnedAnimationGroup);
+        CS_FORWARDDECLARE_CLASS(SkinnedAnimationResourceOptions);
         CS_FORWARDDECLARE_CLASS(StaticMeshComponent);
         CS_FORWARDDECLARE_CLASS(SubMesh);
         //------------------------------------------------------------
@@ -120,6 +121,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(ConeParticleEmitter);
         CS_FORWARDDECLARE_CLASS(ParticleEmitter);
         CS_FORWARDDECLARE_CLASS(ParticleEmitterFactory);
+        CS_FORWARDDECLARE_STRUCT(ParticleEmitterProperties);
         CS_FORWARDDECLARE_CLASS(PointParticleEmitter);
         CS_FORWARDDECLARE_CLASS(RingParticleEmitter);
         //------------------------------------------------------------
@@ -33,6 +33,7 @@ namespace ChilliSource
 	namespace Rendering
 	{
 		CS_DEFINE_NAMEDTYPE(AmbientLightComponent);
+		CS_DEFINE_POOLEDTYPE(AmbientLightComponent);
         
 		//----------------------------------------------------------
 		/// Is A
@@ -47,6 +47,7 @@ namespace ChilliSource
         }
         
 		CS_DEFINE_NAMEDTYPE(DirectionalLightComponent);
+		CS_DEFINE_POOLEDTYPE(DirectionalLightComponent);
         
         //----------------------------------------------------------
         /// Constructor
@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_RENDERING_COMPONENTS_DIRECTIONALLIGHTCOMPONENT_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/ObjectPool.h>
 #include <ChilliSource/Rendering/Lighting/LightComponent.h>
 
 namespace ChilliSource
@@ -40,6 +41,7 @@ namespace ChilliSource
 		{
 		public:
 			CS_DECLARE_NAMEDTYPE(DirectionalLightComponent);
+			CS_DECLARE_POOLEDTYPE(DirectionalLightComponent);
 			
             //----------------------------------------------------------
             /// Constructor
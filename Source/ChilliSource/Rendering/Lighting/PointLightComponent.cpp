@@ -38,6 +38,7 @@ namespace ChilliSource
 	namespace Rendering
 	{
         CS_DEFINE_NAMEDTYPE(PointLightComponent);
+        CS_DEFINE_POOLEDTYPE(PointLightComponent);
 
 		//----------------------------------------------------------
 		/// Constructor
@@ -30,6 +30,10 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/File/BinaryReader.h>
+#include <ChilliSource/Core/File/BinaryWriter.h>
+#include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
@@ -43,6 +47,8 @@
 #include <ChilliSource/Rendering/Texture/CubemapResourceOptions.h>
 #include <ChilliSource/Rendering/Texture/TextureResourceOptions.h>
 
+#include <atomic>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -51,6 +57,9 @@ namespace ChilliSource
 		{
 			const std::string k_materialExtension("csmaterial");
             
+            const u32 k_cookedMaterialMagic = 0x544D5343; //"CSMT"
+            const u32 k_cookedMaterialVersion = 1;
+            
             //----------------------------------------------------------------------------
             /// The resource types supported by materials
             //----------------------------------------------------------------------------
@@ -65,7 +74,7 @@ namespace ChilliSource
             ///
             /// @author S Downie
             //-------------------------------------------------------------------------
-            struct ChainedLoadDesc
+            struct ResourceLoadDesc
             {
                 ResourceType m_type;
                 std::string m_filePath;
@@ -77,6 +86,73 @@ namespace ChilliSource
                 Texture::WrapMode m_wrapModeV;
             };
             //----------------------------------------------------------------------------
+            /// The types of shader variable that can be described by a material
+            //----------------------------------------------------------------------------
+            enum class ShaderVarType
+            {
+                k_float,
+                k_vector2,
+                k_vector3,
+                k_vector4,
+                k_colour,
+                k_matrix
+            };
+            //-------------------------------------------------------------------------
+            /// Holds the description of a single shader variable. Only the value
+            /// matching the variable type is used.
+            //-------------------------------------------------------------------------
+            struct ShaderVarDesc
+            {
+                std::string m_name;
+                ShaderVarType m_type = ShaderVarType::k_float;
+                f32 m_float = 0.0f;
+                Core::Vector2 m_vector2;
+                Core::Vector3 m_vector3;
+                Core::Vector4 m_vector4;
+                Core::Colour m_colour;
+                Core::Matrix4 m_matrix;
+            };
+            //-------------------------------------------------------------------------
+            /// Holds everything described by a material file, regardless of whether
+            /// it was read from XML or from the cooked binary format. Render states
+            /// and lighting values are only applied to the material if they were
+            /// specified, otherwise the material defaults are kept.
+            //-------------------------------------------------------------------------
+            struct MaterialDesc
+            {
+                std::string m_type = "Static";
+                
+                bool m_hasDepthWrite = false;
+                bool m_isDepthWriteEnabled = true;
+                bool m_hasDepthTest = false;
+                bool m_isDepthTestEnabled = true;
+                bool m_hasTransparency = false;
+                bool m_isTransparencyEnabled = false;
+                bool m_hasFaceCulling = false;
+                bool m_isFaceCullingEnabled = true;
+                
+                bool m_hasBlendModes = false;
+                BlendMode m_sourceBlendMode = BlendMode::k_one;
+                BlendMode m_destBlendMode = BlendMode::k_one;
+                
+                bool m_hasCullFace = false;
+                CullFace m_cullFace = CullFace::k_front;
+                
+                bool m_hasLighting = false;
+                bool m_hasEmissive = false;
+                bool m_hasAmbient = false;
+                bool m_hasDiffuse = false;
+                Core::Colour m_emissive;
+                Core::Colour m_ambient;
+                Core::Colour m_diffuse;
+                Core::Colour m_specular = Core::Colour(1.0f, 1.0f, 1.0f, 0.0f);
+                
+                std::vector<MaterialProvider::ShaderDesc> m_shaderOverrides;
+                std::vector<ShaderVarDesc> m_shaderVars;
+                std::vector<MaterialProvider::TextureDesc> m_textures;
+                std::vector<MaterialProvider::TextureDesc> m_cubemaps;
+            };
+            //----------------------------------------------------------------------------
             /// @author S Downie
             ///
             /// @param String describing mode
@@ -301,16 +377,15 @@ namespace ChilliSource
                 CS_LOG_FATAL("Invalid material type: " + in_materialType);
             }
             //----------------------------------------------------------------------------
-            /// Parse the render states from the XML element to the material
+            /// Parse the render states from the XML element to the material description
             ///
             /// @author S Downie
             ///
             /// @param Root element
-            /// @param [Out] Material to populate
+            /// @param [Out] Material description to populate
             //----------------------------------------------------------------------------
-            void ParseRenderStates(Core::XML::Node* in_rootElement, Material* out_material)
+            void ParseRenderStates(Core::XML::Node* in_rootElement, MaterialDesc& out_desc)
             {
-                
                 Core::XML::Node* renderStatesEl = Core::XMLUtils::GetFirstChildElement(in_rootElement, "RenderStates");
                 if(renderStatesEl)
                 {
@@ -318,128 +393,133 @@ namespace ChilliSource
                     Core::XML::Node* depthWriteStateEl =  Core::XMLUtils::GetFirstChildElement(renderStatesEl, "DepthWrite");
                     if(depthWriteStateEl)
                     {
-                        out_material->SetDepthWriteEnabled(Core::XMLUtils::GetAttributeValue(depthWriteStateEl, "enabled", true));
+                        out_desc.m_hasDepthWrite = true;
+                        out_desc.m_isDepthWriteEnabled = Core::XMLUtils::GetAttributeValue(depthWriteStateEl, "enabled", true);
                     }
                     //---Depth Testing
                     Core::XML::Node* depthTestStateEl = Core::XMLUtils::GetFirstChildElement(renderStatesEl, "DepthTest");
                     if(depthTestStateEl)
                     {
-                        out_material->SetDepthTestEnabled(Core::XMLUtils::GetAttributeValue<bool>(depthTestStateEl, "enabled", true));
+                        out_desc.m_hasDepthTest = true;
+                        out_desc.m_isDepthTestEnabled = Core::XMLUtils::GetAttributeValue<bool>(depthTestStateEl, "enabled", true);
                     }
                     //---Transparency
                     Core::XML::Node* transparentStateEl = Core::XMLUtils::GetFirstChildElement(renderStatesEl, "Transparency");
                     if(transparentStateEl)
                     {
-                        out_material->SetTransparencyEnabled(Core::XMLUtils::GetAttributeValue<bool>(transparentStateEl, "enabled", false));
+                        out_desc.m_hasTransparency = true;
+                        out_desc.m_isTransparencyEnabled = Core::XMLUtils::GetAttributeValue<bool>(transparentStateEl, "enabled", false);
                     }
                     //---Culling
                     Core::XML::Node* cullingStateEl = Core::XMLUtils::GetFirstChildElement(renderStatesEl, "Culling");
                     if(cullingStateEl)
                     {
-                        out_material->SetFaceCullingEnabled(Core::XMLUtils::GetAttributeValue<bool>(cullingStateEl, "enabled", true));
+                        out_desc.m_hasFaceCulling = true;
+                        out_desc.m_isFaceCullingEnabled = Core::XMLUtils::GetAttributeValue<bool>(cullingStateEl, "enabled", true);
                     }
                 }
             }
             //----------------------------------------------------------------------------
             /// Parse the alpha blend function from the XML element to the material
+            /// description
             ///
             /// @author S Downie
             ///
             /// @param Root element
-            /// @param [Out] Material to populate
+            /// @param [Out] Material description to populate
             //----------------------------------------------------------------------------
-            void ParseAlphaBlendFunction(Core::XML::Node* in_rootElement, Material* out_material)
+            void ParseAlphaBlendFunction(Core::XML::Node* in_rootElement, MaterialDesc& out_desc)
             {
                 Core::XML::Node* blendFuncEl = Core::XMLUtils::GetFirstChildElement(in_rootElement, "BlendFunc");
                 if(blendFuncEl)
                 {
                     const std::string srcFuncString = Core::XMLUtils::GetAttributeValue<std::string>(blendFuncEl, "src", "One");
-                    BlendMode srcFunc = ConvertStringToBlendMode(srcFuncString);
-                    
                     const std::string dstFuncString = Core::XMLUtils::GetAttributeValue<std::string>(blendFuncEl, "dst", "One");
-                    BlendMode dstFunc = ConvertStringToBlendMode(dstFuncString);
                     
-                    out_material->SetBlendModes(srcFunc, dstFunc);
+                    out_desc.m_hasBlendModes = true;
+                    out_desc.m_sourceBlendMode = ConvertStringToBlendMode(srcFuncString);
+                    out_desc.m_destBlendMode = ConvertStringToBlendMode(dstFuncString);
                 }
             }
             //----------------------------------------------------------------------------
-            /// Parse the cull function from the XML element to the material
+            /// Parse the cull function from the XML element to the material description
             ///
             /// @author S Downie
             ///
             /// @param Root element
-            /// @param [Out] Material to populate
+            /// @param [Out] Material description to populate
             //----------------------------------------------------------------------------
-            void ParseCullFunction(Core::XML::Node* in_rootElement, Material* out_material)
+            void ParseCullFunction(Core::XML::Node* in_rootElement, MaterialDesc& out_desc)
             {
                 Core::XML::Node* cullFaceEl = Core::XMLUtils::GetFirstChildElement(in_rootElement, "Culling");
                 if(cullFaceEl)
                 {
                     const std::string& cullFaceString = Core::XMLUtils::GetAttributeValue<std::string>(cullFaceEl, "face", "Front");
-                    CullFace cullFace = ConvertStringToCullFace(cullFaceString);
-                    out_material->SetCullFace(cullFace);
+                    out_desc.m_hasCullFace = true;
+                    out_desc.m_cullFace = ConvertStringToCullFace(cullFaceString);
                 }
             }
             //----------------------------------------------------------------------------
             /// Parse the surface date such as shininess etc from the XML element
-            /// to the material
+            /// to the material description
             ///
             /// @author S Downie
             ///
             /// @param Root element
-            /// @param [Out] Material to populate
+            /// @param [Out] Material description to populate
             //----------------------------------------------------------------------------
-            void ParseSurface(Core::XML::Node* in_rootElement, Material* out_material)
+            void ParseSurface(Core::XML::Node* in_rootElement, MaterialDesc& out_desc)
             {
                 Core::XML::Node* lightingEl = Core::XMLUtils::GetFirstChildElement(in_rootElement, "Lighting");
                 if(lightingEl)
                 {
+                    out_desc.m_hasLighting = true;
+                    
                     //---Emissive
                     Core::XML::Node* emissiveEl = Core::XMLUtils::GetFirstChildElement(lightingEl, "Emissive");
                     if(emissiveEl)
                     {
-                        out_material->SetEmissive(Core::XMLUtils::GetAttributeValue<Core::Colour>(emissiveEl, "value", Core::Colour::k_white));
+                        out_desc.m_hasEmissive = true;
+                        out_desc.m_emissive = Core::XMLUtils::GetAttributeValue<Core::Colour>(emissiveEl, "value", Core::Colour::k_white);
                     }
                     //---Ambient Lighting
                     Core::XML::Node* ambientEl = Core::XMLUtils::GetFirstChildElement(lightingEl, "Ambient");
                     if(ambientEl)
                     {
-                        out_material->SetAmbient(Core::XMLUtils::GetAttributeValue<Core::Colour>(ambientEl, "value", Core::Colour::k_white));
+                        out_desc.m_hasAmbient = true;
+                        out_desc.m_ambient = Core::XMLUtils::GetAttributeValue<Core::Colour>(ambientEl, "value", Core::Colour::k_white);
                     }
                     //---Diffuse Lighting
                     Core::XML::Node* diffuseEl = Core::XMLUtils::GetFirstChildElement(lightingEl, "Diffuse");
                     if(diffuseEl)
                     {
-                        out_material->SetDiffuse(Core::XMLUtils::GetAttributeValue<Core::Colour>(diffuseEl, "value", Core::Colour::k_white));
+                        out_desc.m_hasDiffuse = true;
+                        out_desc.m_diffuse = Core::XMLUtils::GetAttributeValue<Core::Colour>(diffuseEl, "value", Core::Colour::k_white);
                     }
                     //---Specular Lighting
-                    Core::Colour specular(1.0f, 1.0f, 1.0f, 0.0f);
                     Core::XML::Node* specularEl = Core::XMLUtils::GetFirstChildElement(lightingEl, "Specular");
                     if(specularEl)
                     {
-                        specular = Core::XMLUtils::GetAttributeValue<Core::Colour>(specularEl, "value", Core::Colour::k_white);
+                        out_desc.m_specular = Core::XMLUtils::GetAttributeValue<Core::Colour>(specularEl, "value", Core::Colour::k_white);
                     }
                     
                     //---Intensity
                     Core::XML::Node* shininessEl = Core::XMLUtils::GetFirstChildElement(lightingEl, "Shininess");
                     if(shininessEl)
                     {
-                        specular.a = Core::XMLUtils::GetAttributeValue<f32>(shininessEl, "value", 0.0f);
+                        out_desc.m_specular.a = Core::XMLUtils::GetAttributeValue<f32>(shininessEl, "value", 0.0f);
                     }
-                    
-                    out_material->SetSpecular(specular);
                 }
             }
             //----------------------------------------------------------------------------
-            /// Parse the shader file paths
+            /// Parse the custom shader file paths and the shader variables
             ///
             /// @author S Downie
             ///
             /// @param Root element
-            /// @param [Out] Shader files to populate
-            /// @param [Out] Material to populate
+            /// @param [Out] Material description to populate
             //----------------------------------------------------------------------------
-            void ParseShaders(Core::XML::Node* in_rootElement, std::vector<MaterialProvider::ShaderDesc>& out_shaderFiles, Material* out_material)
+            void ParseShaders(Core::XML::Node* in_rootElement, MaterialDesc& out_desc)
             {
                 const u32 numShaderNodes = 3;
                 const std::pair<std::string, ShaderPass> shaderNodes[numShaderNodes] =
@@ -454,19 +534,15 @@ namespace ChilliSource
                 {
                     for(u32 i=0; i<numShaderNodes; ++i)
                     {
-                        //Overwrite any of the default files for this material type with specified custom ones
+                        //These overwrite the default files for the material type once it is resolved
                         Core::XML::Node* shaderEl = Core::XMLUtils::GetFirstChildElement(shadersEl, shaderNodes[i].first);
                         if(shaderEl)
                         {
-                            for(u32 udwShaderFilesIndex = 0; udwShaderFilesIndex<out_shaderFiles.size(); ++udwShaderFilesIndex)
-                            {
-                                if(out_shaderFiles[udwShaderFilesIndex].m_pass == shaderNodes[i].second)
-                                {
-                                    out_shaderFiles[udwShaderFilesIndex].m_location = Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(shaderEl, "location", "Package"));
-                                    out_shaderFiles[udwShaderFilesIndex].m_filePath = Core::XMLUtils::GetAttributeValue<std::string>(shaderEl, "file-name", "");
-                                    break;
-                                }
-                            }
+                            MaterialProvider::ShaderDesc desc;
+                            desc.m_location = Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(shaderEl, "location", "Package"));
+                            desc.m_filePath = Core::XMLUtils::GetAttributeValue<std::string>(shaderEl, "file-name", "");
+                            desc.m_pass = shaderNodes[i].second;
+                            out_desc.m_shaderOverrides.push_back(desc);
                         }
                     }
                     
@@ -476,47 +552,84 @@ namespace ChilliSource
                     {
                         //Get the variable type
                         std::string strType = Core::XMLUtils::GetAttributeValue<std::string>(shaderVarEl, "type", "");
-                        //Get the variable name
-                        std::string strName = Core::XMLUtils::GetAttributeValue<std::string>(shaderVarEl, "name", "");
-                        //Add the variable to the material
+                        
+                        ShaderVarDesc varDesc;
+                        varDesc.m_name = Core::XMLUtils::GetAttributeValue<std::string>(shaderVarEl, "name", "");
+                        
+                        bool isValid = true;
                         if(strType == "Float")
                         {
-                            out_material->SetShaderVar(strName, Core::XMLUtils::GetAttributeValue<f32>(shaderVarEl, "value", 0.0f));
+                            varDesc.m_type = ShaderVarType::k_float;
+                            varDesc.m_float = Core::XMLUtils::GetAttributeValue<f32>(shaderVarEl, "value", 0.0f);
                         }
                         else if(strType == "Vec2")
                         {
-                            out_material->SetShaderVar(strName, Core::XMLUtils::GetAttributeValue<Core::Vector2>(shaderVarEl, "value", Core::Vector2::k_zero));
+                            varDesc.m_type = ShaderVarType::k_vector2;
+                            varDesc.m_vector2 = Core::XMLUtils::GetAttributeValue<Core::Vector2>(shaderVarEl, "value", Core::Vector2::k_zero);
                         }
                         else if(strType == "Vec3")
                         {
-                            out_material->SetShaderVar(strName, Core::XMLUtils::GetAttributeValue<Core::Vector3>(shaderVarEl, "value", Core::Vector3::k_zero));
+                            varDesc.m_type = ShaderVarType::k_vector3;
+                            varDesc.m_vector3 = Core::XMLUtils::GetAttributeValue<Core::Vector3>(shaderVarEl, "value", Core::Vector3::k_zero);
                         }
                         else if(strType == "Vec4")
                         {
-                            out_material->SetShaderVar(strName, Core::XMLUtils::GetAttributeValue<Core::Vector4>(shaderVarEl, "value", Core::Vector4::k_zero));
+                            varDesc.m_type = ShaderVarType::k_vector4;
+                            varDesc.m_vector4 = Core::XMLUtils::GetAttributeValue<Core::Vector4>(shaderVarEl, "value", Core::Vector4::k_zero);
                         }
                         else if(strType == "Colour")
                         {
-                            out_material->SetShaderVar(strName, Core::XMLUtils::GetAttributeValue<Core::Colour>(shaderVarEl, "value", Core::Colour::k_white));
+                            varDesc.m_type = ShaderVarType::k_colour;
+                            varDesc.m_colour = Core::XMLUtils::GetAttributeValue<Core::Colour>(shaderVarEl, "value", Core::Colour::k_white);
                         }
                         else if(strType == "Matrix")
                         {
-                            out_material->SetShaderVar(strName, Core::XMLUtils::GetAttributeValue<Core::Matrix4>(shaderVarEl, "value", Core::Matrix4::k_identity));
+                            varDesc.m_type = ShaderVarType::k_matrix;
+                            varDesc.m_matrix = Core::XMLUtils::GetAttributeValue<Core::Matrix4>(shaderVarEl, "value", Core::Matrix4::k_identity);
                         }
+                        else
+                        {
+                            isValid = false;
+                        }
+                        
+                        if(isValid == true)
+                        {
+                            out_desc.m_shaderVars.push_back(varDesc);
+                        }
+                        
                         //Move on to the next variable
                         shaderVarEl =  Core::XMLUtils::GetNextSiblingElement(shaderVarEl, "Var");
                     }
                 }
             }
             //----------------------------------------------------------------------------
+            /// Parse a texture or cubemap description from the given element
+            ///
+            /// @param Texture or cubemap element
+            /// @param The name of the attribute holding the file path
+            ///
+            /// @return The texture description
+            //----------------------------------------------------------------------------
+            MaterialProvider::TextureDesc ParseTextureDesc(Core::XML::Node* in_element, const std::string& in_filePathAttribute)
+            {
+                MaterialProvider::TextureDesc desc;
+                desc.m_location = Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(in_element, "location", "Package"));
+                desc.m_filePath = Core::XMLUtils::GetAttributeValue<std::string>(in_element, in_filePathAttribute, "");
+                desc.m_shouldMipMap = Core::XMLUtils::GetAttributeValue<bool>(in_element, "mipmapped", false);
+                desc.m_filterMode = ConvertStringToFilterMode(Core::XMLUtils::GetAttributeValue<std::string>(in_element, "filter-mode", "Bilinear"));
+                desc.m_wrapModeU = ConvertStringToWrapMode(Core::XMLUtils::GetAttributeValue<std::string>(in_element, "wrap-mode-u", "Clamp"));
+                desc.m_wrapModeV = ConvertStringToWrapMode(Core::XMLUtils::GetAttributeValue<std::string>(in_element, "wrap-mode-v", "Clamp"));
+                return desc;
+            }
+            //----------------------------------------------------------------------------
             /// Parse the texture file paths
             ///
             /// @author S Downie
             ///
             /// @param Root element
-            /// @param [Out] Texture files to populate
+            /// @param [Out] Material description to populate
             //----------------------------------------------------------------------------
-            void ParseTextures(Core::XML::Node* in_rootElement, std::vector<MaterialProvider::TextureDesc>& out_textureFiles)
+            void ParseTextures(Core::XML::Node* in_rootElement, MaterialDesc& out_desc)
             {
                 Core::XML::Node* texturesEl = Core::XMLUtils::GetFirstChildElement(in_rootElement, "Textures");
                 if(texturesEl)
@@ -525,14 +638,7 @@ namespace ChilliSource
                     Core::XML::Node* textureEl = Core::XMLUtils::GetFirstChildElement(texturesEl, "Texture");
                     while(textureEl)
                     {
-                        MaterialProvider::TextureDesc desc;
-                        desc.m_location = Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(textureEl, "location", "Package"));
-                        desc.m_filePath = Core::XMLUtils::GetAttributeValue<std::string>(textureEl, "image-name", "");
-                        desc.m_shouldMipMap = Core::XMLUtils::GetAttributeValue<bool>(textureEl, "mipmapped", false);
-                        desc.m_filterMode = ConvertStringToFilterMode(Core::XMLUtils::GetAttributeValue<std::string>(textureEl, "filter-mode", "Bilinear"));
-                        desc.m_wrapModeU = ConvertStringToWrapMode(Core::XMLUtils::GetAttributeValue<std::string>(textureEl, "wrap-mode-u", "Clamp"));
-                        desc.m_wrapModeV = ConvertStringToWrapMode(Core::XMLUtils::GetAttributeValue<std::string>(textureEl, "wrap-mode-v", "Clamp"));
-                        out_textureFiles.push_back(desc);
+                        out_desc.m_textures.push_back(ParseTextureDesc(textureEl, "image-name"));
                         
                         textureEl =  Core::XMLUtils::GetNextSiblingElement(textureEl, "Texture");
                     }
@@ -544,132 +650,517 @@ namespace ChilliSource
             /// @author S Downie
             ///
             /// @param Root element
-            /// @param [Out] Cubemap files to populate
+            /// @param [Out] Material description to populate
             //----------------------------------------------------------------------------
-            void ParseCubemaps(Core::XML::Node* in_rootElement, std::vector<MaterialProvider::TextureDesc>& out_cubemapFiles)
+            void ParseCubemaps(Core::XML::Node* in_rootElement, MaterialDesc& out_desc)
             {
                 Core::XML::Node* cubemapEl = Core::XMLUtils::GetFirstChildElement(in_rootElement, "Cubemap");
                 if(cubemapEl)
+                {
+                    out_desc.m_cubemaps.push_back(ParseTextureDesc(cubemapEl, "base-name"));
+                }
+            }
+            //----------------------------------------------------------------------------
+            /// Reads the material description from the root element of a material XML
+            /// document.
+            ///
+            /// @param Root element
+            /// @param [Out] Material description to populate
+            //----------------------------------------------------------------------------
+            void ReadMaterialDesc(Core::XML::Node* in_rootElement, MaterialDesc& out_desc)
+            {
+                out_desc.m_type = Core::XMLUtils::GetAttributeValue<std::string>(in_rootElement, "type", "Static");
+                
+                ParseRenderStates(in_rootElement, out_desc);
+                ParseAlphaBlendFunction(in_rootElement, out_desc);
+                ParseCullFunction(in_rootElement, out_desc);
+                ParseSurface(in_rootElement, out_desc);
+                ParseShaders(in_rootElement, out_desc);
+                ParseTextures(in_rootElement, out_desc);
+                ParseCubemaps(in_rootElement, out_desc);
+            }
+            //----------------------------------------------------------------------------
+            /// @param The binary reader.
+            /// @param [Out] The texture descriptions.
+            //----------------------------------------------------------------------------
+            void ReadTextureDescs(Core::BinaryReader& in_reader, std::vector<MaterialProvider::TextureDesc>& out_descs)
+            {
+                u32 numDescs = in_reader.Read<u32>();
+                for(u32 i = 0; i < numDescs && in_reader.IsBad() == false; ++i)
                 {
                     MaterialProvider::TextureDesc desc;
-                    desc.m_location = Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(cubemapEl, "location", "Package"));
-                    desc.m_filePath = Core::XMLUtils::GetAttributeValue<std::string>(cubemapEl, "base-name", "");
-                    desc.m_shouldMipMap = Core::XMLUtils::GetAttributeValue<bool>(cubemapEl, "mipmapped", false);
-                    desc.m_filterMode = ConvertStringToFilterMode(Core::XMLUtils::GetAttributeValue<std::string>(cubemapEl, "filter-mode", "Bilinear"));
-                    desc.m_wrapModeU = ConvertStringToWrapMode(Core::XMLUtils::GetAttributeValue<std::string>(cubemapEl, "wrap-mode-u", "Clamp"));
-                    desc.m_wrapModeV = ConvertStringToWrapMode(Core::XMLUtils::GetAttributeValue<std::string>(cubemapEl, "wrap-mode-v", "Clamp"));
-                    out_cubemapFiles.push_back(desc);
+                    desc.m_location = Core::StorageLocation(in_reader.Read<u32>());
+                    desc.m_filePath = in_reader.ReadString();
+                    desc.m_shouldMipMap = (in_reader.Read<u8>() != 0);
+                    desc.m_filterMode = Texture::FilterMode(in_reader.Read<u32>());
+                    desc.m_wrapModeU = Texture::WrapMode(in_reader.Read<u32>());
+                    desc.m_wrapModeV = Texture::WrapMode(in_reader.Read<u32>());
+                    out_descs.push_back(desc);
                 }
             }
             //----------------------------------------------------------------------------
-            /// Load the resource from the given descs at the given index. On
-            /// completion this will recursively kick off the next load if one
-            /// is required, otherwise will call the delegate
+            /// Reads the material description from a cooked material. The reader
+            /// should be positioned after the header.
             ///
-            /// @author S Downie
+            /// @param The binary reader.
+            /// @param [Out] Material description to populate
+            //----------------------------------------------------------------------------
+            void ReadMaterialDesc(Core::BinaryReader& in_reader, MaterialDesc& out_desc)
+            {
+                out_desc.m_type = in_reader.ReadString();
+                
+                out_desc.m_hasDepthWrite = (in_reader.Read<u8>() != 0);
+                out_desc.m_isDepthWriteEnabled = (in_reader.Read<u8>() != 0);
+                out_desc.m_hasDepthTest = (in_reader.Read<u8>() != 0);
+                out_desc.m_isDepthTestEnabled = (in_reader.Read<u8>() != 0);
+                out_desc.m_hasTransparency = (in_reader.Read<u8>() != 0);
+                out_desc.m_isTransparencyEnabled = (in_reader.Read<u8>() != 0);
+                out_desc.m_hasFaceCulling = (in_reader.Read<u8>() != 0);
+                out_desc.m_isFaceCullingEnabled = (in_reader.Read<u8>() != 0);
+                
+                out_desc.m_hasBlendModes = (in_reader.Read<u8>() != 0);
+                out_desc.m_sourceBlendMode = BlendMode(in_reader.Read<u32>());
+                out_desc.m_destBlendMode = BlendMode(in_reader.Read<u32>());
+                
+                out_desc.m_hasCullFace = (in_reader.Read<u8>() != 0);
+                out_desc.m_cullFace = CullFace(in_reader.Read<u32>());
+                
+                out_desc.m_hasLighting = (in_reader.Read<u8>() != 0);
+                out_desc.m_hasEmissive = (in_reader.Read<u8>() != 0);
+                out_desc.m_hasAmbient = (in_reader.Read<u8>() != 0);
+                out_desc.m_hasDiffuse = (in_reader.Read<u8>() != 0);
+                out_desc.m_emissive = in_reader.Read<Core::Colour>();
+                out_desc.m_ambient = in_reader.Read<Core::Colour>();
+                out_desc.m_diffuse = in_reader.Read<Core::Colour>();
+                out_desc.m_specular = in_reader.Read<Core::Colour>();
+                
+                u32 numShaderOverrides = in_reader.Read<u32>();
+                for(u32 i = 0; i < numShaderOverrides && in_reader.IsBad() == false; ++i)
+                {
+                    MaterialProvider::ShaderDesc desc;
+                    desc.m_pass = ShaderPass(in_reader.Read<u32>());
+                    desc.m_location = Core::StorageLocation(in_reader.Read<u32>());
+                    desc.m_filePath = in_reader.ReadString();
+                    out_desc.m_shaderOverrides.push_back(desc);
+                }
+                
+                u32 numShaderVars = in_reader.Read<u32>();
+                for(u32 i = 0; i < numShaderVars && in_reader.IsBad() == false; ++i)
+                {
+                    ShaderVarDesc varDesc;
+                    varDesc.m_name = in_reader.ReadString();
+                    varDesc.m_type = ShaderVarType(in_reader.Read<u8>());
+                    switch(varDesc.m_type)
+                    {
+                        case ShaderVarType::k_float:
+                            varDesc.m_float = in_reader.Read<f32>();
+                            break;
+                        case ShaderVarType::k_vector2:
+                            varDesc.m_vector2 = in_reader.Read<Core::Vector2>();
+                            break;
+                        case ShaderVarType::k_vector3:
+                            varDesc.m_vector3 = in_reader.Read<Core::Vector3>();
+                            break;
+                        case ShaderVarType::k_vector4:
+                            varDesc.m_vector4 = in_reader.Read<Core::Vector4>();
+                            break;
+                        case ShaderVarType::k_colour:
+                            varDesc.m_colour = in_reader.Read<Core::Colour>();
+                            break;
+                        case ShaderVarType::k_matrix:
+                            varDesc.m_matrix = in_reader.Read<Core::Matrix4>();
+                            break;
+                    }
+                    out_desc.m_shaderVars.push_back(varDesc);
+                }
+                
+                ReadTextureDescs(in_reader, out_desc.m_textures);
+                ReadTextureDescs(in_reader, out_desc.m_cubemaps);
+            }
+            //----------------------------------------------------------------------------
+            /// @param The texture descriptions.
+            /// @param The binary writer.
+            //----------------------------------------------------------------------------
+            void WriteTextureDescs(const std::vector<MaterialProvider::TextureDesc>& in_descs, Core::BinaryWriter& in_writer)
+            {
+                in_writer.Write(u32(in_descs.size()));
+                for(const auto& desc : in_descs)
+                {
+                    in_writer.Write(u32(desc.m_location));
+                    in_writer.WriteString(desc.m_filePath);
+                    in_writer.Write(u8(desc.m_shouldMipMap ? 1 : 0));
+                    in_writer.Write(u32(desc.m_filterMode));
+                    in_writer.Write(u32(desc.m_wrapModeU));
+                    in_writer.Write(u32(desc.m_wrapModeV));
+                }
+            }
+            //----------------------------------------------------------------------------
+            /// Writes the material description in the cooked material format,
+            /// excluding the header.
+            ///
+            /// @param The material description.
+            /// @param The binary writer.
+            //----------------------------------------------------------------------------
+            void WriteMaterialDesc(const MaterialDesc& in_desc, Core::BinaryWriter& in_writer)
+            {
+                in_writer.WriteString(in_desc.m_type);
+                
+                in_writer.Write(u8(in_desc.m_hasDepthWrite ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_isDepthWriteEnabled ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_hasDepthTest ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_isDepthTestEnabled ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_hasTransparency ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_isTransparencyEnabled ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_hasFaceCulling ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_isFaceCullingEnabled ? 1 : 0));
+                
+                in_writer.Write(u8(in_desc.m_hasBlendModes ? 1 : 0));
+                in_writer.Write(u32(in_desc.m_sourceBlendMode));
+                in_writer.Write(u32(in_desc.m_destBlendMode));
+                
+                in_writer.Write(u8(in_desc.m_hasCullFace ? 1 : 0));
+                in_writer.Write(u32(in_desc.m_cullFace));
+                
+                in_writer.Write(u8(in_desc.m_hasLighting ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_hasEmissive ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_hasAmbient ? 1 : 0));
+                in_writer.Write(u8(in_desc.m_hasDiffuse ? 1 : 0));
+                in_writer.Write(in_desc.m_emissive);
+                in_writer.Write(in_desc.m_ambient);
+                in_writer.Write(in_desc.m_diffuse);
+                in_writer.Write(in_desc.m_specular);
+                
+                in_writer.Write(u32(in_desc.m_shaderOverrides.size()));
+                for(const auto& desc : in_desc.m_shaderOverrides)
+                {
+                    in_writer.Write(u32(desc.m_pass));
+                    in_writer.Write(u32(desc.m_location));
+                    in_writer.WriteString(desc.m_filePath);
+                }
+                
+                in_writer.Write(u32(in_desc.m_shaderVars.size()));
+                for(const auto& varDesc : in_desc.m_shaderVars)
+                {
+                    in_writer.WriteString(varDesc.m_name);
+                    in_writer.Write(u8(varDesc.m_type));
+                    switch(varDesc.m_type)
+                    {
+                        case ShaderVarType::k_float:
+                            in_writer.Write(varDesc.m_float);
+                            break;
+                        case ShaderVarType::k_vector2:
+                            in_writer.Write(varDesc.m_vector2);
+                            break;
+                        case ShaderVarType::k_vector3:
+                            in_writer.Write(varDesc.m_vector3);
+                            break;
+                        case ShaderVarType::k_vector4:
+                            in_writer.Write(varDesc.m_vector4);
+                            break;
+                        case ShaderVarType::k_colour:
+                            in_writer.Write(varDesc.m_colour);
+                            break;
+                        case ShaderVarType::k_matrix:
+                            in_writer.Write(varDesc.m_matrix);
+                            break;
+                    }
+                }
+                
+                WriteTextureDescs(in_desc.m_textures, in_writer);
+                WriteTextureDescs(in_desc.m_cubemaps, in_writer);
+            }
+            //----------------------------------------------------------------------------
+            /// Reads the material description from the given file. Cooked materials
+            /// are identified by their header rather than their extension, anything
+            /// else is parsed as XML.
+            ///
+            /// @param The storage location to load from
+            /// @param File path
+            /// @param [Out] Material description to populate
+            ///
+            /// @return Whether the description was read.
+            //----------------------------------------------------------------------------
+            bool ReadMaterialDesc(Core::StorageLocation in_location, const std::string& in_filePath, MaterialDesc& out_desc)
+            {
+                Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, Core::FileMode::k_readBinary);
+                if(stream == nullptr || stream->IsOpen() == false || stream->IsBad() == true)
+                {
+                    CS_LOG_ERROR("Cannot open material file: " + in_filePath);
+                    return false;
+                }
+                
+                Core::BinaryReader reader(stream);
+                if(reader.GetRemaining() >= sizeof(u32) * 2 && reader.Read<u32>() == k_cookedMaterialMagic)
+                {
+                    if(reader.Read<u32>() != k_cookedMaterialVersion)
+                    {
+                        CS_LOG_ERROR("Unsupported cooked material version in: " + in_filePath);
+                        return false;
+                    }
+                    
+                    ReadMaterialDesc(reader, out_desc);
+                    if(reader.IsBad() == true)
+                    {
+                        CS_LOG_ERROR("Cooked material is corrupt: " + in_filePath);
+                        return false;
+                    }
+                    return true;
+                }
+                
+                Core::XMLUPtr xml = Core::XMLUtils::ReadDocument(in_location, in_filePath);
+                if(xml == nullptr)
+                {
+                    return false;
+                }
+                
+                Core::XML::Node* rootElement = Core::XMLUtils::GetFirstChildElement(xml->GetDocument());
+                if(rootElement == nullptr || Core::XMLUtils::GetName(rootElement) != "Material")
+                {
+                    return false;
+                }
+                
+                ReadMaterialDesc(rootElement, out_desc);
+                return true;
+            }
+            //----------------------------------------------------------------------------
+            /// Applies the material description to the material and builds the list
+            /// of resources the material depends on.
+            ///
+            /// @param Material description
+            /// @param Render capabilities
+            /// @param [Out] Shaders to load
+            /// @param [Out] Textures to load
+            /// @param [Out] Cubemaps to load
+            /// @param [Out] Material to populate
+            //----------------------------------------------------------------------------
+            void ApplyMaterialDesc(const MaterialDesc& in_desc, RenderCapabilities* in_renderCapabilities, std::vector<MaterialProvider::ShaderDesc>& out_shaderFiles,
+                                   std::vector<MaterialProvider::TextureDesc>& out_textureFiles, std::vector<MaterialProvider::TextureDesc>& out_cubemapFiles, Material* out_material)
+            {
+                GetShaderFilesForMaterialType(in_desc.m_type, in_renderCapabilities, out_shaderFiles);
+                
+                //Overwrite any of the default files for this material type with specified custom ones
+                for(const auto& shaderOverride : in_desc.m_shaderOverrides)
+                {
+                    for(auto& shaderFile : out_shaderFiles)
+                    {
+                        if(shaderFile.m_pass == shaderOverride.m_pass)
+                        {
+                            shaderFile.m_location = shaderOverride.m_location;
+                            shaderFile.m_filePath = shaderOverride.m_filePath;
+                            break;
+                        }
+                    }
+                }
+                
+                if(in_desc.m_hasDepthWrite == true)
+                {
+                    out_material->SetDepthWriteEnabled(in_desc.m_isDepthWriteEnabled);
+                }
+                if(in_desc.m_hasDepthTest == true)
+                {
+                    out_material->SetDepthTestEnabled(in_desc.m_isDepthTestEnabled);
+                }
+                if(in_desc.m_hasTransparency == true)
+                {
+                    out_material->SetTransparencyEnabled(in_desc.m_isTransparencyEnabled);
+                }
+                if(in_desc.m_hasFaceCulling == true)
+                {
+                    out_material->SetFaceCullingEnabled(in_desc.m_isFaceCullingEnabled);
+                }
+                if(in_desc.m_hasBlendModes == true)
+                {
+                    out_material->SetBlendModes(in_desc.m_sourceBlendMode, in_desc.m_destBlendMode);
+                }
+                if(in_desc.m_hasCullFace == true)
+                {
+                    out_material->SetCullFace(in_desc.m_cullFace);
+                }
+                if(in_desc.m_hasLighting == true)
+                {
+                    if(in_desc.m_hasEmissive == true)
+                    {
+                        out_material->SetEmissive(in_desc.m_emissive);
+                    }
+                    if(in_desc.m_hasAmbient == true)
+                    {
+                        out_material->SetAmbient(in_desc.m_ambient);
+                    }
+                    if(in_desc.m_hasDiffuse == true)
+                    {
+                        out_material->SetDiffuse(in_desc.m_diffuse);
+                    }
+                    out_material->SetSpecular(in_desc.m_specular);
+                }
+                
+                for(const auto& varDesc : in_desc.m_shaderVars)
+                {
+                    switch(varDesc.m_type)
+                    {
+                        case ShaderVarType::k_float:
+                            out_material->SetShaderVar(varDesc.m_name, varDesc.m_float);
+                            break;
+                        case ShaderVarType::k_vector2:
+                            out_material->SetShaderVar(varDesc.m_name, varDesc.m_vector2);
+                            break;
+                        case ShaderVarType::k_vector3:
+                            out_material->SetShaderVar(varDesc.m_name, varDesc.m_vector3);
+                            break;
+                        case ShaderVarType::k_vector4:
+                            out_material->SetShaderVar(varDesc.m_name, varDesc.m_vector4);
+                            break;
+                        case ShaderVarType::k_colour:
+                            out_material->SetShaderVar(varDesc.m_name, varDesc.m_colour);
+                            break;
+                        case ShaderVarType::k_matrix:
+                            out_material->SetShaderVar(varDesc.m_name, varDesc.m_matrix);
+                            break;
+                    }
+                }
+                
+                out_textureFiles = in_desc.m_textures;
+                out_cubemapFiles = in_desc.m_cubemaps;
+            }
+            //----------------------------------------------------------------------------
+            /// The shared state of a set of parallel resource loads.
+            //----------------------------------------------------------------------------
+            struct ParallelLoadState
+            {
+                std::vector<ResourceLoadDesc> m_descs;
+                std::vector<ShaderCSPtr> m_shaders;
+                std::vector<TextureCSPtr> m_textures;
+                std::vector<CubemapCSPtr> m_cubemaps;
+                std::atomic<u32> m_numRemaining;
+                std::atomic<bool> m_hasFailed;
+            };
+            //----------------------------------------------------------------------------
+            /// Called as each resource load completes. Once all loads have completed
+            /// the resources are added to the material in the order they were described
+            /// and the completion delegate is called on the main thread.
+            ///
+            /// Resource pool delegates can be called on the thread that requested the
+            /// load as well as the main thread, so the counter is atomic.
+            ///
+            /// @param The shared load state
+            /// @param Completion delegate
+            /// @param [Out] Material
+            //----------------------------------------------------------------------------
+            void OnResourceLoaded(const std::shared_ptr<ParallelLoadState>& in_state, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const MaterialSPtr& out_material)
+            {
+                if(--in_state->m_numRemaining > 0)
+                {
+                    return;
+                }
+                
+                if(in_state->m_hasFailed == true)
+                {
+                    out_material->SetLoadState(Core::Resource::LoadState::k_failed);
+                    Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
+                    return;
+                }
+                
+                for(u32 i = 0; i < in_state->m_descs.size(); ++i)
+                {
+                    switch(in_state->m_descs[i].m_type)
+                    {
+                        case ResourceType::k_shader:
+                            out_material->SetShader(in_state->m_descs[i].m_pass, in_state->m_shaders[i]);
+                            break;
+                        case ResourceType::k_texture:
+                            out_material->AddTexture(in_state->m_textures[i]);
+                            break;
+                        case ResourceType::k_cubemap:
+                            out_material->SetCubemap(in_state->m_cubemaps[i]);
+                            break;
+                    }
+                }
+                
+                out_material->SetLoadState(Core::Resource::LoadState::k_loaded);
+                Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
+            }
+            //----------------------------------------------------------------------------
+            /// Starts loading all of the resources from the given descs at once rather
+            /// than waiting for each to finish before starting the next. The delegate
+            /// is called once all of them have completed.
             ///
-            /// @param Index of desc to load
             /// @param Descs
             /// @param Completion delegate
             /// @param [Out] Material
             //----------------------------------------------------------------------------
-            void LoadResourcesChained(u32 in_loadIndex, const std::vector<ChainedLoadDesc>& in_descs, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const MaterialSPtr& out_material)
+            void LoadResourcesParallel(std::vector<ResourceLoadDesc>&& in_descs, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const MaterialSPtr& out_material)
             {
+                if(in_descs.empty() == true)
+                {
+                    out_material->SetLoadState(Core::Resource::LoadState::k_loaded);
+                    Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
+                    return;
+                }
+                
+                auto state = std::make_shared<ParallelLoadState>();
+                state->m_descs = std::move(in_descs);
+                state->m_shaders.resize(state->m_descs.size());
+                state->m_textures.resize(state->m_descs.size());
+                state->m_cubemaps.resize(state->m_descs.size());
+                state->m_numRemaining = state->m_descs.size();
+                state->m_hasFailed = false;
+                
                 Core::ResourcePool* resourcePool = Core::Application::Get()->GetResourcePool();
                 
-                switch(in_descs[in_loadIndex].m_type)
+                for(u32 i = 0; i < state->m_descs.size(); ++i)
                 {
-                    case ResourceType::k_shader:
+                    const ResourceLoadDesc& desc = state->m_descs[i];
+                    switch(desc.m_type)
                     {
-                        resourcePool->LoadResourceAsync<Shader>(in_descs[in_loadIndex].m_location, in_descs[in_loadIndex].m_filePath, [in_loadIndex, in_descs, in_delegate, out_material](const ShaderCSPtr& in_shader)
+                        case ResourceType::k_shader:
                         {
-                            if(in_shader->GetLoadState() == Core::Resource::LoadState::k_loaded)
+                            resourcePool->LoadResourceAsync<Shader>(desc.m_location, desc.m_filePath, [i, state, in_delegate, out_material](const ShaderCSPtr& in_shader)
                             {
-                                out_material->SetShader(in_descs[in_loadIndex].m_pass, in_shader);
-                                
-                                u32 newLoadIndex = in_loadIndex + 1;
-                                
-                                if(newLoadIndex < in_descs.size())
+                                if(in_shader != nullptr && in_shader->GetLoadState() == Core::Resource::LoadState::k_loaded)
                                 {
-                                    LoadResourcesChained(newLoadIndex, in_descs, in_delegate, out_material);
+                                    state->m_shaders[i] = in_shader;
                                 }
                                 else
                                 {
-                                    out_material->SetLoadState(Core::Resource::LoadState::k_loaded);
-									Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                    return;
+                                    state->m_hasFailed = true;
                                 }
-                            }
-                            else
-                            {
-                                out_material->SetLoadState(Core::Resource::LoadState::k_failed);
-								Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                return;
-                            }
-                        });
-                        break;
-                    }
-                    case ResourceType::k_texture:
-                    {
-                        auto options(std::make_shared<TextureResourceOptions>(in_descs[in_loadIndex].m_shouldMipMap, in_descs[in_loadIndex].m_filterMode, in_descs[in_loadIndex].m_wrapModeU, in_descs[in_loadIndex].m_wrapModeV, true));
-                        resourcePool->LoadResourceAsync<Texture>(in_descs[in_loadIndex].m_location, in_descs[in_loadIndex].m_filePath, options, [in_loadIndex, in_descs, in_delegate, out_material](const TextureCSPtr& in_texture)
+                                OnResourceLoaded(state, in_delegate, out_material);
+                            });
+                            break;
+                        }
+                        case ResourceType::k_texture:
                         {
-                            if(in_texture->GetLoadState() == Core::Resource::LoadState::k_loaded)
+                            auto options(std::make_shared<TextureResourceOptions>(desc.m_shouldMipMap, desc.m_filterMode, desc.m_wrapModeU, desc.m_wrapModeV, true));
+                            resourcePool->LoadResourceAsync<Texture>(desc.m_location, desc.m_filePath, options, [i, state, in_delegate, out_material](const TextureCSPtr& in_texture)
                             {
-                                out_material->AddTexture(in_texture);
-                                
-                                u32 newLoadIndex = in_loadIndex + 1;
-                                
-                                if(newLoadIndex < in_descs.size())
+                                if(in_texture != nullptr && in_texture->GetLoadState() == Core::Resource::LoadState::k_loaded)
                                 {
-                                    LoadResourcesChained(newLoadIndex, in_descs, in_delegate, out_material);
+                                    state->m_textures[i] = in_texture;
                                 }
                                 else
                                 {
-                                    out_material->SetLoadState(Core::Resource::LoadState::k_loaded);
-									Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                    return;
+                                    state->m_hasFailed = true;
                                 }
-                            }
-                            else
-                            {
-                                out_material->SetLoadState(Core::Resource::LoadState::k_failed);
-								Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                return;
-                            }
-                        });
-                        break;
-                    }
-                    case ResourceType::k_cubemap:
-                    {
-                        auto options(std::make_shared<CubemapResourceOptions>(in_descs[in_loadIndex].m_shouldMipMap, in_descs[in_loadIndex].m_filterMode, in_descs[in_loadIndex].m_wrapModeU, in_descs[in_loadIndex].m_wrapModeV, true));
-                        resourcePool->LoadResourceAsync<Cubemap>(in_descs[in_loadIndex].m_location, in_descs[in_loadIndex].m_filePath, options, [in_loadIndex, in_descs, in_delegate, out_material](const CubemapCSPtr& in_cubemap)
+                                OnResourceLoaded(state, in_delegate, out_material);
+                            });
+                            break;
+                        }
+                        case ResourceType::k_cubemap:
                         {
-                            if(in_cubemap->GetLoadState() == Core::Resource::LoadState::k_loaded)
+                            auto options(std::make_shared<CubemapResourceOptions>(desc.m_shouldMipMap, desc.m_filterMode, desc.m_wrapModeU, desc.m_wrapModeV, true));
+                            resourcePool->LoadResourceAsync<Cubemap>(desc.m_location, desc.m_filePath, options, [i, state, in_delegate, out_material](const CubemapCSPtr& in_cubemap)
                             {
-                                out_material->SetCubemap(in_cubemap);
-
-                                u32 newLoadIndex = in_loadIndex + 1;
-
-                                if(newLoadIndex < in_descs.size())
+                                if(in_cubemap != nullptr && in_cubemap->GetLoadState() == Core::Resource::LoadState::k_loaded)
                                 {
-                                    LoadResourcesChained(newLoadIndex, in_descs, in_delegate, out_material);
+                                    state->m_cubemaps[i] = in_cubemap;
                                 }
                                 else
                                 {
-                                    out_material->SetLoadState(Core::Resource::LoadState::k_loaded);
-									Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                    return;
+                                    state->m_hasFailed = true;
                                 }
-                            }
-                            else
-                            {
-                                out_material->SetLoadState(Core::Resource::LoadState::k_failed);
-								Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                return;
-                            }
-                        });
-                        break;
+                                OnResourceLoaded(state, in_delegate, out_material);
+                            });
+                            break;
+                        }
                     }
                 }
             }
@@ -708,6 +1199,33 @@ namespace ChilliSource
 		{
 			return in_extension == k_materialExtension;
 		}
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool MaterialProvider::CookMaterial(Core::StorageLocation in_sourceLocation, const std::string& in_sourcePath, Core::StorageLocation in_destLocation, const std::string& in_destPath)
+        {
+            MaterialDesc desc;
+            if(ReadMaterialDesc(in_sourceLocation, in_sourcePath, desc) == false)
+            {
+                CS_LOG_ERROR("Cannot cook material as it could not be read: " + in_sourcePath);
+                return false;
+            }
+            
+            Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_destLocation, in_destPath, Core::FileMode::k_writeBinary);
+            Core::BinaryWriter writer(stream);
+            if(writer.IsBad() == true)
+            {
+                CS_LOG_ERROR("Cannot open cooked material for writing: " + in_destPath);
+                return false;
+            }
+            
+            writer.Write(k_cookedMaterialMagic);
+            writer.Write(k_cookedMaterialVersion);
+            WriteMaterialDesc(desc, writer);
+            
+            bool success = (writer.IsBad() == false);
+            stream->Close();
+            return success;
+        }
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
 		void MaterialProvider::CreateResourceFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceSPtr& out_resource)
@@ -798,12 +1316,17 @@ namespace ChilliSource
             
             MaterialSPtr material = std::static_pointer_cast<Material>(out_resource);
             
-            std::vector<ChainedLoadDesc> resourceFiles;
+            std::vector<ResourceLoadDesc> resourceFiles;
             resourceFiles.reserve(shaderFiles.size() + textureFiles.size() + cubemapFiles.size());
             
             for(const auto& shaderDesc : shaderFiles)
             {
-                ChainedLoadDesc desc;
+                if(shaderDesc.m_filePath.empty() == true)
+                {
+                    continue;
+                }
+                
+                ResourceLoadDesc desc;
                 desc.m_filePath = shaderDesc.m_filePath;
                 desc.m_location = shaderDesc.m_location;
                 desc.m_pass = shaderDesc.m_pass;
@@ -813,7 +1336,12 @@ namespace ChilliSource
             
             for(const auto& textureDesc : textureFiles)
             {
-                ChainedLoadDesc desc;
+                if(textureDesc.m_filePath.empty() == true)
+                {
+                    continue;
+                }
+                
+                ResourceLoadDesc desc;
                 desc.m_filePath = textureDesc.m_filePath;
                 desc.m_location = textureDesc.m_location;
                 desc.m_shouldMipMap = textureDesc.m_shouldMipMap;
@@ -826,7 +1354,12 @@ namespace ChilliSource
             
             for(const auto& cubemapDesc : cubemapFiles)
             {
-                ChainedLoadDesc desc;
+                if(cubemapDesc.m_filePath.empty() == true)
+                {
+                    continue;
+                }
+                
+                ResourceLoadDesc desc;
                 desc.m_filePath = cubemapDesc.m_filePath;
                 desc.m_location = cubemapDesc.m_location;
                 desc.m_shouldMipMap = cubemapDesc.m_shouldMipMap;
@@ -837,7 +1370,7 @@ namespace ChilliSource
                 resourceFiles.push_back(desc);
             }
             
-            LoadResourcesChained(0, resourceFiles, in_delegate, material);
+            LoadResourcesParallel(std::move(resourceFiles), in_delegate, material);
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
@@ -847,26 +1380,13 @@ namespace ChilliSource
                                                     std::vector<TextureDesc>& out_cubemapFiles,
                                                     Material* out_material)
 		{
-			//Load the XML file
-            Core::XMLUPtr xml = Core::XMLUtils::ReadDocument(in_location, in_filePath);
-            Core::XML::Node* rootElement = Core::XMLUtils::GetFirstChildElement(xml->GetDocument());
-            
-            if(rootElement == nullptr || Core::XMLUtils::GetName(rootElement) != "Material")
+            MaterialDesc desc;
+            if(ReadMaterialDesc(in_location, in_filePath, desc) == false)
             {
                 return false;
             }
-			
-            std::string materialType = Core::XMLUtils::GetAttributeValue<std::string>(rootElement, "type", "Static");
-            GetShaderFilesForMaterialType(materialType, m_renderCapabilities, out_shaderFiles);
-
-            ParseRenderStates(rootElement, out_material);
-            ParseAlphaBlendFunction(rootElement, out_material);
-            ParseCullFunction(rootElement, out_material);
-            ParseSurface(rootElement, out_material);
-            ParseShaders(rootElement, out_shaderFiles, out_material);
-            ParseTextures(rootElement, out_textureFiles);
-            ParseCubemaps(rootElement, out_cubemapFiles);
             
+            ApplyMaterialDesc(desc, m_renderCapabilities, out_shaderFiles, out_textureFiles, out_cubemapFiles, out_material);
             return true;
 		}
 	}
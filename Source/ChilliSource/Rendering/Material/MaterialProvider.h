@@ -107,6 +107,19 @@ namespace ChilliSource
 			/// @return Whether the object can create a resource with the given extension
 			//----------------------------------------------------------------------------
 			bool CanCreateResourceWithFileExtension(const std::string& in_extension) const override;
+            //----------------------------------------------------------------------------
+            /// Converts a material file to the cooked binary material format. Cooked
+            /// materials use the same extension and are identified by their header, so
+            /// they can be loaded in place of the XML without any XML or string parsing.
+            ///
+            /// @param The storage location of the material file.
+            /// @param The file path of the material file.
+            /// @param The storage location to write the cooked material.
+            /// @param The file path to write the cooked material.
+            ///
+            /// @return Whether or not the material was cooked.
+            //----------------------------------------------------------------------------
+            static bool CookMaterial(Core::StorageLocation in_sourceLocation, const std::string& in_sourcePath, Core::StorageLocation in_destLocation, const std::string& in_destPath);
 			
 		private:
             
@@ -50,6 +50,7 @@ namespace ChilliSource
 	namespace Rendering
 	{
 		CS_DEFINE_NAMEDTYPE(AnimatedMeshComponent);
+		CS_DEFINE_POOLEDTYPE(AnimatedMeshComponent);
         
 		//----------------------------------------------------------
 		/// Constructor
@@ -275,6 +276,7 @@ namespace ChilliSource
             // Update OOBB
             mOBBoundingBox.SetSize(mpModel->GetAABB().GetSize());
             mOBBoundingBox.SetOrigin(mpModel->GetAABB().GetOrigin());
+            OnVolumeChanged();
             
             Reset();
 		}
@@ -293,6 +295,7 @@ namespace ChilliSource
             // Update OOBB
             mOBBoundingBox.SetSize(mpModel->GetAABB().GetSize());
             mOBBoundingBox.SetOrigin(mpModel->GetAABB().GetOrigin());
+            OnVolumeChanged();
             Reset();
             
             SetMaterial(inpMaterial);
@@ -30,9 +30,11 @@
 #define _CHILLISOURCE_RENDERING_ANIMATED_MESH_COMPONENT_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/ObjectPool.h>
 #include <ChilliSource/Rendering/Base/RenderComponent.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimationGroup.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/File/FileSystem.h>
 
@@ -55,11 +57,11 @@ namespace ChilliSource
         //===============================================================
 		/// Events
 		//===============================================================
-        typedef std::function<void(AnimatedMeshComponent*)> AnimationChangedDelegate;
+        typedef Core::InlineDelegate<void(AnimatedMeshComponent*)> AnimationChangedDelegate;
         typedef Core::Event<AnimationChangedDelegate> AnimationChangedEvent;
-        typedef std::function<void(AnimatedMeshComponent*)> AnimationCompletionDelegate;
+        typedef Core::InlineDelegate<void(AnimatedMeshComponent*)> AnimationCompletionDelegate;
         typedef Core::Event<AnimationCompletionDelegate> AnimationCompletionEvent;
-        typedef std::function<void(AnimatedMeshComponent*)> AnimationLoopedDelegate;
+        typedef Core::InlineDelegate<void(AnimatedMeshComponent*)> AnimationLoopedDelegate;
         typedef Core::Event<AnimationLoopedDelegate> AnimationLoopedEvent;
 		//===============================================================
 		/// Animated Mesh component
@@ -71,6 +73,7 @@ namespace ChilliSource
 		{
 		public:
 			CS_DECLARE_NAMEDTYPE(AnimatedMeshComponent);
+			CS_DECLARE_POOLEDTYPE(AnimatedMeshComponent);
 			
 			AnimatedMeshComponent();
 			~AnimatedMeshComponent();
@@ -29,10 +29,14 @@
 #include <ChilliSource/Rendering/Model/CSAnimProvider.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/BinaryReader.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimationResourceOptions.h>
+
+#include <cstring>
 
 namespace ChilliSource
 {
@@ -46,96 +50,96 @@ namespace ChilliSource
             const u32 k_maxVersion = 4;
             const u32 k_fileCheckValue = 7777;
             
+            const u32 k_valuesPerNode = 10;
+            
             //----------------------------------------------------------------------------
-            /// Read value of the given type and size from the binary file stream
-            ///
-			/// @author Ian Copland
-			///
-			/// @param File stream
-			/// @return Value of type TType
-			//----------------------------------------------------------------------------
-			template <typename TType> TType ReadValue(const Core::FileStreamSPtr& in_fileStream)
-			{
-				TType value;
-				in_fileStream->Read(reinterpret_cast<s8*>(&value), sizeof(TType));
-				return value;
-			}
-            //----------------------------------------------------------------------------
-            /// Reads all of the data for the animation into the SkinnedAnimation resource
+            /// Reads all of the data for the animation into the SkinnedAnimation resource.
+            /// The key frame data is a single contiguous block of translation, orientation
+            /// and scale values for each node in each frame, so it is taken as one view
+            /// and copied straight into the frames rather than read value by value.
             ///
             /// @author Ian Copland
             ///
-            /// @param The file stream.
+            /// @param The animation data reader.
             /// @param The number of frames.
             /// @param The number of skeleton nodes.
             /// @param [Out] Animation resource to populate
+            ///
+            /// @return Whether or not the file contained all of the frame data.
             //----------------------------------------------------------------------------
-            void ReadAnimationData(const Core::FileStreamSPtr& in_fileStream, u32 in_numFrames, s32 in_numSkeletonNodes, const SkinnedAnimationSPtr& out_resource)
+            bool ReadAnimationData(Core::BinaryReader& in_reader, u32 in_numFrames, s32 in_numSkeletonNodes, const SkinnedAnimationSPtr& out_resource)
             {
+                if (in_numSkeletonNodes < 0)
+                {
+                    return false;
+                }
+                
+                const u32 numNodes = (u32)in_numSkeletonNodes;
+                const u64 dataSize = u64(numNodes) * k_valuesPerNode * sizeof(f32) * in_numFrames;
+                if (dataSize > in_reader.GetRemaining())
+                {
+                    return false;
+                }
+                
+                const s8* frameData = in_reader.ReadView(u32(dataSize));
+                
                 for (u32 frameCount=0; frameCount<in_numFrames; ++frameCount)
                 {
                     //create new frame
                     SkinnedAnimation::FrameUPtr frame(new SkinnedAnimation::Frame());
+                    frame->m_nodeTranslations.resize(numNodes);
+                    frame->m_nodeOrientations.resize(numNodes);
+                    frame->m_nodeScales.resize(numNodes);
                     
-                    //add all skeleton nodes matrices
-                    for (u32 skelNodeCount=0; skelNodeCount<(u32)in_numSkeletonNodes; ++skelNodeCount)
+                    //add all skeleton nodes transforms
+                    for (u32 skelNodeCount=0; skelNodeCount<numNodes; ++skelNodeCount)
                     {
-                        //create new translation
-                        Core::Vector3 translation;
-                        translation.x = ReadValue<f32>(in_fileStream);
-                        translation.y = ReadValue<f32>(in_fileStream);
-                        translation.z = ReadValue<f32>(in_fileStream);
+                        //the file data has no alignment guarantees, so copy out before use.
+                        f32 values[k_valuesPerNode];
+                        memcpy(values, frameData, sizeof(values));
+                        frameData += sizeof(values);
                         
-                        //create new orientation
-                        Core::Quaternion orientation;
-                        orientation.x = ReadValue<f32>(in_fileStream);
-                        orientation.y = ReadValue<f32>(in_fileStream);
-                        orientation.z = ReadValue<f32>(in_fileStream);
-                        orientation.w = ReadValue<f32>(in_fileStream);
-                        
-                        //create new scale
-                        Core::Vector3 scale;
-                        scale.x = ReadValue<f32>(in_fileStream);
-                        scale.y = ReadValue<f32>(in_fileStream);
-                        scale.z = ReadValue<f32>(in_fileStream);
-                        
-                        //add to the frame
-                        frame->m_nodeTranslations.push_back(translation);
-                        frame->m_nodeOrientations.push_back(orientation);
-                        frame->m_nodeScales.push_back(scale);
+                        frame->m_nodeTranslations[skelNodeCount] = Core::Vector3(values[0], values[1], values[2]);
+                        frame->m_nodeOrientations[skelNodeCount] = Core::Quaternion(values[3], values[4], values[5], values[6]);
+                        frame->m_nodeScales[skelNodeCount] = Core::Vector3(values[7], values[8], values[9]);
                     }
                     
                     //add frame to animation
                     out_resource->AddFrame(std::move(frame));
                 }
+                
+                return true;
             }
             //----------------------------------------------------------------------------
 			/// Parses the header of the anim file.
             ///
             /// @author Ian Copland
 			///
-			/// @param The file stream.
+			/// @param The animation data reader.
+			/// @param The file path.
 			/// @param the Skeletal Animation that this data is being loaded into.
+			/// @param [Out] The number of frames.
+			/// @param [Out] The number of skeleton nodes.
             ///
 			/// @return whether or not this was successful
 			//----------------------------------------------------------------------------
-			bool ReadHeader(const Core::FileStreamSPtr& in_stream, const std::string & in_filePath, const SkinnedAnimationSPtr& out_resource, u32& out_numFrames, s32& out_numSkeletonNodes)
+			bool ReadHeader(Core::BinaryReader& in_reader, const std::string & in_filePath, const SkinnedAnimationSPtr& out_resource, u32& out_numFrames, s32& out_numSkeletonNodes)
             {
                 //Check file for corruption
-                if(in_stream == nullptr || in_stream->IsBad() == true)
+                if(in_reader.IsBad() == true)
                 {
                     CS_LOG_ERROR("Cannot open CSAnim file: " + in_filePath);
                     return false;
                 }
                 
-                u32 fileCheckValue = ReadValue<u32>(in_stream);
+                u32 fileCheckValue = in_reader.Read<u32>();
                 if(fileCheckValue != k_fileCheckValue)
                 {
                     CS_LOG_ERROR("CSAnim file has corruption(incorrect File Check Value): " + in_filePath);
                     return false;
                 }
                 
-                u32 versionNum = ReadValue<u32>(in_stream);
+                u32 versionNum = in_reader.Read<u32>();
                 if (versionNum < k_minVersion || versionNum > k_maxVersion)
                 {
                     CS_LOG_ERROR("Unsupported CSAnim version: " + in_filePath);
@@ -143,18 +147,25 @@ namespace ChilliSource
                 }
                 
                 //build the feature declaration from the file
-                u32 numFeatures = (u32)ReadValue<u8>(in_stream);
+                u32 numFeatures = (u32)in_reader.Read<u8>();
                 if (numFeatures != 0)
                 {
                     CS_LOG_ERROR("Unknown feature type in CSAnim (" + in_filePath + ") feature declaration!");
                 }
                 
                 //read num frames and skeleton nodes
-                out_numFrames = (u32)ReadValue<u16>(in_stream);
-                out_numSkeletonNodes = (s32)ReadValue<s16>(in_stream);
+                out_numFrames = (u32)in_reader.Read<u16>();
+                out_numSkeletonNodes = (s32)in_reader.Read<s16>();
                 
                 //read frame time
-                f32 frameTime = ReadValue<f32>(in_stream);
+                f32 frameTime = in_reader.Read<f32>();
+                
+                if (in_reader.IsBad() == true)
+                {
+                    CS_LOG_ERROR("CSAnim file is truncated: " + in_filePath);
+                    return false;
+                }
+                
                 out_resource->SetFrameTime(frameTime);
                 return true;
             }
@@ -162,6 +173,8 @@ namespace ChilliSource
         
         CS_DEFINE_NAMEDTYPE(CSAnimProvider);
         
+        const Core::IResourceOptionsBaseCSPtr CSAnimProvider::s_defaultOptions(std::make_shared<SkinnedAnimationResourceOptions>());
+        
         //-------------------------------------------------------------------------
 		//-------------------------------------------------------------------------
         CSAnimProviderUPtr CSAnimProvider::Create()
@@ -179,6 +192,12 @@ namespace ChilliSource
         Core::InterfaceIDType CSAnimProvider::GetResourceType() const
         {
             return SkinnedAnimation::InterfaceID;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        Core::IResourceOptionsBaseCSPtr CSAnimProvider::GetDefaultOptions() const
+        {
+            return s_defaultOptions;
         }
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
@@ -192,25 +211,28 @@ namespace ChilliSource
 		{
 			SkinnedAnimationSPtr anim = std::static_pointer_cast<SkinnedAnimation>(out_resource);
             
-            ReadSkinnedAnimationFromFile(in_location, in_filePath, nullptr, anim);
+            ReadSkinnedAnimationFromFile(in_location, in_filePath, in_options, nullptr, anim);
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
 		void CSAnimProvider::CreateResourceFromFileAsync(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
 		{
 			SkinnedAnimationSPtr anim = std::static_pointer_cast<SkinnedAnimation>(out_resource);
-			auto task = std::bind(&CSAnimProvider::ReadSkinnedAnimationFromFile, this, in_location, in_filePath, in_delegate, anim);
+			auto task = std::bind(&CSAnimProvider::ReadSkinnedAnimationFromFile, this, in_location, in_filePath, in_options, in_delegate, anim);
 			Core::Application::Get()->GetTaskScheduler()->ScheduleTask(task);
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
-		void CSAnimProvider::ReadSkinnedAnimationFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const
+		void CSAnimProvider::ReadSkinnedAnimationFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const
 		{
 			Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, Core::FileMode::k_readBinary);
 			
+			//parse from memory rather than through the stream. This is a zero copy view of the file where the stream supports it.
+			Core::BinaryReader reader(stream);
+			
 			u32 numFrames = 0;
 			s32 numSkeletonNodes = 0;
-			if(ReadHeader(stream, in_filePath, out_resource, numFrames, numSkeletonNodes) == false)
+			if(ReadHeader(reader, in_filePath, out_resource, numFrames, numSkeletonNodes) == false)
             {
                 CS_LOG_ERROR("Failed to read header in anim: " + in_filePath);
                 out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
@@ -221,7 +243,22 @@ namespace ChilliSource
                 return;
             }
             
-			ReadAnimationData(stream, numFrames, numSkeletonNodes, out_resource);
+			if(ReadAnimationData(reader, numFrames, numSkeletonNodes, out_resource) == false)
+            {
+                CS_LOG_ERROR("CSAnim file is truncated: " + in_filePath);
+                out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
+                if(in_delegate != nullptr)
+                {
+					Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+                }
+                return;
+            }
+            
+            const SkinnedAnimationResourceOptions* options = (const SkinnedAnimationResourceOptions*)in_options.get();
+            if (options != nullptr && options->IsCompressionEnabled() == true)
+            {
+                out_resource->Compress(options->GetTranslationTolerance(), options->GetOrientationTolerance(), options->GetScaleTolerance(), options->IsKeyFrameReductionEnabled());
+            }
 			
             out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
             
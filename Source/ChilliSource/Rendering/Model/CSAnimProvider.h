@@ -75,6 +75,11 @@ namespace ChilliSource
 			/// @return Whether the object can create a resource with the given extension
 			//----------------------------------------------------------------------------
 			bool CanCreateResourceWithFileExtension(const std::string& in_extension) const override;
+            //----------------------------------------------------
+            /// @return Default options for skinned animation
+            /// loading. Compression is disabled by default.
+            //----------------------------------------------------
+            Core::IResourceOptionsBaseCSPtr GetDefaultOptions() const override;
 
 		private:
 			//----------------------------------------------------------------------------
@@ -110,10 +115,13 @@ namespace ChilliSource
 			///
             /// @param The storage location to load from
 			/// @param File path
+            /// @param Options to customise the creation
             /// @param Completion delegate
 			/// @param [Out] the output resource pointer
 			//----------------------------------------------------------------------------
-			void ReadSkinnedAnimationFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const;
+			void ReadSkinnedAnimationFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const;
+            
+            static const Core::IResourceOptionsBaseCSPtr s_defaultOptions;
 		};
 	}
 }
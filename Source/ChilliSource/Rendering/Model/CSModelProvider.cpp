@@ -29,6 +29,7 @@
 #include <ChilliSource/Rendering/Model/CSModelProvider.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/BinaryReader.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
 #include <ChilliSource/Rendering/Model/MeshDescriptor.h>
@@ -86,52 +87,24 @@ namespace ChilliSource
                 s32 m_numSkeletonNodes;
                 u32 m_numJoints;
             };
-            //----------------------------------------------------------------------------
-			/// Read value in for given type
-            ///
-            /// @author Ian Copland
-            ///
-			/// @param File stream
-            ///
-			/// @return Value of type T
-			//----------------------------------------------------------------------------
-			template <typename TType> TType ReadValue(const Core::FileStreamSPtr& in_meshStream)
-			{
-				TType value;
-				in_meshStream->Read(reinterpret_cast<s8*>(&value), sizeof(TType));
-				return value;
-			}
-            //----------------------------------------------------------------------------
-			/// Read block of data in for given type
-            ///
-            /// @author Ian Copland
-            ///
-			/// @param File stream
-            /// @param Num to read
-			/// @param [Out] data
-			//----------------------------------------------------------------------------
-			template <typename TType> void ReadBlock(const Core::FileStreamSPtr& in_meshStream, u32 in_numToRead, TType* out_data)
-			{
-				in_meshStream->Read(reinterpret_cast<s8*>(out_data), sizeof(TType) * in_numToRead);
-			}
             //-----------------------------------------------------------------------------
-            /// Read the vertex declaration from the mesh filestream. The declaration
+            /// Read the vertex declaration from the mesh data. The declaration
             /// is variable
             ///
             /// @author Ian Copland
             ///
-            /// @param Mesh stream
+            /// @param Mesh data reader
             /// @param [Out] Mesh description
             //-----------------------------------------------------------------------------
-            void ReadVertexDeclaration(const Core::FileStreamSPtr& in_meshStream, MeshDescriptor& out_meshDesc)
+            void ReadVertexDeclaration(Core::BinaryReader& in_reader, MeshDescriptor& out_meshDesc)
             {
                 //build the vertex declaration from the file
-                u8 numVertexElements = ReadValue<u8>(in_meshStream);
+                u8 numVertexElements = in_reader.Read<u8>();
                 
                 VertexElement* vertexElements = new VertexElement[numVertexElements];
                 for (int i = 0; i < numVertexElements; ++i)
                 {
-                    u8 vertexAttrib = ReadValue<u8>(in_meshStream);
+                    u8 vertexAttrib = in_reader.Read<u8>();
                     
                     switch (VertexAttribute(vertexAttrib))
                     {
@@ -173,91 +146,87 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param Mesh data reader
 			/// @param Mesh description
             /// @param [Out] Submesh description
+            ///
+            /// @return Whether or not the file contained all of the sub-mesh data.
             //-----------------------------------------------------------------------------
-            void ReadSubMeshData(const Core::FileStreamSPtr& in_meshStream, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
+            bool ReadSubMeshData(Core::BinaryReader& in_reader, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
             {
                 //read the inverse bind matrices
                 if(true == in_meshDesc.mFeatures.mbHasAnimationData)
                 {
-                    for(u32 i=0; i<in_meshDesc.m_skeletonDesc.m_jointIndices.size(); ++i)
+                    const u32 numJoints = in_meshDesc.m_skeletonDesc.m_jointIndices.size();
+                    out_subMeshDesc.mInverseBindPoseMatrices.resize(numJoints);
+                    for(u32 i=0; i<numJoints; ++i)
                     {
-                        CSCore::Matrix4 IBPMat;
-                        ReadBlock<f32>(in_meshStream, 16, IBPMat.m);
-                        out_subMeshDesc.mInverseBindPoseMatrices.push_back(IBPMat);
+                        in_reader.Read<f32>(16, out_subMeshDesc.mInverseBindPoseMatrices[i].m);
                     }
                 }
                 
-                //read the vertex data
-                out_subMeshDesc.mpVertexData = new u8[in_meshDesc.mVertexDeclaration.GetTotalSize() * out_subMeshDesc.mudwNumVertices];
-                in_meshStream->Read((s8*)out_subMeshDesc.mpVertexData, in_meshDesc.mVertexDeclaration.GetTotalSize() * out_subMeshDesc.mudwNumVertices);
+                //read the vertex data. The sizes come from the file so are checked against what is left before allocating.
+                const u64 vertexDataSize = u64(in_meshDesc.mVertexDeclaration.GetTotalSize()) * u64(out_subMeshDesc.mudwNumVertices);
+                if (in_reader.IsBad() == true || vertexDataSize > in_reader.GetRemaining())
+                {
+                    return false;
+                }
+                out_subMeshDesc.mpVertexData = new u8[vertexDataSize];
+                in_reader.Read<u8>(u32(vertexDataSize), out_subMeshDesc.mpVertexData);
                 
                 //read the index data
-                out_subMeshDesc.mpIndexData = new u8[in_meshDesc.mudwIndexSize * out_subMeshDesc.mudwNumIndices];
-                in_meshStream->Read((s8*)out_subMeshDesc.mpIndexData, in_meshDesc.mudwIndexSize * out_subMeshDesc.mudwNumIndices);
+                const u64 indexDataSize = u64(in_meshDesc.mudwIndexSize) * u64(out_subMeshDesc.mudwNumIndices);
+                if (indexDataSize > in_reader.GetRemaining())
+                {
+                    return false;
+                }
+                out_subMeshDesc.mpIndexData = new u8[indexDataSize];
+                in_reader.Read<u8>(u32(indexDataSize), out_subMeshDesc.mpIndexData);
+                
+                return in_reader.IsBad() == false;
             }
             //-----------------------------------------------------------------------------
 			/// Reads the sub-mesh header section of the file
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param Mesh data reader
             /// @param Mesh description
 			/// @param [Out] Sube mesh description
             //-----------------------------------------------------------------------------
-            void ReadSubMeshHeader(const Core::FileStreamSPtr& in_meshStream, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
+            void ReadSubMeshHeader(Core::BinaryReader& in_reader, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
             {
                 //read mesh name
-                u8 nextChar = 0;
-                do
-                {
-                    nextChar = ReadValue<u8>(in_meshStream);
-                    out_subMeshDesc.mstrName += nextChar;
-                    
-                } while(nextChar != 0);
+                out_subMeshDesc.mstrName = in_reader.ReadString();
                 
                 //read num verts and triangles
                 if (2 == in_meshDesc.mudwIndexSize)
                 {
-                    out_subMeshDesc.mudwNumVertices = (u32)ReadValue<u16>(in_meshStream);
-                    out_subMeshDesc.mudwNumIndices = ((u32)ReadValue<u16>(in_meshStream)) * 3;
+                    out_subMeshDesc.mudwNumVertices = (u32)in_reader.Read<u16>();
+                    out_subMeshDesc.mudwNumIndices = ((u32)in_reader.Read<u16>()) * 3;
                 }
                 else
                 {
-                    out_subMeshDesc.mudwNumVertices = ReadValue<u32>(in_meshStream);
-                    out_subMeshDesc.mudwNumIndices = ReadValue<u32>(in_meshStream) * 3;
+                    out_subMeshDesc.mudwNumVertices = in_reader.Read<u32>();
+                    out_subMeshDesc.mudwNumIndices = in_reader.Read<u32>() * 3;
                 }
                 
                 //read bounds
-                out_subMeshDesc.mvMinBounds.x = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMinBounds.y = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMinBounds.z = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMaxBounds.x = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMaxBounds.y = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMaxBounds.z = ReadValue<f32>(in_meshStream);
+                f32 bounds[6];
+                in_reader.Read<f32>(6, bounds);
+                out_subMeshDesc.mvMinBounds = Core::Vector3(bounds[0], bounds[1], bounds[2]);
+                out_subMeshDesc.mvMaxBounds = Core::Vector3(bounds[3], bounds[4], bounds[5]);
                 
                 //TODO: Remove texture and material from mesh
                 //in the meantime just read and discard.
                 if (true == in_meshDesc.mFeatures.mbHasTexture)
                 {
-                    u8 nextCharacter = 0;
-                    do
-                    {
-                        nextCharacter = ReadValue<u8>(in_meshStream);
-                        
-                    } while(nextCharacter != 0);
+                    in_reader.ReadString();
                 }
                 
                 if (true == in_meshDesc.mFeatures.mbHasMaterial)
                 {
-                    u8 nextCharacter = 0;
-                    do
-                    {
-                        nextCharacter = ReadValue<u8>(in_meshStream);
-                        
-                    } while(nextCharacter != 0);
+                    in_reader.ReadString();
                 }
             }
             //-----------------------------------------------------------------------------
@@ -265,11 +234,11 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param Mesh data reader
             /// @param Container holding the num of meshes, joints and bones
 			/// @param [Out] Skeleton description
             //-----------------------------------------------------------------------------
-            void ReadSkeletonData(const Core::FileStreamSPtr& in_meshStream, const MeshDataQuantities& in_quantities, SkeletonDescriptor& out_skeletonDesc)
+            void ReadSkeletonData(Core::BinaryReader& in_reader, const MeshDataQuantities& in_quantities, SkeletonDescriptor& out_skeletonDesc)
             {
                 //read the skeleton nodes
                 out_skeletonDesc.m_nodeNames.reserve(in_quantities.m_numSkeletonNodes);
@@ -279,23 +248,17 @@ namespace ChilliSource
                 for (u32 i = 0; i<(u32)in_quantities.m_numSkeletonNodes; ++i)
                 {
                     //get the skeleton node name name
-                    std::string nodeName;
-                    u8 nextChar = 0;
-                    do
-                    {
-                        nextChar = ReadValue<u8>(in_meshStream);
-                        nodeName += nextChar;
-                    } while(nextChar != 0);
+                    std::string nodeName = in_reader.ReadString();
                     
                     //get the parent index
-                    s32 parentIndex = (s32)ReadValue<s16>(in_meshStream);
+                    s32 parentIndex = (s32)in_reader.Read<s16>();
                     
                     //get the type
                     const u32 k_isJoint = 1;
-                    u8 type = ReadValue<u8>(in_meshStream);
+                    u8 type = in_reader.Read<u8>();
                     if (type == k_isJoint)
                     {
-                        u32 jointIndex = (u32)ReadValue<u8>(in_meshStream);
+                        u32 jointIndex = (u32)in_reader.Read<u8>();
                         jointToNodeMap.insert(std::pair<u32, s32>(jointIndex, (s32)i));
                     }
                     
@@ -315,23 +278,23 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param Mesh data reader
 			/// @param the file path
             /// @param [Out] Mesh description
             /// @param [Out] A struct containing info on the number of meshes, nodes and joints.
             ///
 			/// @return Whether the file is correct
             //-----------------------------------------------------------------------------
-            bool ReadGlobalHeader(const Core::FileStreamSPtr& in_meshStream, const std::string& in_filePath, MeshDescriptor& out_meshDesc, MeshDataQuantities& out_meshQuantities)
+            bool ReadGlobalHeader(Core::BinaryReader& in_reader, const std::string& in_filePath, MeshDescriptor& out_meshDesc, MeshDataQuantities& out_meshQuantities)
             {
-                u32 fileCheckValue = ReadValue<u32>(in_meshStream);
+                u32 fileCheckValue = in_reader.Read<u32>();
                 if(fileCheckValue != k_fileCheckValue)
                 {
                     CS_LOG_ERROR("csmodel file has corruption(incorrect File Check Value): " + in_filePath);
                     return false;
                 }
                 
-                u32 versionNum = ReadValue<u32>(in_meshStream);
+                u32 versionNum = in_reader.Read<u32>();
                 if (versionNum < k_minVersion || versionNum > k_maxVersion)
                 {
                     CS_LOG_ERROR("Unsupported csmodel version: " + in_filePath);
@@ -344,10 +307,10 @@ namespace ChilliSource
                 out_meshDesc.mFeatures.mbHasTexture = false;
                 
                 //build the feature declaration from the file
-                u32 numFeatures = (u32)ReadValue<u8>(in_meshStream);
+                u32 numFeatures = (u32)in_reader.Read<u8>();
                 for (u32 i=0; i<numFeatures; ++i)
                 {
-                    u32 featureType = (u32)ReadValue<u8>(in_meshStream);
+                    u32 featureType = (u32)in_reader.Read<u8>();
                     
                     switch (Feature(featureType))
                     {
@@ -361,29 +324,27 @@ namespace ChilliSource
                 }
                 
                 //read the vertex declaration
-                ReadVertexDeclaration(in_meshStream, out_meshDesc);
+                ReadVertexDeclaration(in_reader, out_meshDesc);
                 
                 //read index declaration
-                out_meshDesc.mudwIndexSize = ReadValue<u8>(in_meshStream);
+                out_meshDesc.mudwIndexSize = in_reader.Read<u8>();
                 
                 //read the min and max bounds
-                out_meshDesc.mvMinBounds.x = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMinBounds.y = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMinBounds.z = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMaxBounds.x = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMaxBounds.y = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMaxBounds.z = ReadValue<f32>(in_meshStream);
+                f32 bounds[6];
+                in_reader.Read<f32>(6, bounds);
+                out_meshDesc.mvMinBounds = Core::Vector3(bounds[0], bounds[1], bounds[2]);
+                out_meshDesc.mvMaxBounds = Core::Vector3(bounds[3], bounds[4], bounds[5]);
                 
                 //read the number of meshes
-                out_meshQuantities.m_numMeshes = (u32)ReadValue<u16>(in_meshStream);
+                out_meshQuantities.m_numMeshes = (u32)in_reader.Read<u16>();
                 out_meshQuantities.m_numSkeletonNodes = 0;
                 out_meshQuantities.m_numJoints = 0;
                 
                 //read num skeleton nodes and joints if used
                 if (true == out_meshDesc.mFeatures.mbHasAnimationData)
                 {
-                    out_meshQuantities.m_numSkeletonNodes = (s32)ReadValue<s16>(in_meshStream);
-                    out_meshQuantities.m_numJoints = (u32)ReadValue<u8>(in_meshStream);
+                    out_meshQuantities.m_numSkeletonNodes = (s32)in_reader.Read<s16>();
+                    out_meshQuantities.m_numJoints = (u32)in_reader.Read<u8>();
                 }
                 
                 return true;
@@ -410,28 +371,42 @@ namespace ChilliSource
                     return false;
                 }
                 
+                //parse from memory rather than through the stream. This is a zero copy view of the file where the stream supports it.
+                Core::BinaryReader reader(meshStream);
+                
                 MeshDataQuantities quantities;
-                if(ReadGlobalHeader(meshStream, in_filePath, out_meshDesc, quantities) == false)
+                if(ReadGlobalHeader(reader, in_filePath, out_meshDesc, quantities) == false)
                 {
                     return false;
                 }
                 
                 if (true == out_meshDesc.mFeatures.mbHasAnimationData)
                 {
-                    ReadSkeletonData(meshStream, quantities, out_meshDesc.m_skeletonDesc);
+                    ReadSkeletonData(reader, quantities, out_meshDesc.m_skeletonDesc);
                 }
                 
-                for(u32 i=0; i<quantities.m_numMeshes; ++i)
+                out_meshDesc.mMeshes.reserve(quantities.m_numMeshes);
+                bool isComplete = true;
+                for(u32 i=0; i<quantities.m_numMeshes && isComplete == true; ++i)
                 {
-                    SubMeshDescriptor subMeshDesc;
+                    out_meshDesc.mMeshes.push_back(SubMeshDescriptor());
+                    SubMeshDescriptor& subMeshDesc = out_meshDesc.mMeshes.back();
                     
-                    ReadSubMeshHeader(meshStream, out_meshDesc, subMeshDesc);
-                    ReadSubMeshData(meshStream, out_meshDesc, subMeshDesc);
-                    
-                    out_meshDesc.mMeshes.push_back(subMeshDesc);
+                    ReadSubMeshHeader(reader, out_meshDesc, subMeshDesc);
+                    isComplete = ReadSubMeshData(reader, out_meshDesc, subMeshDesc);
                 }
                 
-                meshStream->Close();
+                if (isComplete == false || reader.IsBad() == true)
+                {
+                    CS_LOG_ERROR("csmodel file is truncated: " + in_filePath);
+                    for (auto& subMeshDesc : out_meshDesc.mMeshes)
+                    {
+                        delete[] subMeshDesc.mpVertexData;
+                        delete[] subMeshDesc.mpIndexData;
+                    }
+                    out_meshDesc.mMeshes.clear();
+                    return false;
+                }
                 
                 return true;
             }
@@ -72,12 +72,21 @@ namespace ChilliSource
             //set the bounds
             SetBounds(in_meshDesc.mvMinBounds, in_meshDesc.mvMaxBounds);
             
+            //the skeleton is rebuilt in place as animation groups hold on to it, and the mesh may
+            //be rebuilt while they are still in use.
             if (in_meshDesc.mFeatures.mbHasAnimationData == true)
             {
-                m_skeleton = SkeletonUPtr(new Skeleton());
                 m_skeleton->Build(in_meshDesc.m_skeletonDesc);
             }
             
+            //if the mesh is being rebuilt from the same file (i.e. when it is refreshed after a context
+            //loss) the existing sub meshes and their buffers can be re-used rather than re-created.
+            bool rebuildExisting = (m_subMeshes.empty() == false && m_subMeshes.size() == in_meshDesc.mMeshes.size());
+            if (rebuildExisting == false)
+            {
+                m_subMeshes.clear();
+            }
+            
             //iterate through each mesh
             int count = 0;
             for (auto it = in_meshDesc.mMeshes.begin(); it != in_meshDesc.mMeshes.end(); ++it)
@@ -87,8 +96,17 @@ namespace ChilliSource
                 u32 udwIndexDataCapacity  = it->mudwNumIndices * in_meshDesc.mudwIndexSize;
                 
                 //prepare the mesh if it needs it, otherwise just update the vertex and index declarations.
-                SubMesh* newSubMesh = CreateSubMesh(it->mstrName);
-                newSubMesh->Prepare(Core::Application::Get()->GetRenderSystem(), in_meshDesc.mVertexDeclaration, in_meshDesc.mudwIndexSize, udwVertexDataCapacity, udwIndexDataCapacity, BufferAccess::k_read, it->ePrimitiveType);
+                SubMesh* newSubMesh = nullptr;
+                if (rebuildExisting == true)
+                {
+                    newSubMesh = m_subMeshes[count].get();
+                    newSubMesh->AlterBufferDeclaration(in_meshDesc.mVertexDeclaration, in_meshDesc.mudwIndexSize);
+                }
+                else
+                {
+                    newSubMesh = CreateSubMesh(it->mstrName);
+                    newSubMesh->Prepare(Core::Application::Get()->GetRenderSystem(), in_meshDesc.mVertexDeclaration, in_meshDesc.mudwIndexSize, udwVertexDataCapacity, udwIndexDataCapacity, BufferAccess::k_read, it->ePrimitiveType);
+                }
                 
                 //check that the buffers are big enough to hold this data. if not throw an error.
                 if (udwVertexDataCapacity <= newSubMesh->GetInternalMeshBuffer()->GetVertexCapacity() &&
@@ -204,6 +222,12 @@ namespace ChilliSource
 		void Mesh::Render(RenderSystem* in_renderSystem, const Core::Matrix4& in_worldMat, const std::vector<MaterialCSPtr>& in_materials, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& in_animGroup) const
 		{
             CS_ASSERT(in_materials.size() > 0, "Must have at least one material to render");
+            
+            //A mesh loaded from file may be mid-way through being refreshed, in which case its buffers are not yet populated.
+            if (GetStorageLocation() != Core::StorageLocation::k_none && GetLoadState() != Core::Resource::LoadState::k_loaded)
+            {
+                return;
+            }
 
             std::vector<SubMesh*> aOpaqueSubMeshes;
             aOpaqueSubMeshes.reserve(m_subMeshes.size());
@@ -238,7 +262,8 @@ namespace ChilliSource
                 udwCurrMaterial = std::min(udwCurrMaterial, (u32)in_materials.size()-1);
 					
 #ifdef CS_ENABLE_DEBUGSTATS
-                Core::Application::Get()->GetDebugStats()->AddToEvent("Meshes", 1);
+                static const Debugging::DebugStats::CounterHandle k_meshesCounter = Debugging::DebugStats::RegisterCounter("Meshes");
+                Core::Application::Get()->GetDebugStats()->IncrementCounter(k_meshesCounter);
 #endif
                 (*it)->Render(in_renderSystem, in_worldMat, pMaterial, in_shaderPass, in_animGroup);
 			}
@@ -252,7 +277,8 @@ namespace ChilliSource
                 udwCurrMaterial = (u32)std::min(udwCurrMaterial, (u32)in_materials.size()-1);
 				
 #ifdef CS_ENABLE_DEBUGSTATS
-                Core::Application::Get()->GetDebugStats()->AddToEvent("Meshes_Trans", 1);
+                static const Debugging::DebugStats::CounterHandle k_transparentMeshesCounter = Debugging::DebugStats::RegisterCounter("Meshes_Trans");
+                Core::Application::Get()->GetDebugStats()->IncrementCounter(k_transparentMeshesCounter);
 #endif
                 (*it)->Render(in_renderSystem, in_worldMat, pMaterial, in_shaderPass, in_animGroup);
 			}
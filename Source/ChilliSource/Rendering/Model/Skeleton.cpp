@@ -40,6 +40,7 @@ namespace ChilliSource
         //-------------------------------------------------------------------------
         void Skeleton::Build(const SkeletonDescriptor& in_desc)
         {
+            mapNodes.clear();
             mapNodes.reserve(in_desc.m_nodeNames.size());
             
             for(u32 i=0; i<in_desc.m_nodeNames.size(); ++i)
@@ -56,7 +56,9 @@ namespace ChilliSource
 		{
 		public:
             //-------------------------------------------------------------------------
-            /// Construct the skeleton from the given descriptor.
+            /// Construct the skeleton from the given descriptor. Any
+            /// existing nodes are replaced, so the skeleton can be
+            /// rebuilt in place while animations still refer to it.
             ///
             /// @author S Downie
             ///
@@ -28,10 +28,22 @@
 
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 
+#include <ChilliSource/Core/Math/MathUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace ChilliSource
 {
 	namespace Rendering
 	{
+        namespace
+        {
+            const u32 k_quantisedRange = 65535;
+            const u32 k_maxKeyFrameSpan = 64;
+        }
+        
 		CS_DEFINE_NAMEDTYPE(SkinnedAnimation);
         //---------------------------------------------------------------------
         //---------------------------------------------------------------------
@@ -42,7 +54,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------
 		//--------------------------------------------------------------------
 		SkinnedAnimation::SkinnedAnimation()
-        : m_frameTime(0.0f)
+        : m_frameTime(0.0f), m_numFrames(0), m_isCompressed(false), m_numNodes(0)
 		{
 		}
 		//---------------------------------------------------------------------
@@ -55,9 +67,69 @@ namespace ChilliSource
 		//---------------------------------------------------------------------
 		const SkinnedAnimation::Frame* SkinnedAnimation::GetFrameAtIndex(u32 in_index) const
 		{
+            CS_ASSERT(m_isCompressed == false, "Frames cannot be accessed directly in a compressed skinned animation.");
             CS_ASSERT(in_index < m_frames.size(), "Skinned animation frame out of bounds");
             return m_frames[in_index].get();
 		}
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        void SkinnedAnimation::InterpolateFrames(u32 in_frameA, u32 in_frameB, f32 in_factor, SkinnedAnimation::Frame& out_frame) const
+        {
+            CS_ASSERT(in_frameA < m_numFrames && in_frameB < m_numFrames, "Skinned animation frame out of bounds");
+            
+            if (m_isCompressed == false)
+            {
+                const Frame* frameA = m_frames[in_frameA].get();
+                const Frame* frameB = m_frames[in_frameB].get();
+                
+                u32 numTranslations = std::min(frameA->m_nodeTranslations.size(), frameB->m_nodeTranslations.size());
+                out_frame.m_nodeTranslations.resize(numTranslations);
+                for (u32 i = 0; i < numTranslations; ++i)
+                {
+                    out_frame.m_nodeTranslations[i] = Core::MathUtils::Lerp(in_factor, frameA->m_nodeTranslations[i], frameB->m_nodeTranslations[i]);
+                }
+                
+                u32 numOrientations = std::min(frameA->m_nodeOrientations.size(), frameB->m_nodeOrientations.size());
+                out_frame.m_nodeOrientations.resize(numOrientations);
+                for (u32 i = 0; i < numOrientations; ++i)
+                {
+                    out_frame.m_nodeOrientations[i] = Core::Quaternion::Slerp(frameA->m_nodeOrientations[i], frameB->m_nodeOrientations[i], in_factor);
+                }
+                
+                u32 numScales = std::min(frameA->m_nodeScales.size(), frameB->m_nodeScales.size());
+                out_frame.m_nodeScales.resize(numScales);
+                for (u32 i = 0; i < numScales; ++i)
+                {
+                    out_frame.m_nodeScales[i] = Core::MathUtils::Lerp(in_factor, frameA->m_nodeScales[i], frameB->m_nodeScales[i]);
+                }
+                
+                return;
+            }
+            
+            out_frame.m_nodeTranslations.resize(m_numNodes);
+            out_frame.m_nodeOrientations.resize(m_numNodes);
+            out_frame.m_nodeScales.resize(m_numNodes);
+            
+            for (u32 i = 0; i < m_numNodes; ++i)
+            {
+                f32 a[4];
+                f32 b[4];
+                
+                DecodeTrack(m_translationTracks[i], 3, in_frameA, a);
+                DecodeTrack(m_translationTracks[i], 3, in_frameB, b);
+                out_frame.m_nodeTranslations[i] = Core::MathUtils::Lerp(in_factor, Core::Vector3(a[0], a[1], a[2]), Core::Vector3(b[0], b[1], b[2]));
+                
+                DecodeTrack(m_orientationTracks[i], 4, in_frameA, a);
+                DecodeTrack(m_orientationTracks[i], 4, in_frameB, b);
+                Core::Quaternion orientationA = Core::Quaternion::Normalise(Core::Quaternion(a[0], a[1], a[2], a[3]));
+                Core::Quaternion orientationB = Core::Quaternion::Normalise(Core::Quaternion(b[0], b[1], b[2], b[3]));
+                out_frame.m_nodeOrientations[i] = Core::Quaternion::Slerp(orientationA, orientationB, in_factor);
+                
+                DecodeTrack(m_scaleTracks[i], 3, in_frameA, a);
+                DecodeTrack(m_scaleTracks[i], 3, in_frameB, b);
+                out_frame.m_nodeScales[i] = Core::MathUtils::Lerp(in_factor, Core::Vector3(a[0], a[1], a[2]), Core::Vector3(b[0], b[1], b[2]));
+            }
+        }
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
 		f32 SkinnedAnimation::GetFrameTime() const
@@ -68,13 +140,16 @@ namespace ChilliSource
 		//---------------------------------------------------------------------
 		u32 SkinnedAnimation::GetNumFrames() const
 		{
-			return m_frames.size();
+			return m_numFrames;
 		}
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
 		void SkinnedAnimation::AddFrame(SkinnedAnimation::FrameCUPtr in_frame)
 		{
+            CS_ASSERT(m_isCompressed == false, "Frames cannot be added to a compressed skinned animation.");
+            
 			m_frames.push_back(std::move(in_frame));
+            m_numFrames = m_frames.size();
 		}
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
@@ -82,6 +157,250 @@ namespace ChilliSource
 		{
 			m_frameTime = in_timeBetweenFrames;
 		}
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        void SkinnedAnimation::Compress(f32 in_translationTolerance, f32 in_orientationTolerance, f32 in_scaleTolerance, bool in_keyFrameReductionEnabled)
+        {
+            CS_ASSERT(m_isCompressed == false, "Skinned animation is already compressed.");
+            
+            if (m_frames.empty() == true)
+            {
+                return;
+            }
+            
+            m_numNodes = m_frames[0]->m_nodeTranslations.size();
+            for (const auto& frame : m_frames)
+            {
+                if (frame->m_nodeTranslations.size() != m_numNodes || frame->m_nodeOrientations.size() != m_numNodes || frame->m_nodeScales.size() != m_numNodes)
+                {
+                    CS_LOG_ERROR("Cannot compress skinned animation because its frames have differing numbers of nodes.");
+                    m_numNodes = 0;
+                    return;
+                }
+            }
+            
+            //key frame indices are stored in 16 bits.
+            bool keyFrameReductionEnabled = in_keyFrameReductionEnabled && m_numFrames <= std::numeric_limits<u16>::max();
+            
+            m_translationTracks.reserve(m_numNodes);
+            m_orientationTracks.reserve(m_numNodes);
+            m_scaleTracks.reserve(m_numNodes);
+            
+            std::vector<f32> translations(m_numFrames * 3);
+            std::vector<f32> orientations(m_numFrames * 4);
+            std::vector<f32> scales(m_numFrames * 3);
+            for (u32 node = 0; node < m_numNodes; ++node)
+            {
+                Core::Quaternion previousOrientation;
+                for (u32 frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+                {
+                    const Frame* frame = m_frames[frameIndex].get();
+                    
+                    const Core::Vector3& translation = frame->m_nodeTranslations[node];
+                    translations[frameIndex * 3 + 0] = translation.x;
+                    translations[frameIndex * 3 + 1] = translation.y;
+                    translations[frameIndex * 3 + 2] = translation.z;
+                    
+                    //q and -q are the same rotation, so keep each orientation in the same hemisphere as the
+                    //last to avoid discontinuities which would defeat both quantisation and key frame reduction.
+                    Core::Quaternion orientation = frame->m_nodeOrientations[node];
+                    if (frameIndex > 0 && Core::Quaternion::Dot(orientation, previousOrientation) < 0.0f)
+                    {
+                        orientation = Core::Quaternion(-orientation.x, -orientation.y, -orientation.z, -orientation.w);
+                    }
+                    previousOrientation = orientation;
+                    orientations[frameIndex * 4 + 0] = orientation.x;
+                    orientations[frameIndex * 4 + 1] = orientation.y;
+                    orientations[frameIndex * 4 + 2] = orientation.z;
+                    orientations[frameIndex * 4 + 3] = orientation.w;
+                    
+                    const Core::Vector3& scale = frame->m_nodeScales[node];
+                    scales[frameIndex * 3 + 0] = scale.x;
+                    scales[frameIndex * 3 + 1] = scale.y;
+                    scales[frameIndex * 3 + 2] = scale.z;
+                }
+                
+                m_translationTracks.push_back(CompressTrack(translations, 3, in_translationTolerance, keyFrameReductionEnabled));
+                m_orientationTracks.push_back(CompressTrack(orientations, 4, in_orientationTolerance, keyFrameReductionEnabled));
+                m_scaleTracks.push_back(CompressTrack(scales, 3, in_scaleTolerance, keyFrameReductionEnabled));
+            }
+            
+            m_frames.clear();
+            m_frames.shrink_to_fit();
+            m_isCompressed = true;
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        bool SkinnedAnimation::IsCompressed() const
+        {
+            return m_isCompressed;
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        SkinnedAnimation::CompressedTrack SkinnedAnimation::CompressTrack(const std::vector<f32>& in_values, u32 in_numComponents, f32 in_tolerance, bool in_keyFrameReductionEnabled) const
+        {
+            CompressedTrack track;
+            
+            //find the range of each component
+            bool isConstant = true;
+            for (u32 component = 0; component < in_numComponents; ++component)
+            {
+                f32 minimum = in_values[component];
+                f32 maximum = in_values[component];
+                for (u32 frame = 1; frame < m_numFrames; ++frame)
+                {
+                    minimum = std::min(minimum, in_values[frame * in_numComponents + component]);
+                    maximum = std::max(maximum, in_values[frame * in_numComponents + component]);
+                }
+                
+                track.m_minimum[component] = minimum;
+                track.m_step[component] = (maximum - minimum) / f32(k_quantisedRange);
+                
+                if ((maximum - minimum) * 0.5f > in_tolerance)
+                {
+                    isConstant = false;
+                }
+            }
+            
+            //tracks that never move further than the tolerance are stored as a single value at the centre of their range.
+            if (isConstant == true)
+            {
+                for (u32 component = 0; component < in_numComponents; ++component)
+                {
+                    track.m_minimum[component] += track.m_step[component] * f32(k_quantisedRange) * 0.5f;
+                    track.m_step[component] = 0.0f;
+                }
+                
+                track.m_numKeys = 1;
+                track.m_values.assign(in_numComponents, 0);
+                return track;
+            }
+            
+            //quantise each frame
+            std::vector<u16> quantised(m_numFrames * in_numComponents);
+            std::vector<f32> dequantised(m_numFrames * in_numComponents);
+            for (u32 i = 0; i < m_numFrames * in_numComponents; ++i)
+            {
+                u32 component = i % in_numComponents;
+                u16 value = 0;
+                if (track.m_step[component] > 0.0f)
+                {
+                    f32 normalised = (in_values[i] - track.m_minimum[component]) / track.m_step[component];
+                    value = u16(std::min(std::max(normalised + 0.5f, 0.0f), f32(k_quantisedRange)));
+                }
+                
+                quantised[i] = value;
+                dequantised[i] = track.m_minimum[component] + f32(value) * track.m_step[component];
+            }
+            
+            if (in_keyFrameReductionEnabled == false || m_numFrames <= 2)
+            {
+                track.m_numKeys = m_numFrames;
+                track.m_values = std::move(quantised);
+                return track;
+            }
+            
+            //greedily extend each span between kept keys as far as every skipped frame can still be reconstructed
+            //within tolerance. The comparison is against the original values, using the dequantised key values so
+            //that quantisation error is accounted for. Spans are capped to keep compression time bounded.
+            std::vector<u32> keys;
+            keys.push_back(0);
+            u32 first = 0;
+            while (first < m_numFrames - 1)
+            {
+                u32 last = first + 1;
+                while (last + 1 < m_numFrames && last + 1 - first <= k_maxKeyFrameSpan)
+                {
+                    u32 candidate = last + 1;
+                    bool canSkip = true;
+                    for (u32 frame = first + 1; frame < candidate && canSkip == true; ++frame)
+                    {
+                        for (u32 component = 0; component < in_numComponents && canSkip == true; ++component)
+                        {
+                            f32 factor = f32(frame - first) / f32(candidate - first);
+                            f32 reconstructed = Core::MathUtils::Lerp(factor, dequantised[first * in_numComponents + component], dequantised[candidate * in_numComponents + component]);
+                            canSkip = std::abs(reconstructed - in_values[frame * in_numComponents + component]) <= in_tolerance;
+                        }
+                    }
+                    
+                    if (canSkip == false)
+                    {
+                        break;
+                    }
+                    
+                    last = candidate;
+                }
+                
+                keys.push_back(last);
+                first = last;
+            }
+            
+            track.m_numKeys = keys.size();
+            track.m_values.reserve(keys.size() * in_numComponents);
+            for (u32 key : keys)
+            {
+                track.m_values.insert(track.m_values.end(), quantised.begin() + key * in_numComponents, quantised.begin() + (key + 1) * in_numComponents);
+            }
+            
+            //key frame indices are only needed if any frames were actually removed.
+            if (keys.size() < m_numFrames)
+            {
+                track.m_keyFrames.reserve(keys.size());
+                for (u32 key : keys)
+                {
+                    track.m_keyFrames.push_back(u16(key));
+                }
+            }
+            
+            return track;
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        void SkinnedAnimation::DecodeTrack(const CompressedTrack& in_track, u32 in_numComponents, u32 in_frame, f32* out_values) const
+        {
+            if (in_track.m_numKeys == 1)
+            {
+                for (u32 component = 0; component < in_numComponents; ++component)
+                {
+                    out_values[component] = in_track.m_minimum[component];
+                }
+                return;
+            }
+            
+            if (in_track.m_keyFrames.empty() == true)
+            {
+                const u16* value = &in_track.m_values[in_frame * in_numComponents];
+                for (u32 component = 0; component < in_numComponents; ++component)
+                {
+                    out_values[component] = in_track.m_minimum[component] + f32(value[component]) * in_track.m_step[component];
+                }
+                return;
+            }
+            
+            //find the pair of keys either side of the frame and interpolate between them.
+            auto next = std::upper_bound(in_track.m_keyFrames.begin(), in_track.m_keyFrames.end(), u16(in_frame));
+            if (next == in_track.m_keyFrames.end())
+            {
+                --next;
+            }
+            if (next == in_track.m_keyFrames.begin())
+            {
+                ++next;
+            }
+            auto previous = next - 1;
+            
+            u32 previousIndex = u32(previous - in_track.m_keyFrames.begin());
+            u32 nextIndex = previousIndex + 1;
+            f32 factor = std::min(std::max(f32(s32(in_frame) - s32(*previous)) / f32(*next - *previous), 0.0f), 1.0f);
+            
+            const u16* previousValue = &in_track.m_values[previousIndex * in_numComponents];
+            const u16* nextValue = &in_track.m_values[nextIndex * in_numComponents];
+            for (u32 component = 0; component < in_numComponents; ++component)
+            {
+                f32 a = in_track.m_minimum[component] + f32(previousValue[component]) * in_track.m_step[component];
+                f32 b = in_track.m_minimum[component] + f32(nextValue[component]) * in_track.m_step[component];
+                out_values[component] = Core::MathUtils::Lerp(factor, a, b);
+            }
+        }
 	}
 }
-
@@ -76,6 +76,9 @@ namespace ChilliSource
 			//---------------------------------------------------------------------
 			bool IsA(Core::InterfaceIDType in_interfaceId) const override;
 			//---------------------------------------------------------------------
+			/// Frames are not available once the animation has been compressed;
+			/// use InterpolateFrames() instead, which works in either case.
+			///
 			/// @author Ian Copland
 			///
 			/// @param the index to the frame
@@ -83,6 +86,18 @@ namespace ChilliSource
 			//---------------------------------------------------------------------
 			const SkinnedAnimation::Frame* GetFrameAtIndex(u32 in_index) const;
 			//---------------------------------------------------------------------
+			/// Samples the animation between two frames, writing the result into
+			/// the given frame. The output frame is resized to the number of
+			/// skeleton nodes if required, so reusing the same output frame
+			/// avoids any allocation.
+			///
+			/// @param The index of the first frame.
+			/// @param The index of the second frame.
+			/// @param The interpolation factor between the two frames.
+			/// @param [Out] The output frame.
+			//---------------------------------------------------------------------
+			void InterpolateFrames(u32 in_frameA, u32 in_frameB, f32 in_factor, SkinnedAnimation::Frame& out_frame) const;
+			//---------------------------------------------------------------------
 			/// @author Ian Copland
 			///
 			/// @return the time between frames in seconds
@@ -112,6 +127,29 @@ namespace ChilliSource
 			/// @param The time between frames in seconds
 			//---------------------------------------------------------------------
 			void SetFrameTime(f32 in_timeBetweenFrames);
+            //---------------------------------------------------------------------
+            /// Compresses the animation, replacing the full precision frames with
+            /// a compact track based representation. For each node, the
+            /// translation, orientation and scale are stored as separate tracks:
+            /// tracks which do not change are reduced to a single value, and the
+            /// rest are quantised to 16 bits per component. Optionally, key frames
+            /// which can be reconstructed by interpolating their neighbours within
+            /// the given tolerances are removed.
+            ///
+            /// This trades a little CPU time when sampling for a large reduction
+            /// in memory. All frames must have been added before this is called.
+            ///
+            /// @param The maximum error allowed in translation components.
+            /// @param The maximum error allowed in orientation quaternion
+            /// components.
+            /// @param The maximum error allowed in scale components.
+            /// @param Whether or not redundant key frames should be removed.
+            //---------------------------------------------------------------------
+            void Compress(f32 in_translationTolerance, f32 in_orientationTolerance, f32 in_scaleTolerance, bool in_keyFrameReductionEnabled);
+            //---------------------------------------------------------------------
+            /// @return Whether or not the animation has been compressed.
+            //---------------------------------------------------------------------
+            bool IsCompressed() const;
             
 		private:
             
@@ -133,10 +171,54 @@ namespace ChilliSource
 			//---------------------------------------------------------------------
 			SkinnedAnimation();
             
+            //---------------------------------------------------------------------
+            /// A single compressed channel of a single skeleton node. Values
+            /// are stored quantised relative to the per component minimum. If
+            /// key frames have been removed, the frame index of each remaining
+            /// key is stored; otherwise there is one key per frame, or a single
+            /// key if the track is constant.
+            //---------------------------------------------------------------------
+            struct CompressedTrack
+            {
+                f32 m_minimum[4];
+                f32 m_step[4];
+                u32 m_numKeys = 0;
+                std::vector<u16> m_keyFrames;
+                std::vector<u16> m_values;
+            };
+            //---------------------------------------------------------------------
+            /// Builds a compressed track from the given full precision values.
+            ///
+            /// @param The values, with the given number of components for each
+            /// frame.
+            /// @param The number of components per value.
+            /// @param The maximum allowed error.
+            /// @param Whether or not redundant key frames should be removed.
+            ///
+            /// @return The compressed track.
+            //---------------------------------------------------------------------
+            CompressedTrack CompressTrack(const std::vector<f32>& in_values, u32 in_numComponents, f32 in_tolerance, bool in_keyFrameReductionEnabled) const;
+            //---------------------------------------------------------------------
+            /// Decodes the value of a compressed track at the given frame.
+            ///
+            /// @param The track.
+            /// @param The number of components per value.
+            /// @param The frame index.
+            /// @param [Out] The decoded components.
+            //---------------------------------------------------------------------
+            void DecodeTrack(const CompressedTrack& in_track, u32 in_numComponents, u32 in_frame, f32* out_values) const;
+            
 		private:
 			
 			f32 m_frameTime;
+			u32 m_numFrames;
 			std::vector<SkinnedAnimation::FrameCUPtr> m_frames;
+            
+            bool m_isCompressed;
+            u32 m_numNodes;
+            std::vector<CompressedTrack> m_translationTracks;
+            std::vector<CompressedTrack> m_orientationTracks;
+            std::vector<CompressedTrack> m_scaleTracks;
 		};
 	}
 }
@@ -105,38 +105,36 @@ namespace ChilliSource
                     }
                 }
                 
-                //get the animation frames
-                SkinnedAnimation::FrameCUPtr pFrame1;
+                //get the animation frames. These are sampled into reused scratch frames to avoid allocating every update.
                 if (pAnimItem1 != nullptr)
-                    pFrame1 = CalculateAnimationFrame(pAnimItem1->pSkinnedAnimation, infPlaybackPosition);
+                    CalculateAnimationFrame(pAnimItem1->pSkinnedAnimation, infPlaybackPosition, mBlendFrameA);
                 
-                SkinnedAnimation::FrameCUPtr pFrame2;
                 if (pAnimItem2 != nullptr)
-                    pFrame2 = CalculateAnimationFrame(pAnimItem2->pSkinnedAnimation, infPlaybackPosition);
+                    CalculateAnimationFrame(pAnimItem2->pSkinnedAnimation, infPlaybackPosition, mBlendFrameB);
                 
                 //check that we do indeed have two animations to blend. if not, just return the frame we do have.
-                if (pFrame1 != nullptr && pFrame2 != nullptr && pAnimItem1.get() != pAnimItem2.get())
+                if (pAnimItem1 != nullptr && pAnimItem2 != nullptr && pAnimItem1.get() != pAnimItem2.get())
                 {
                     //get the interpolation factor and then apply the requested blend to the two frames.
                     f32 fFactor = (infBlendlinePosition - pAnimItem1->fBlendlinePosition) / (pAnimItem2->fBlendlinePosition - pAnimItem1->fBlendlinePosition);
                     switch (ineBlendType)
                     {
                         case AnimationBlendType::k_linear:
-                            mCurrentAnimationData = LerpBetweenFrames(pFrame1.get(), pFrame2.get(), fFactor);
+                            LerpBetweenFrames(mBlendFrameA, mBlendFrameB, fFactor, mCurrentAnimationData);
                             break;
                         default:
                             CS_LOG_ERROR("Invalid animation blend type given.");
-                            mCurrentAnimationData = std::move(pFrame1);
+                            std::swap(mCurrentAnimationData, mBlendFrameA);
                             break;
                     }
                 }
-                else if (pFrame1 != nullptr)
+                else if (pAnimItem1 != nullptr)
                 {
-                    mCurrentAnimationData = std::move(pFrame1);
+                    std::swap(mCurrentAnimationData, mBlendFrameA);
                 }
-                else if (pFrame2 != nullptr)
+                else if (pAnimItem2 != nullptr)
                 {
-                    mCurrentAnimationData = std::move(pFrame2);
+                    std::swap(mCurrentAnimationData, mBlendFrameB);
                 }
                 else 
                 {
@@ -148,7 +146,7 @@ namespace ChilliSource
             else if (mAnimations.size() > 0) 
             {
                 const SkinnedAnimationCSPtr& pAnim = mAnimations[0]->pSkinnedAnimation;
-                mCurrentAnimationData = CalculateAnimationFrame(pAnim, infPlaybackPosition);
+                CalculateAnimationFrame(pAnim, infPlaybackPosition, mCurrentAnimationData);
                 mbPrepared = true;
             }
             else
@@ -165,7 +163,7 @@ namespace ChilliSource
             switch (ineBlendType)
             {
                 case AnimationBlendType::k_linear:
-                    mCurrentAnimationData = LerpBetweenFrames(mCurrentAnimationData.get(), inpAnimationGroup->mCurrentAnimationData.get(), infBlendFactor);
+                    LerpBetweenFrames(mCurrentAnimationData, inpAnimationGroup->mCurrentAnimationData, infBlendFactor, mCurrentAnimationData);
                     break;
                 default:
                     CS_LOG_ERROR("Invalid animation blend type given.");
@@ -185,9 +183,9 @@ namespace ChilliSource
 				{
 					//get the world translation and orientation
 					Core::Matrix4 localMat;
-                    if(mCurrentAnimationData->m_nodeTranslations.empty() == false)
+                    if(mCurrentAnimationData.m_nodeTranslations.empty() == false)
                     {
-						localMat = Core::Matrix4::CreateTransform(mCurrentAnimationData->m_nodeTranslations[currIndex], mCurrentAnimationData->m_nodeScales[currIndex], mCurrentAnimationData->m_nodeOrientations[currIndex]);
+						localMat = Core::Matrix4::CreateTransform(mCurrentAnimationData.m_nodeTranslations[currIndex], mCurrentAnimationData.m_nodeScales[currIndex], mCurrentAnimationData.m_nodeOrientations[currIndex]);
                     }
 					
 					//convert to matrix and store
@@ -307,7 +305,7 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Calculate Animation Frame
         //----------------------------------------------------------
-        SkinnedAnimation::FrameCUPtr SkinnedAnimationGroup::CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition)
+        void SkinnedAnimationGroup::CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition, SkinnedAnimation::Frame& outFrame)
         {
             //report errors if the playback position provided does not make sense
             if (infPlaybackPosition < 0.0f)
@@ -341,78 +339,38 @@ namespace ChilliSource
                 dwFrameBIndex = inpAnimation->GetNumFrames() - 1;
             }
             
-			//get the frames
-			const SkinnedAnimation::Frame* frameA = inpAnimation->GetFrameAtIndex(dwFrameAIndex);
-			const SkinnedAnimation::Frame* frameB = inpAnimation->GetFrameAtIndex(dwFrameBIndex);
-			
 			//get the ratio of one frame to the next
 			f32 interpFactor = (infPlaybackPosition - (dwFrameAIndex * inpAnimation->GetFrameTime())) / inpAnimation->GetFrameTime();
 			
-			//blend between frames
-            return LerpBetweenFrames(frameA, frameB, interpFactor);
+			//blend between frames. This is performed by the animation so that compressed animations can be decoded directly.
+            inpAnimation->InterpolateFrames((u32)dwFrameAIndex, (u32)dwFrameBIndex, interpFactor, outFrame);
         }
         //--------------------------------------------------------------
         /// Lerp Between Frames
         //--------------------------------------------------------------
-        SkinnedAnimation::FrameCUPtr SkinnedAnimationGroup::LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor)
+        void SkinnedAnimationGroup::LerpBetweenFrames(const SkinnedAnimation::Frame& inFrameA, const SkinnedAnimation::Frame& inFrameB, f32 infInterpFactor, SkinnedAnimation::Frame& outFrame)
         {
-            SkinnedAnimation::FrameUPtr outFrame(new SkinnedAnimation::Frame());
-			
-            if(inFrameA != nullptr && inFrameB != nullptr)
+            //each element is read from both inputs before the output is written, so the output may be one of the inputs.
+            u32 udwNumTranslations = std::min(inFrameA.m_nodeTranslations.size(), inFrameB.m_nodeTranslations.size());
+            outFrame.m_nodeTranslations.resize(udwNumTranslations);
+            for (u32 i = 0; i < udwNumTranslations; ++i)
             {
-                //iterate through each translation
-                outFrame->m_nodeTranslations.reserve(inFrameB->m_nodeTranslations.size());
-                std::vector<Core::Vector3>::const_iterator transAIt = inFrameA->m_nodeTranslations.begin();
-                for (std::vector<Core::Vector3>::const_iterator transBIt = inFrameB->m_nodeTranslations.begin();
-                     transAIt != inFrameA->m_nodeTranslations.end() && transBIt != inFrameB->m_nodeTranslations.end();)
-                {
-                    //lerp
-                    Core::Vector3 newTrans = Core::MathUtils::Lerp(infInterpFactor, *transAIt, *transBIt);
-                    
-                    //add to frame
-                    outFrame->m_nodeTranslations.push_back(newTrans);
-                    
-                    //incriment the iterators
-                    ++transAIt;
-                    ++transBIt;
-                }
-                
-                //iterate through each orientation
-                outFrame->m_nodeOrientations.reserve(inFrameB->m_nodeOrientations.size());
-                std::vector<Core::Quaternion>::const_iterator orientAIt = inFrameA->m_nodeOrientations.begin();
-                for (std::vector<Core::Quaternion>::const_iterator orientBIt = inFrameB->m_nodeOrientations.begin();
-                     orientAIt != inFrameA->m_nodeOrientations.end() && orientBIt != inFrameB->m_nodeOrientations.end();)
-                {
-                    //lerp
-                    Core::Quaternion newOrient = Core::Quaternion::Slerp(*orientAIt, *orientBIt, infInterpFactor);
-                    
-                    //add to frame
-                    outFrame->m_nodeOrientations.push_back(newOrient);
-                    
-                    //incriment the iterators
-                    ++orientAIt;
-                    ++orientBIt;
-                }
-                
-                //iterate through each scale
-                outFrame->m_nodeScales.reserve(inFrameB->m_nodeScales.size());
-                std::vector<Core::Vector3>::const_iterator scaleAIt = inFrameA->m_nodeScales.begin();
-                for (std::vector<Core::Vector3>::const_iterator scaleBIt = inFrameB->m_nodeScales.begin();
-                     scaleAIt != inFrameA->m_nodeScales.end() && scaleBIt != inFrameB->m_nodeScales.end();)
-                {
-                    //lerp
-                    Core::Vector3 newScale = Core::MathUtils::Lerp(infInterpFactor, *scaleAIt, *scaleBIt);
-                    
-                    //add to frame
-                    outFrame->m_nodeScales.push_back(newScale);
-                    
-                    //incriment the iterators
-                    ++scaleAIt;
-                    ++scaleBIt;
-                }
+                outFrame.m_nodeTranslations[i] = Core::MathUtils::Lerp(infInterpFactor, inFrameA.m_nodeTranslations[i], inFrameB.m_nodeTranslations[i]);
+            }
+            
+            u32 udwNumOrientations = std::min(inFrameA.m_nodeOrientations.size(), inFrameB.m_nodeOrientations.size());
+            outFrame.m_nodeOrientations.resize(udwNumOrientations);
+            for (u32 i = 0; i < udwNumOrientations; ++i)
+            {
+                outFrame.m_nodeOrientations[i] = Core::Quaternion::Slerp(inFrameA.m_nodeOrientations[i], inFrameB.m_nodeOrientations[i], infInterpFactor);
+            }
+            
+            u32 udwNumScales = std::min(inFrameA.m_nodeScales.size(), inFrameB.m_nodeScales.size());
+            outFrame.m_nodeScales.resize(udwNumScales);
+            for (u32 i = 0; i < udwNumScales; ++i)
+            {
+                outFrame.m_nodeScales[i] = Core::MathUtils::Lerp(infInterpFactor, inFrameA.m_nodeScales[i], inFrameB.m_nodeScales[i]);
             }
-			
-			return SkinnedAnimation::FrameCUPtr(std::move(outFrame));
         }
     }
 }
@@ -182,11 +182,11 @@ namespace ChilliSource
             ///
             /// Gets the frame data from a single animation.
             ///
-            /// @param The blend type.
             /// @param the animation.
             /// @param the playback position.
+            /// @param [Out] The output frame. Its buffers are reused.
 			//----------------------------------------------------------
-            SkinnedAnimation::FrameCUPtr CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition);
+            void CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition, SkinnedAnimation::Frame& outFrame);
             //--------------------------------------------------------------
 			/// Lerp Between Frames
 			///
@@ -195,13 +195,16 @@ namespace ChilliSource
 			/// @param frame 1
 			/// @param frame 2
 			/// @param the interpolation factor
-			/// @return output interpolated frame.
+			/// @param [Out] The output interpolated frame. This may be
+			/// one of the input frames.
 			//--------------------------------------------------------------
-            SkinnedAnimation::FrameCUPtr LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor);
+            void LerpBetweenFrames(const SkinnedAnimation::Frame& inFrameA, const SkinnedAnimation::Frame& inFrameB, f32 infInterpFactor, SkinnedAnimation::Frame& outFrame);
             
             const Skeleton* mpSkeleton;
             std::vector<AnimationItemPtr> mAnimations;
-            SkinnedAnimation::FrameCUPtr mCurrentAnimationData;
+            SkinnedAnimation::Frame mCurrentAnimationData;
+            SkinnedAnimation::Frame mBlendFrameA;
+            SkinnedAnimation::Frame mBlendFrameB;
             std::vector<Core::Matrix4> mCurrentAnimationMatrices;
             bool mbAnimationLengthDirty;
             f32 mfAnimationLength;
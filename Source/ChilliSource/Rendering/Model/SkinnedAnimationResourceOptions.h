@@ -0,0 +1,117 @@
+//
+//  SkinnedAnimationResourceOptions.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_SKINNEDANIMATIONRESOURCEOPTIONS_H_
+#define _CHILLISOURCE_RENDERING_MODEL_SKINNEDANIMATIONRESOURCEOPTIONS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Resource/IResourceOptions.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //-------------------------------------------------------
+        /// Custom options for loading a skinned animation.
+        ///
+        /// If compression is enabled the key frames are quantised
+        /// to 16 bits per component once loaded, tracks which
+        /// never move further than the tolerance are collapsed to
+        /// a single value and, optionally, key frames that can be
+        /// reconstructed by interpolating their neighbours are
+        /// removed. Tolerances are the maximum allowed error per
+        /// component.
+        //-------------------------------------------------------
+		class SkinnedAnimationResourceOptions final : public Core::IResourceOptions<SkinnedAnimation>
+		{
+		public:
+            //-------------------------------------------------------
+            /// Constructor. Compression is disabled by default.
+            //-------------------------------------------------------
+            SkinnedAnimationResourceOptions() = default;
+            //-------------------------------------------------------
+            /// Constructor
+            ///
+            /// @param Whether or not the animation should be
+            /// compressed once loaded.
+            /// @param The translation tolerance.
+            /// @param The orientation tolerance.
+            /// @param The scale tolerance.
+            /// @param Whether or not key frames which can be
+            /// reconstructed within tolerance should be removed.
+            //-------------------------------------------------------
+            SkinnedAnimationResourceOptions(bool in_compressionEnabled, f32 in_translationTolerance, f32 in_orientationTolerance, f32 in_scaleTolerance, bool in_keyFrameReductionEnabled);
+            //-------------------------------------------------------
+            /// Generate a unique hash based on the
+            /// currently set options
+            ///
+            /// @return Hash of the options contents
+            //-------------------------------------------------------
+            u32 GenerateHash() const override;
+            //-------------------------------------------------------
+            /// @return Whether the animation should be compressed.
+            //-------------------------------------------------------
+            bool IsCompressionEnabled() const;
+            //-------------------------------------------------------
+            /// @return The translation tolerance.
+            //-------------------------------------------------------
+            f32 GetTranslationTolerance() const;
+            //-------------------------------------------------------
+            /// @return The orientation tolerance.
+            //-------------------------------------------------------
+            f32 GetOrientationTolerance() const;
+            //-------------------------------------------------------
+            /// @return The scale tolerance.
+            //-------------------------------------------------------
+            f32 GetScaleTolerance() const;
+            //-------------------------------------------------------
+            /// @return Whether key frame reduction is enabled.
+            //-------------------------------------------------------
+            bool IsKeyFrameReductionEnabled() const;
+        private:
+            
+            //-------------------------------------------------------
+            /// The options for loading skinned animations. These
+            /// are held in a struct to more easily allow hashing of
+            /// the data
+            //-------------------------------------------------------
+            struct Options
+            {
+                f32 m_translationTolerance = 0.001f;
+                f32 m_orientationTolerance = 0.0005f;
+                f32 m_scaleTolerance = 0.001f;
+                bool m_compressionEnabled = false;
+                bool m_keyFrameReductionEnabled = true;
+            };
+            
+            Options m_options;
+		};
+	}
+}
+
+#endif
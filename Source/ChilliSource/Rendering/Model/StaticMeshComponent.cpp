@@ -47,6 +47,7 @@ namespace ChilliSource
 	namespace Rendering
 	{
         CS_DEFINE_NAMEDTYPE(StaticMeshComponent);
+        CS_DEFINE_POOLEDTYPE(StaticMeshComponent);
         
         StaticMeshComponent::StaticMeshComponent()
         : m_isBSValid(false), m_isAABBValid(false), m_isOOBBValid(false)
@@ -274,6 +275,9 @@ namespace ChilliSource
             // Update OOBB
             mOBBoundingBox.SetSize(mpModel->GetAABB().GetSize());
             mOBBoundingBox.SetOrigin(mpModel->GetAABB().GetOrigin());
+            m_isBSValid = false;
+            m_isAABBValid = false;
+            OnVolumeChanged();
 		}
         //----------------------------------------------------------
         /// Attach Mesh
@@ -286,6 +290,9 @@ namespace ChilliSource
             // Update OOBB
             mOBBoundingBox.SetSize(mpModel->GetAABB().GetSize());
             mOBBoundingBox.SetOrigin(mpModel->GetAABB().GetOrigin());
+            m_isBSValid = false;
+            m_isAABBValid = false;
+            OnVolumeChanged();
             
             SetMaterial(inpMaterial);
         }
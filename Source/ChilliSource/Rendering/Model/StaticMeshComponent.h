@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_RENDERING_STATIC_MESH_COMPONENT_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/ObjectPool.h>
 #include <ChilliSource/Rendering/Base/RenderComponent.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
 
@@ -47,6 +48,7 @@ namespace ChilliSource
 		{
 		public:
 			CS_DECLARE_NAMEDTYPE(StaticMeshComponent);
+			CS_DECLARE_POOLEDTYPE(StaticMeshComponent);
 			
             StaticMeshComponent();
 			//----------------------------------------------------------
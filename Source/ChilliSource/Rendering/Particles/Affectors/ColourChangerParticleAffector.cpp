@@ -107,5 +107,11 @@ namespace ChilliSource
             
 			in_particle.m_colour = cColourNew *cColourNew.a;
         }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        ParticleAffectorUPtr ColourChangerParticleAffector::Clone() const
+        {
+            return ParticleAffectorUPtr(new ColourChangerParticleAffector(*this));
+        }
     }
 }
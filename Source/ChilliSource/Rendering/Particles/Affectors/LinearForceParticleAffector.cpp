@@ -93,5 +93,14 @@ namespace ChilliSource
         {
 			in_particle.m_velocity += (mvForce * infDt);
         }
+        //-----------------------------------------------------
+        /// Clone
+        ///
+        /// @return A copy of this affector in its initial state
+        //-----------------------------------------------------
+        ParticleAffectorUPtr LinearForceParticleAffector::Clone() const
+        {
+            return ParticleAffectorUPtr(new LinearForceParticleAffector(*this));
+        }
     }
 }
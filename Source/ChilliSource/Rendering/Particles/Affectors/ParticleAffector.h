@@ -72,6 +72,20 @@ namespace ChilliSource
             //-----------------------------------------------------
             virtual void Update(f32 infDt) {}
             //-----------------------------------------------------
+            /// Clone
+            ///
+            /// Particle effects create one affector from each
+            /// description when they are loaded and clone it for
+            /// every particle component, so the description is
+            /// only parsed once. Affectors which don't support
+            /// this return null and are created from the
+            /// description each time instead.
+            ///
+            /// @return A copy of this affector in its initial
+            /// state, or null.
+            //-----------------------------------------------------
+            virtual ParticleAffectorUPtr Clone() const {return nullptr;}
+            //-----------------------------------------------------
             /// Set Active Energy Level
             ///
             /// The energy level at which the affector becomes
@@ -107,5 +107,11 @@ namespace ChilliSource
             Core::Vector2 vDiff = (mvTargetScale - mvInitialScale) * (1.0f - fEnergy);
             in_particle.m_scale = mvInitialScale + vDiff;
         }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        ParticleAffectorUPtr ScalerParticleAffector::Clone() const
+        {
+            return ParticleAffectorUPtr(new ScalerParticleAffector(*this));
+        }
     }
 }
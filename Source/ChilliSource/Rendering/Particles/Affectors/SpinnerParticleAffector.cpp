@@ -94,5 +94,11 @@ namespace ChilliSource
         {
             in_particle.m_angularRotation +=  mfAngVelocity * infDt;
         }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        ParticleAffectorUPtr SpinnerParticleAffector::Clone() const
+        {
+            return ParticleAffectorUPtr(new SpinnerParticleAffector(*this));
+        }
     }
 }
@@ -69,6 +69,10 @@ namespace ChilliSource
             /// @param Time between frames
             //-----------------------------------------------------
             void Apply(Particle& in_particle, f32 infDt);
+            //-----------------------------------------------------
+            /// @return A copy of this affector in its initial state
+            //-----------------------------------------------------
+            ParticleAffectorUPtr Clone() const override;
             
         private:
             
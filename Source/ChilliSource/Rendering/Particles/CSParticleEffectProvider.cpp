@@ -31,6 +31,10 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Container/ParamDictionary.h>
 #include <ChilliSource/Core/Container/ParamDictionarySerialiser.h>
+#include <ChilliSource/Core/File/BinaryReader.h>
+#include <ChilliSource/Core/File/BinaryWriter.h>
+#include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
@@ -39,6 +43,8 @@
 #include <ChilliSource/Rendering/Particles/ParticleEffect.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
+#include <atomic>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -47,93 +53,269 @@ namespace ChilliSource
         {
             const std::string k_fileExtension("csparticle");
             
+            const u32 k_cookedEffectMagic = 0x45505343; //"CSPE"
+            const u32 k_cookedEffectVersion = 1;
+            
+            //-------------------------------------------------------
+            /// The contents of a particle effect file prior to the
+            /// material and atlas being loaded.
+            //-------------------------------------------------------
+            struct EffectDesc
+            {
+                Core::StorageLocation m_materialLocation = Core::StorageLocation::k_package;
+                std::string m_materialPath;
+                bool m_hasAtlas = false;
+                Core::StorageLocation m_atlasLocation = Core::StorageLocation::k_package;
+                std::string m_atlasPath;
+                std::string m_atlasId;
+                std::vector<Core::ParamDictionary> m_emitterDescs;
+                std::vector<Core::ParamDictionary> m_affectorDescs;
+            };
+            //-------------------------------------------------------
+            /// The shared state of the parallel material and atlas
+            /// loads performed when loading an effect asynchronously.
+            //-------------------------------------------------------
+            struct EffectLoadState
+            {
+                EffectDesc m_desc;
+                MaterialCSPtr m_material;
+                TextureAtlasCSPtr m_atlas;
+                std::atomic<u32> m_numRemaining;
+                std::atomic<bool> m_hasFailed;
+            };
             //-------------------------------------------------------
-            /// Load the texture atlas and id from the particle
-            /// effect root
+            /// Load the descriptions of the child elements with the
+            /// given name from the given parent element.
             ///
             /// @author S Downie
             ///
             /// @param Root element
+            /// @param Parent element name
+            /// @param Child element name
             ///
-            /// @return Pair <Atlas, Id>
+            /// @return List of descs
             //-------------------------------------------------------
-            std::pair<TextureAtlasCSPtr, std::string> LoadTextureAtlas(Core::XML::Node* in_root)
+            std::vector<Core::ParamDictionary> LoadParamDictionaries(Core::XML::Node* in_root, const std::string& in_parentName, const std::string& in_childName)
             {
-                std::pair<TextureAtlasCSPtr, std::string> result;
+                std::vector<Core::ParamDictionary> descs;
                 
-                Core::ResourcePool* resourcePool = Core::Application::Get()->GetResourcePool();
+                Core::XML::Node* parentEl = Core::XMLUtils::GetFirstChildElement(in_root, in_parentName);
+                if(parentEl == nullptr)
+                {
+                    return descs;
+                }
                 
-                Core::XML::Node* atlasEl = Core::XMLUtils::GetFirstChildElement(in_root, "atlas");
-                if(atlasEl != nullptr)
+                Core::XML::Node* childEl = Core::XMLUtils::GetFirstChildElement(parentEl, in_childName);
+                while(childEl)
                 {
-                    result.first = resourcePool->LoadResource<TextureAtlas>(Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(atlasEl, "location", "Package")), Core::XMLUtils::GetAttributeValue<std::string>(atlasEl, "filename", ""));
-                    result.second = Core::XMLUtils::GetAttributeValue<std::string>(atlasEl, "id", "");
+                    //Get the param dictionary config values
+                    Core::ParamDictionary params = Core::ParamDictionarySerialiser::FromString(Core::XMLUtils::GetValue(childEl));
+                    
+                    descs.push_back(std::move(params));
+                    
+                    childEl = Core::XMLUtils::GetNextSiblingElement(childEl, in_childName);
                 }
                 
-                return result;
+                return descs;
             }
             //-------------------------------------------------------
-            /// Load the descriptions of the emitters from the
-            /// effect root
-            ///
-            /// @author S Downie
+            /// Reads the effect description from the XML effect
+            /// root element.
             ///
             /// @param Root element
+            /// @param File path, used for error messages
+            /// @param [Out] Effect description to populate
             ///
-            /// @return List of emitter descs
+            /// @return Whether the description was read.
             //-------------------------------------------------------
-            std::vector<Core::ParamDictionary> LoadEmitterDescs(Core::XML::Node* in_root)
+            bool ReadEffectDesc(Core::XML::Node* in_root, const std::string& in_filePath, EffectDesc& out_desc)
             {
-                std::vector<Core::ParamDictionary> emitterDescs;
+                if(Core::XMLUtils::GetName(in_root) != "effect")
+                {
+                    CS_LOG_ERROR("Failed to load particle effect due to incorrect file format " + in_filePath);
+                    return false;
+                }
                 
-                Core::XML::Node* emittersEl = Core::XMLUtils::GetFirstChildElement(in_root, "emitters");
-                if(emittersEl == nullptr)
+                Core::XML::Node* materialEl = Core::XMLUtils::GetFirstChildElement(in_root, "material");
+                if(materialEl == nullptr)
                 {
-                    return emitterDescs;
+                    CS_LOG_ERROR("Failed to load particle effect due to missing material " + in_filePath);
+                    return false;
                 }
                 
-                Core::XML::Node* emitterEl = Core::XMLUtils::GetFirstChildElement(emittersEl, "emitter");
-                while(emitterEl)
+                out_desc.m_materialLocation = Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(materialEl, "location", "Package"));
+                out_desc.m_materialPath = Core::XMLUtils::GetAttributeValue<std::string>(materialEl, "filename", "");
+                
+                Core::XML::Node* atlasEl = Core::XMLUtils::GetFirstChildElement(in_root, "atlas");
+                if(atlasEl != nullptr)
                 {
-                    //Get the param dictionary config values
-                    Core::ParamDictionary params = Core::ParamDictionarySerialiser::FromString(Core::XMLUtils::GetValue(emitterEl));
-                    
-                    emitterDescs.push_back(std::move(params));
-                    
-                    emitterEl = Core::XMLUtils::GetNextSiblingElement(emitterEl, "emitter");
+                    out_desc.m_hasAtlas = true;
+                    out_desc.m_atlasLocation = Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(atlasEl, "location", "Package"));
+                    out_desc.m_atlasPath = Core::XMLUtils::GetAttributeValue<std::string>(atlasEl, "filename", "");
+                    out_desc.m_atlasId = Core::XMLUtils::GetAttributeValue<std::string>(atlasEl, "id", "");
                 }
                 
-                return emitterDescs;
+                out_desc.m_emitterDescs = LoadParamDictionaries(in_root, "emitters", "emitter");
+                out_desc.m_affectorDescs = LoadParamDictionaries(in_root, "affectors", "affector");
+                return true;
+            }
+            //-------------------------------------------------------
+            /// @param The binary reader.
+            /// @param [Out] The param dictionaries.
+            //-------------------------------------------------------
+            void ReadParamDictionaries(Core::BinaryReader& in_reader, std::vector<Core::ParamDictionary>& out_dictionaries)
+            {
+                u32 numDictionaries = in_reader.Read<u32>();
+                for(u32 i = 0; i < numDictionaries && in_reader.IsBad() == false; ++i)
+                {
+                    Core::ParamDictionary params;
+                    u32 numValues = in_reader.Read<u32>();
+                    for(u32 j = 0; j < numValues && in_reader.IsBad() == false; ++j)
+                    {
+                        std::string key = in_reader.ReadString();
+                        params.SetValue(key, in_reader.ReadString());
+                    }
+                    out_dictionaries.push_back(std::move(params));
+                }
             }
             //-------------------------------------------------------
-            /// Load the descriptions of the affectors from the
-            /// effect root
+            /// Reads the effect description from a cooked effect.
+            /// The reader should be positioned after the header.
             ///
-            /// @author S Downie
+            /// @param The binary reader.
+            /// @param [Out] Effect description to populate
+            //-------------------------------------------------------
+            void ReadEffectDesc(Core::BinaryReader& in_reader, EffectDesc& out_desc)
+            {
+                out_desc.m_materialLocation = Core::StorageLocation(in_reader.Read<u32>());
+                out_desc.m_materialPath = in_reader.ReadString();
+                out_desc.m_hasAtlas = (in_reader.Read<u8>() != 0);
+                out_desc.m_atlasLocation = Core::StorageLocation(in_reader.Read<u32>());
+                out_desc.m_atlasPath = in_reader.ReadString();
+                out_desc.m_atlasId = in_reader.ReadString();
+                ReadParamDictionaries(in_reader, out_desc.m_emitterDescs);
+                ReadParamDictionaries(in_reader, out_desc.m_affectorDescs);
+            }
+            //-------------------------------------------------------
+            /// @param The param dictionaries.
+            /// @param The binary writer.
+            //-------------------------------------------------------
+            void WriteParamDictionaries(const std::vector<Core::ParamDictionary>& in_dictionaries, Core::BinaryWriter& in_writer)
+            {
+                in_writer.Write(u32(in_dictionaries.size()));
+                for(const auto& params : in_dictionaries)
+                {
+                    in_writer.Write(u32(params.size()));
+                    for(const auto& param : params)
+                    {
+                        in_writer.WriteString(param.first);
+                        in_writer.WriteString(param.second);
+                    }
+                }
+            }
+            //-------------------------------------------------------
+            /// Writes the effect description in the cooked effect
+            /// format, excluding the header.
             ///
-            /// @param Root element
+            /// @param The effect description.
+            /// @param The binary writer.
+            //-------------------------------------------------------
+            void WriteEffectDesc(const EffectDesc& in_desc, Core::BinaryWriter& in_writer)
+            {
+                in_writer.Write(u32(in_desc.m_materialLocation));
+                in_writer.WriteString(in_desc.m_materialPath);
+                in_writer.Write(u8(in_desc.m_hasAtlas ? 1 : 0));
+                in_writer.Write(u32(in_desc.m_atlasLocation));
+                in_writer.WriteString(in_desc.m_atlasPath);
+                in_writer.WriteString(in_desc.m_atlasId);
+                WriteParamDictionaries(in_desc.m_emitterDescs, in_writer);
+                WriteParamDictionaries(in_desc.m_affectorDescs, in_writer);
+            }
+            //-------------------------------------------------------
+            /// Reads the effect description from file. Cooked effects
+            /// are identified by their header rather than their
+            /// extension, anything else is parsed as XML.
+            ///
+            /// @param The storage location to load from
+            /// @param File path
+            /// @param [Out] Effect description to populate
             ///
-            /// @return List of affector descs
+            /// @return Whether the description was read.
             //-------------------------------------------------------
-            std::vector<Core::ParamDictionary> LoadAffectorDescs(Core::XML::Node* in_root)
+            bool ReadEffectDesc(Core::StorageLocation in_location, const std::string& in_filePath, EffectDesc& out_desc)
             {
-                std::vector<Core::ParamDictionary> affectorDescs;
-                Core::XML::Node* affectorsEl = Core::XMLUtils::GetFirstChildElement(in_root, "affectors");
-                if(affectorsEl)
+                Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, Core::FileMode::k_readBinary);
+                if(stream == nullptr || stream->IsOpen() == false || stream->IsBad() == true)
+                {
+                    CS_LOG_ERROR("Failed to open particle effect file " + in_filePath);
+                    return false;
+                }
+                
+                Core::BinaryReader reader(stream);
+                if(reader.GetRemaining() >= sizeof(u32) * 2 && reader.Read<u32>() == k_cookedEffectMagic)
                 {
-                    Core::XML::Node* affectorEl = Core::XMLUtils::GetFirstChildElement(affectorsEl, "affector");
-                    while(affectorEl)
+                    if(reader.Read<u32>() != k_cookedEffectVersion)
                     {
-                        //Get the param dictionary config values
-                        Core::ParamDictionary params = Core::ParamDictionarySerialiser::FromString(Core::XMLUtils::GetValue(affectorEl));
-                        
-                        affectorDescs.push_back(params);
-                        
-                        affectorEl = Core::XMLUtils::GetNextSiblingElement(affectorEl, "affector");
+                        CS_LOG_ERROR("Unsupported cooked particle effect version in " + in_filePath);
+                        return false;
                     }
+                    
+                    ReadEffectDesc(reader, out_desc);
+                    if(reader.IsBad() == true)
+                    {
+                        CS_LOG_ERROR("Cooked particle effect is corrupt " + in_filePath);
+                        return false;
+                    }
+                    return true;
                 }
                 
-                return affectorDescs;
+                Core::XMLUPtr xml = Core::XMLUtils::ReadDocument(in_location, in_filePath);
+                Core::XML::Node* root = (xml != nullptr) ? Core::XMLUtils::GetFirstChildElement(xml->GetDocument()) : nullptr;
+                if(root == nullptr)
+                {
+                    CS_LOG_ERROR("Failed to open particle effect file " + in_filePath);
+                    return false;
+                }
+                
+                return ReadEffectDesc(root, in_filePath, out_desc);
+            }
+            //-------------------------------------------------------
+            /// Called as the material and atlas loads complete. Once
+            /// both have completed the effect is built on a background
+            /// thread and the completion delegate is called on the
+            /// main thread.
+            ///
+            /// Resource pool delegates can be called on the thread
+            /// that requested the load as well as the main thread,
+            /// so the counter is atomic.
+            ///
+            /// @param The shared load state
+            /// @param Completion delegate
+            /// @param [Out] Resource object
+            //-------------------------------------------------------
+            void OnDependencyLoaded(const std::shared_ptr<EffectLoadState>& in_state, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
+            {
+                if(--in_state->m_numRemaining != 0)
+                {
+                    return;
+                }
+                
+                if(in_state->m_hasFailed == true)
+                {
+                    CS_LOG_ERROR("Failed to load particle effect due to missing material");
+                    
+                    out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
+                    Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+                    return;
+                }
+                
+                Core::Application::Get()->GetTaskScheduler()->ScheduleTask([in_state, in_delegate, out_resource]()
+                {
+                    ParticleEffect* effectResource = (ParticleEffect*)out_resource.get();
+                    effectResource->Build(std::move(in_state->m_desc.m_emitterDescs), std::move(in_state->m_desc.m_affectorDescs), in_state->m_material, in_state->m_atlas, std::move(in_state->m_desc.m_atlasId));
+                    effectResource->SetLoadState(Core::Resource::LoadState::k_loaded);
+                    Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+                });
             }
         }
         
@@ -165,58 +347,66 @@ namespace ChilliSource
 		}
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
-		void CSParticleEffectProvider::CreateResourceFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceSPtr& out_resource)
-		{
-            Core::XMLUPtr xml = Core::XMLUtils::ReadDocument(in_location, in_filePath);
-			
-			Core::XML::Node* root = Core::XMLUtils::GetFirstChildElement(xml->GetDocument());
-			
-            if(root == nullptr)
+        bool CSParticleEffectProvider::CookParticleEffect(Core::StorageLocation in_sourceLocation, const std::string& in_sourcePath, Core::StorageLocation in_destLocation, const std::string& in_destPath)
+        {
+            EffectDesc desc;
+            if(ReadEffectDesc(in_sourceLocation, in_sourcePath, desc) == false)
             {
-                CS_LOG_ERROR("Failed to open particle effect file " + in_filePath);
-                out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
-                return;
+                CS_LOG_ERROR("Cannot cook particle effect as it could not be read: " + in_sourcePath);
+                return false;
             }
-            else if(Core::XMLUtils::GetName(root) != "effect")
+            
+            Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_destLocation, in_destPath, Core::FileMode::k_writeBinary);
+            Core::BinaryWriter writer(stream);
+            if(writer.IsBad() == true)
+            {
+                CS_LOG_ERROR("Cannot open cooked particle effect for writing: " + in_destPath);
+                return false;
+            }
+            
+            writer.Write(k_cookedEffectMagic);
+            writer.Write(k_cookedEffectVersion);
+            WriteEffectDesc(desc, writer);
+            
+            bool success = (writer.IsBad() == false);
+            stream->Close();
+            return success;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+		void CSParticleEffectProvider::CreateResourceFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceSPtr& out_resource)
+		{
+            EffectDesc desc;
+            if(ReadEffectDesc(in_location, in_filePath, desc) == false)
             {
-                CS_LOG_ERROR("Failed to load particle effect due to incorrect file format " + in_filePath);
                 out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
                 return;
             }
             
-            //---Load the material
-            Core::XML::Node* materialEl = Core::XMLUtils::GetFirstChildElement(root, "material");
-            if(materialEl == nullptr)
+            if(desc.m_emitterDescs.empty() == true)
             {
-                CS_LOG_ERROR("Failed to load particle effect due to missing material " + in_filePath);
+                CS_LOG_ERROR("Failed to load particle effect as it requires at least one emitter");
                 out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
                 return;
             }
             
             Core::ResourcePool* resourcePool = Core::Application::Get()->GetResourcePool();
-            MaterialCSPtr material = resourcePool->LoadResource<Material>(Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(materialEl, "location", "Package")),
-                                                                          Core::XMLUtils::GetAttributeValue<std::string>(materialEl, "filename", ""));
-
+            MaterialCSPtr material = resourcePool->LoadResource<Material>(desc.m_materialLocation, desc.m_materialPath);
             if(material == nullptr || material->GetLoadState() == Core::Resource::LoadState::k_failed)
             {
                 CS_LOG_ERROR("Failed to load particle effect due to missing material");
                 out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
                 return;
             }
-  
-            auto emitterDescs = LoadEmitterDescs(root);
-            if(emitterDescs.empty() == true)
+            
+            TextureAtlasCSPtr atlas;
+            if(desc.m_hasAtlas == true)
             {
-                CS_LOG_ERROR("Failed to load particle effect as it requires at least one emitter");
-                out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
-                return;
+                atlas = resourcePool->LoadResource<TextureAtlas>(desc.m_atlasLocation, desc.m_atlasPath);
             }
             
-            auto atlasDesc = LoadTextureAtlas(root);
-            auto affectorDescs = LoadAffectorDescs(root);
-            
             ParticleEffect* effectResource = (ParticleEffect*)out_resource.get();
-            effectResource->Build(std::move(emitterDescs), std::move(affectorDescs), material, atlasDesc.first, std::move(atlasDesc.second));
+            effectResource->Build(std::move(desc.m_emitterDescs), std::move(desc.m_affectorDescs), material, atlas, std::move(desc.m_atlasId));
             effectResource->SetLoadState(Core::Resource::LoadState::k_loaded);
 		}
         //----------------------------------------------------------------------------
@@ -230,75 +420,49 @@ namespace ChilliSource
         //----------------------------------------------------------------------------
 		void CSParticleEffectProvider::LoadResourceAsync(Core::StorageLocation in_location, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
         {
-            auto LoadingError = [&in_filePath, &in_delegate, &out_resource](const std::string& in_msg)
+            auto state = std::make_shared<EffectLoadState>();
+            if(ReadEffectDesc(in_location, in_filePath, state->m_desc) == false)
             {
-                CS_LOG_ERROR(in_msg + " " + in_filePath);
-                
                 out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
                 Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
-            };
-            
-            //We need to create the document on the heap as it is required by other async functions
-            Core::XMLSPtr xml = Core::XMLUtils::ReadDocument(in_location, in_filePath);
-			
-			Core::XML::Node* root = Core::XMLUtils::GetFirstChildElement(xml->GetDocument());
-			
-            if(root == nullptr)
-            {
-                LoadingError("Failed to open particle effect file");
-                return;
-            }
-            else if(Core::XMLUtils::GetName(root) != "effect")
-            {
-                LoadingError("Failed to load particle effect due to incorrect file format");
                 return;
             }
             
-            //---Load the material
-            Core::XML::Node* materialEl = Core::XMLUtils::GetFirstChildElement(root, "material");
-            if(materialEl == nullptr)
+            if(state->m_desc.m_emitterDescs.empty() == true)
             {
-                LoadingError("Failed to load particle effect due to missing material");
+                CS_LOG_ERROR("Failed to load particle effect as it requires at least one emitter " + in_filePath);
+                out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
+                Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
                 return;
             }
             
+            //The material and atlas are independent so are loaded in parallel. The counter must be
+            //set before either load is requested as the delegates can be called immediately.
+            state->m_numRemaining = state->m_desc.m_hasAtlas ? 2 : 1;
+            state->m_hasFailed = false;
+            
             Core::ResourcePool* resourcePool = Core::Application::Get()->GetResourcePool();
-            resourcePool->LoadResourceAsync<Material>(Core::ParseStorageLocation(Core::XMLUtils::GetAttributeValue<std::string>(materialEl, "location", "Package")),
-                                                      Core::XMLUtils::GetAttributeValue<std::string>(materialEl, "filename", ""),
-            [xml, root, in_delegate, out_resource](const MaterialCSPtr& in_material)
+            resourcePool->LoadResourceAsync<Material>(state->m_desc.m_materialLocation, state->m_desc.m_materialPath, [state, in_delegate, out_resource](const MaterialCSPtr& in_material)
             {
-                //This lambda is executed on the main thread so we don't need to explicitly kick off a main thread task
                 if(in_material == nullptr || in_material->GetLoadState() == Core::Resource::LoadState::k_failed)
                 {
-                    CS_LOG_ERROR("Failed to load particle effect due to missing material");
-                    
-                    out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
-                    in_delegate(out_resource);
-                    return;
+                    state->m_hasFailed = true;
                 }
-                
-                //We now need to kick off another async task to load the rest of the effect
-                Core::Application::Get()->GetTaskScheduler()->ScheduleTask([xml, root, in_delegate, in_material, out_resource]()
+                else
                 {
-                    auto emitterDescs = LoadEmitterDescs(root);
-                    if(emitterDescs.empty() == true)
-                    {
-                        CS_LOG_ERROR("Failed to load particle effect as it requires at least one emitter");
-                        
-                        out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
-                        Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
-                        return;
-                    }
-                    auto atlasDesc = LoadTextureAtlas(root);
-                    auto affectorDescs = LoadAffectorDescs(root);
-                    
-                    ParticleEffect* effectResource = (ParticleEffect*)out_resource.get();
-                    effectResource->Build(std::move(emitterDescs), std::move(affectorDescs), in_material, atlasDesc.first, std::move(atlasDesc.second));
-                    effectResource->SetLoadState(Core::Resource::LoadState::k_loaded);
-                    Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
-                });
+                    state->m_material = in_material;
+                }
+                OnDependencyLoaded(state, in_delegate, out_resource);
             });
+            
+            if(state->m_desc.m_hasAtlas == true)
+            {
+                resourcePool->LoadResourceAsync<TextureAtlas>(state->m_desc.m_atlasLocation, state->m_desc.m_atlasPath, [state, in_delegate, out_resource](const TextureAtlasCSPtr& in_atlas)
+                {
+                    state->m_atlas = in_atlas;
+                    OnDependencyLoaded(state, in_delegate, out_resource);
+                });
+            }
         }
 	}
 }
-
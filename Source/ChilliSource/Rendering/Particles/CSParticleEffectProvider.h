@@ -80,6 +80,20 @@ namespace ChilliSource
 			/// @return Whether the object can create a resource with the given extension
 			//----------------------------------------------------------------------------
 			bool CanCreateResourceWithFileExtension(const std::string& in_extension) const override;
+            //----------------------------------------------------------------------------
+            /// Converts a particle effect file to the cooked binary effect format.
+            /// Cooked effects use the same extension and are identified by their
+            /// header, so they can be loaded in place of the XML without any XML
+            /// or param dictionary string parsing.
+            ///
+            /// @param The storage location of the effect file.
+            /// @param The file path of the effect file.
+            /// @param The storage location to write the cooked effect.
+            /// @param The file path to write the cooked effect.
+            ///
+            /// @return Whether or not the effect was cooked.
+            //----------------------------------------------------------------------------
+            static bool CookParticleEffect(Core::StorageLocation in_sourceLocation, const std::string& in_sourcePath, Core::StorageLocation in_destLocation, const std::string& in_destPath);
 			
 		private:
             //-------------------------------------------------------
@@ -39,8 +39,8 @@ namespace ChilliSource
         ///
         /// @param Param Dictionary
         //-------------------------------------------------------------
-        ConeParticleEmitter::ConeParticleEmitter(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
-        :ParticleEmitter(inParams, inpMaterial, inpComponent)
+        ConeParticleEmitter::ConeParticleEmitter(const Core::ParamDictionary& inParams, const ParticleEmitterProperties& in_properties, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
+        :ParticleEmitter(in_properties, inpMaterial, inpComponent)
         {
             std::string strTemp;
             
@@ -61,13 +61,14 @@ namespace ChilliSource
         /// Create a new emitter from the given parameters
         ///
         /// @param Param dictionary
+        /// @param Common emitter properties
         /// @param Material
         /// @param Owning system
         /// @return Ownership of point emitter
         //-----------------------------------------------------
-        ParticleEmitterUPtr ConeParticleEmitter::Create(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
+        ParticleEmitterUPtr ConeParticleEmitter::Create(const Core::ParamDictionary& inParams, const ParticleEmitterProperties& in_properties, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
         {
-            return ParticleEmitterUPtr(new ConeParticleEmitter(inParams, inpMaterial, inpComponent));
+            return ParticleEmitterUPtr(new ConeParticleEmitter(inParams, in_properties, inpMaterial, inpComponent));
         }
 		//-----------------------------------------------------
 		//-----------------------------------------------------
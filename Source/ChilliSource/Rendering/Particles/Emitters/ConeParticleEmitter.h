@@ -39,7 +39,7 @@ namespace ChilliSource
         class ConeParticleEmitter : public ParticleEmitter
         {
         public:
-            ConeParticleEmitter(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent);
+            ConeParticleEmitter(const Core::ParamDictionary& inParams, const ParticleEmitterProperties& in_properties, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent);
             
             //-----------------------------------------------------
             /// Create
@@ -47,11 +47,12 @@ namespace ChilliSource
             /// Create a new emitter from the given parameters
             ///
             /// @param Param dictionary
+            /// @param Common emitter properties
             /// @param Material
             /// @param Owning system
             /// @return Ownership of point emitter
             //-----------------------------------------------------
-            static ParticleEmitterUPtr Create(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent);
+            static ParticleEmitterUPtr Create(const Core::ParamDictionary& inParams, const ParticleEmitterProperties& in_properties, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent);
             
         private:
             //-----------------------------------------------------
@@ -44,68 +44,86 @@ namespace ChilliSource
     namespace Rendering
     {
         //-------------------------------------------------------------
-        /// Constructor
-        ///
-        /// @param Param Dictionary
         //-------------------------------------------------------------
-        ParticleEmitter::ParticleEmitter(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
-        : mudwMaxNumParticles(100), mudwMaxNumParticlesPerEmission(1), mfEmissionFreq(0.5f), mfCurrentTime(0.0f), mfLastEmissionTime(0.0f), mfTimeToLive(1.0f), mvInitialScale(1.0f, 1.0f), mbShouldLoop(true)
-        ,mfEnergyLoss(1.0f/mfTimeToLive), mpOwningComponent(inpComponent), mbIsEmitting(true), mudwNumUsed(0), mpMaterial(inpMaterial),msParticleUVs(0.0f, 0.0f, 1.0f, 1.0f)
-		,mudwBurstCounter(0), mbIsEmittingFinished(false)
-        ,mbIsGlobalSpace(true)
+        ParticleEmitterProperties ParticleEmitter::ParseProperties(const Core::ParamDictionary& in_params)
         {
+            ParticleEmitterProperties properties;
             std::string strTemp;
             
             //Frequency
-            if(inParams.TryGetValue("Frequency", strTemp))
+            if(in_params.TryGetValue("Frequency", strTemp))
             {
-                mfEmissionFreq = Core::ParseF32(strTemp);
-                CS_ASSERT(mfEmissionFreq > 0.0f, "Frequency cannot be zero or less");
-                
-                mfCurrentTime = mfEmissionFreq;
+                properties.m_emissionFrequency = Core::ParseF32(strTemp);
+                properties.m_isFrequencySpecified = true;
+                CS_ASSERT(properties.m_emissionFrequency > 0.0f, "Frequency cannot be zero or less");
             }
             //Looping
-            if(inParams.TryGetValue("IsLooping", strTemp))
+            if(in_params.TryGetValue("IsLooping", strTemp))
             {
-                mbShouldLoop = Core::ParseBool(strTemp);
+                properties.m_isLooping = Core::ParseBool(strTemp);
             }
             //Lifetime in seconds
-            if(inParams.TryGetValue("Lifetime", strTemp))
+            if(in_params.TryGetValue("Lifetime", strTemp))
             {
-                f32 fTimeToLive = Core::ParseF32(strTemp);
-                SetLifetime(fTimeToLive);
+                properties.m_lifetime = Core::ParseF32(strTemp);
             }
             //Colour
-            if(inParams.TryGetValue("InitColour", strTemp))
+            if(in_params.TryGetValue("InitColour", strTemp))
             {
-                mInitialColour = Core::ParseColour(strTemp);
+                properties.m_initialColour = Core::ParseColour(strTemp);
             }
             //Velocity
-            if(inParams.TryGetValue("InitVelocity", strTemp))
+            if(in_params.TryGetValue("InitVelocity", strTemp))
             {
-                mfInitialVelocity = Core::ParseF32(strTemp);
-                mfMinInitialVelocity = mfInitialVelocity;
+                properties.m_initialVelocity = Core::ParseF32(strTemp);
+                properties.m_minInitialVelocity = properties.m_initialVelocity;
             }
             //Min Init Velocity
-            if(inParams.TryGetValue("MinInitVelocity", strTemp))
+            if(in_params.TryGetValue("MinInitVelocity", strTemp))
             {
-                mfMinInitialVelocity = Core::ParseF32(strTemp);
+                properties.m_minInitialVelocity = Core::ParseF32(strTemp);
             }
             //Scale
-            if(inParams.TryGetValue("InitScale", strTemp))
+            if(in_params.TryGetValue("InitScale", strTemp))
             {
-                mvInitialScale = Core::ParseVector2(strTemp);
+                properties.m_initialScale = Core::ParseVector2(strTemp);
             }
             //Num per emission
-            if(inParams.TryGetValue("ParticlesPerEmit", strTemp))
+            if(in_params.TryGetValue("ParticlesPerEmit", strTemp))
             {
-                mudwMaxNumParticlesPerEmission = Core::ParseU32(strTemp);
+                properties.m_particlesPerEmission = Core::ParseU32(strTemp);
             }
             // Global space
-            if(inParams.TryGetValue("GlobalSpace", strTemp))
+            if(in_params.TryGetValue("GlobalSpace", strTemp))
+            {
+                properties.m_isGlobalSpace = Core::ParseBool(strTemp);
+            }
+            
+            return properties;
+        }
+        //-------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @param Param Dictionary
+        //-------------------------------------------------------------
+        ParticleEmitter::ParticleEmitter(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
+        : ParticleEmitter(ParseProperties(inParams), inpMaterial, inpComponent)
+        {
+        }
+        //-------------------------------------------------------------
+        //-------------------------------------------------------------
+        ParticleEmitter::ParticleEmitter(const ParticleEmitterProperties& in_properties, const MaterialCSPtr& in_material, ParticleComponent* in_component)
+        : mudwMaxNumParticles(100), mudwMaxNumParticlesPerEmission(in_properties.m_particlesPerEmission), mfEmissionFreq(in_properties.m_emissionFrequency), mfCurrentTime(0.0f), mfLastEmissionTime(0.0f), mfTimeToLive(1.0f), mvInitialScale(in_properties.m_initialScale), mbShouldLoop(in_properties.m_isLooping)
+        ,mfEnergyLoss(1.0f/mfTimeToLive), mpOwningComponent(in_component), mbIsEmitting(true), mudwNumUsed(0), mpMaterial(in_material),msParticleUVs(0.0f, 0.0f, 1.0f, 1.0f)
+		,mudwBurstCounter(0), mbIsEmittingFinished(false)
+        ,mbIsGlobalSpace(in_properties.m_isGlobalSpace), mInitialColour(in_properties.m_initialColour)
+        ,mfInitialVelocity(in_properties.m_initialVelocity), mfMinInitialVelocity(in_properties.m_minInitialVelocity)
+        {
+            if(in_properties.m_isFrequencySpecified == true)
             {
-                mbIsGlobalSpace = Core::ParseBool(strTemp);
+                mfCurrentTime = mfEmissionFreq;
             }
+            SetLifetime(in_properties.m_lifetime);
             
 			mudwMaxNumParticles = (u32)(std::ceil(mfTimeToLive / mfEmissionFreq) * mudwMaxNumParticlesPerEmission);
             
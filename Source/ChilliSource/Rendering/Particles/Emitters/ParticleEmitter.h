@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Rendering/Sprite/SpriteComponent.h>
 #include <ChilliSource/Core/Container/ParamDictionary.h>
+#include <ChilliSource/Rendering/Particles/Emitters/ParticleEmitterProperties.h>
 #include <ChilliSource/Rendering/Texture/UVs.h>
 
 namespace ChilliSource
@@ -52,7 +53,33 @@ namespace ChilliSource
         {
         public:
             
+            //-----------------------------------------------------
+            /// Parses the properties common to all emitter types
+            /// from the given emitter description.
+            ///
+            /// @param Param dictionary
+            ///
+            /// @return The parsed properties
+            //-----------------------------------------------------
+            static ParticleEmitterProperties ParseProperties(const Core::ParamDictionary& in_params);
+            //-----------------------------------------------------
+            /// Constructor. Parses the common properties from
+            /// the given description.
+            ///
+            /// @param Param dictionary
+            /// @param Material
+            /// @param Owning component
+            //-----------------------------------------------------
             ParticleEmitter(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent);
+            //-----------------------------------------------------
+            /// Constructor. Uses common properties which have
+            /// already been parsed.
+            ///
+            /// @param The common emitter properties
+            /// @param Material
+            /// @param Owning component
+            //-----------------------------------------------------
+            ParticleEmitter(const ParticleEmitterProperties& in_properties, const MaterialCSPtr& in_material, ParticleComponent* in_component);
             virtual ~ParticleEmitter();
             //-----------------------------------------------------
             /// Update
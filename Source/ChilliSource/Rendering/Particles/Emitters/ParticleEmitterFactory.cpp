@@ -67,6 +67,15 @@ namespace ChilliSource
         }
         //------------------------------------------------------------------
         //------------------------------------------------------------------
+        void ParticleEmitterFactory::AddCreator(const std::string& in_type, const DictionaryEmitterCreateDelegate& in_delegate)
+        {
+            AddCreator(in_type, EmitterCreateDelegate([in_delegate](const Core::ParamDictionary& in_properties, const ParticleEmitterProperties& in_commonProperties, const MaterialCSPtr& in_material, ParticleComponent* in_owner)
+            {
+                return in_delegate(in_properties, in_material, in_owner);
+            }));
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
         void ParticleEmitterFactory::RemoveAllCreators()
         {
             m_creators.clear();
@@ -74,12 +83,18 @@ namespace ChilliSource
         //------------------------------------------------------------------
         //-------------------------------------------------------------------
         ParticleEmitterUPtr ParticleEmitterFactory::CreateParticleEmitter(const std::string& in_type, const Core::ParamDictionary& in_properties, const MaterialCSPtr& in_material, ParticleComponent* in_owner) const
+        {
+            return CreateParticleEmitter(in_type, in_properties, ParticleEmitter::ParseProperties(in_properties), in_material, in_owner);
+        }
+        //------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        ParticleEmitterUPtr ParticleEmitterFactory::CreateParticleEmitter(const std::string& in_type, const Core::ParamDictionary& in_properties, const ParticleEmitterProperties& in_commonProperties, const MaterialCSPtr& in_material, ParticleComponent* in_owner) const
         {
             auto it = m_creators.find(in_type);
             
             if(it != m_creators.end())
             {
-                return (it->second)(in_properties, in_material, in_owner);
+                return (it->second)(in_properties, in_commonProperties, in_material, in_owner);
             }
             
             CS_LOG_ERROR("Cannot create particle emitter of type: " + in_type);
@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Rendering/Particles/Emitters/ParticleEmitterProperties.h>
 
 #include <functional>
 #include <unordered_map>
@@ -51,12 +52,28 @@ namespace ChilliSource
             /// @author S Downie
             ///
             /// @param Properties as key value dictionary
+            /// @param The common emitter properties, already parsed from
+            /// the dictionary
             /// @param Material
             /// @param Owning component
             ///
             /// @return New emitter
             //------------------------------------------------------------------
-            typedef std::function<ParticleEmitterUPtr(const Core::ParamDictionary&, const MaterialCSPtr&, ParticleComponent*)> EmitterCreateDelegate;
+            typedef std::function<ParticleEmitterUPtr(const Core::ParamDictionary&, const ParticleEmitterProperties&, const MaterialCSPtr&, ParticleComponent*)> EmitterCreateDelegate;
+            //------------------------------------------------------------------
+            /// Delegate method to handle the creation of emitters which parse
+            /// the common properties from the dictionary themselves. This is
+            /// the signature emitters were created with before the common
+            /// properties were parsed on load, and is still accepted so
+            /// existing emitters can be registered unchanged.
+            ///
+            /// @param Properties as key value dictionary
+            /// @param Material
+            /// @param Owning component
+            ///
+            /// @return New emitter
+            //------------------------------------------------------------------
+            typedef std::function<ParticleEmitterUPtr(const Core::ParamDictionary&, const MaterialCSPtr&, ParticleComponent*)> DictionaryEmitterCreateDelegate;
             //------------------------------------------------------------------
             /// @author S Downie
             ///
@@ -75,6 +92,15 @@ namespace ChilliSource
             //------------------------------------------------------------------
             void AddCreator(const std::string& in_type, const EmitterCreateDelegate& in_delegate);
             //------------------------------------------------------------------
+            /// Registers a new emitter factory method with the given key. The
+            /// emitter will parse the common properties from the dictionary
+            /// itself, so the already parsed properties are discarded.
+            ///
+            /// @param Type key string
+            /// @param Creation delegate
+            //------------------------------------------------------------------
+            void AddCreator(const std::string& in_type, const DictionaryEmitterCreateDelegate& in_delegate);
+            //------------------------------------------------------------------
             /// Unsubscribe all emitter factory methods
             ///
             /// @author S Downie
@@ -91,6 +117,21 @@ namespace ChilliSource
             /// @return Ownership of particle emitter of that type
             //-------------------------------------------------------------------
             ParticleEmitterUPtr CreateParticleEmitter(const std::string& in_type, const Core::ParamDictionary& in_properties, const MaterialCSPtr& in_material, ParticleComponent* in_owner) const;
+            //------------------------------------------------------------------
+            /// Construct a particle emitter from the given type and properties
+            /// where the common properties have already been parsed. This is
+            /// used when creating emitters from a particle effect, which
+            /// parses the properties of each emitter once on load.
+            ///
+            /// @param Type i.e. "Point", "Ring"
+            /// @param Param dictionary properties
+            /// @param The common emitter properties
+            /// @param Material
+            /// @param Owning particle system
+            ///
+            /// @return Ownership of particle emitter of that type
+            //-------------------------------------------------------------------
+            ParticleEmitterUPtr CreateParticleEmitter(const std::string& in_type, const Core::ParamDictionary& in_properties, const ParticleEmitterProperties& in_commonProperties, const MaterialCSPtr& in_material, ParticleComponent* in_owner) const;
             
         private:
             
@@ -0,0 +1,62 @@
+//
+//  ParticleEmitterProperties.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLES_EMITTERS_PARTICLEEMITTERPROPERTIES_H_
+#define _CHILLISOURCE_RENDERING_PARTICLES_EMITTERS_PARTICLEEMITTERPROPERTIES_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        //---------------------------------------------------------------------
+        /// The properties shared by all emitter types, already parsed from the
+        /// emitter description. A particle effect parses these once when it is
+        /// loaded and every emitter created from the effect is constructed
+        /// from the same copy, rather than each re-parsing the strings in the
+        /// description.
+        //---------------------------------------------------------------------
+        struct ParticleEmitterProperties
+        {
+            f32 m_emissionFrequency = 0.5f;
+            bool m_isFrequencySpecified = false;
+            bool m_isLooping = true;
+            f32 m_lifetime = 1.0f;
+            Core::Colour m_initialColour;
+            f32 m_initialVelocity = 0.0f;
+            f32 m_minInitialVelocity = 0.0f;
+            Core::Vector2 m_initialScale = Core::Vector2(1.0f, 1.0f);
+            u32 m_particlesPerEmission = 1;
+            bool m_isGlobalSpace = true;
+        };
+    }
+}
+
+#endif
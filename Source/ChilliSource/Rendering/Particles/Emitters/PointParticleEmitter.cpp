@@ -42,8 +42,8 @@ namespace ChilliSource
         ///
         /// @param Param Dictionary
         //-------------------------------------------------------------
-        PointParticleEmitter::PointParticleEmitter(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
-        :ParticleEmitter(inParams, inpMaterial, inpComponent)
+        PointParticleEmitter::PointParticleEmitter(const Core::ParamDictionary& inParams, const ParticleEmitterProperties& in_properties, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
+        :ParticleEmitter(in_properties, inpMaterial, inpComponent)
         {
             
         }
@@ -53,13 +53,14 @@ namespace ChilliSource
         /// Create a new emitter from the given parameters
         ///
         /// @param Param dictionary
+        /// @param Common emitter properties
         /// @param Material
         /// @param Owning system
         /// @return Ownership of point emitter
         //-----------------------------------------------------
-        ParticleEmitterUPtr PointParticleEmitter::Create(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
+        ParticleEmitterUPtr PointParticleEmitter::Create(const Core::ParamDictionary& inParams, const ParticleEmitterProperties& in_properties, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
         {
-            return ParticleEmitterUPtr(new PointParticleEmitter(inParams, inpMaterial, inpComponent));
+            return ParticleEmitterUPtr(new PointParticleEmitter(inParams, in_properties, inpMaterial, inpComponent));
         }
 		//-----------------------------------------------------
 		//-----------------------------------------------------
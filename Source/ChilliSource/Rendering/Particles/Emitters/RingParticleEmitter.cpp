@@ -43,8 +43,8 @@ namespace ChilliSource
         ///
         /// @param Param Dictionary
         //-------------------------------------------------------------
-        RingParticleEmitter::RingParticleEmitter(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
-        :ParticleEmitter(inParams, inpMaterial, inpComponent), mfRadius(1.0f)
+        RingParticleEmitter::RingParticleEmitter(const Core::ParamDictionary& inParams, const ParticleEmitterProperties& in_properties, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
+        :ParticleEmitter(in_properties, inpMaterial, inpComponent), mfRadius(1.0f)
         {
             std::string strTemp;
             
@@ -60,13 +60,14 @@ namespace ChilliSource
         /// Create a new emitter from the given parameters
         ///
         /// @param Param dictionary
+        /// @param Common emitter properties
         /// @param Material
         /// @param Owning system
         /// @return Ownership of point emitter
         //-----------------------------------------------------
-        ParticleEmitterUPtr RingParticleEmitter::Create(const Core::ParamDictionary& inParams, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
+        ParticleEmitterUPtr RingParticleEmitter::Create(const Core::ParamDictionary& inParams, const ParticleEmitterProperties& in_properties, const MaterialCSPtr &inpMaterial, ParticleComponent* inpComponent)
         {
-            return ParticleEmitterUPtr(new RingParticleEmitter(inParams, inpMaterial, inpComponent));
+            return ParticleEmitterUPtr(new RingParticleEmitter(inParams, in_properties, inpMaterial, inpComponent));
         }
 		//-----------------------------------------------------
 		//-----------------------------------------------------
@@ -36,6 +36,7 @@ namespace ChilliSource
 	namespace Rendering
 	{
         CS_DEFINE_NAMEDTYPE(ParticleComponent);
+        CS_DEFINE_POOLEDTYPE(ParticleComponent);
 		//=====================================================
 		/// Particle Component
 		///
@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_COMPONENT_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/ObjectPool.h>
 #include <ChilliSource/Rendering/Base/RenderComponent.h>
 #include <ChilliSource/Rendering/Particles/Emitters/ParticleEmitter.h>
 
@@ -51,6 +52,7 @@ namespace ChilliSource
             typedef std::function<void(ParticleComponent*)> EmittersFinishedDelegate;
 			
 			CS_DECLARE_NAMEDTYPE(ParticleComponent);
+			CS_DECLARE_POOLEDTYPE(ParticleComponent);
 			
 			ParticleComponent();
             ~ParticleComponent();
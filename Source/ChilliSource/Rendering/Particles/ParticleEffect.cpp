@@ -28,8 +28,12 @@
 
 #include <ChilliSource/Rendering/Particles/ParticleEffect.h>
 
+#include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Container/ParamDictionary.h>
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+#include <ChilliSource/Rendering/Particles/Affectors/ParticleAffector.h>
+#include <ChilliSource/Rendering/Particles/Affectors/ParticleAffectorFactory.h>
+#include <ChilliSource/Rendering/Particles/Emitters/ParticleEmitter.h>
 
 namespace ChilliSource
 {
@@ -55,7 +59,25 @@ namespace ChilliSource
                                    const TextureAtlasCSPtr& in_atlas, std::string&& in_atlasId)
         {
             m_emitterDescs = std::move(in_emitterDescs);
+            
+            m_emitterProperties.clear();
+            m_emitterProperties.reserve(m_emitterDescs.size());
+            for (const auto& emitterDesc : m_emitterDescs)
+            {
+                m_emitterProperties.push_back(ParticleEmitter::ParseProperties(emitterDesc));
+            }
+            
             m_affectorDescs = std::move(in_affectorDescs);
+            
+            m_affectorPrototypes.clear();
+            m_affectorPrototypes.reserve(m_affectorDescs.size());
+            ParticleAffectorFactory* affectorFactory = Core::Application::Get()->GetSystem<ParticleAffectorFactory>();
+            CS_ASSERT(affectorFactory != nullptr, "Particle effects require the particle affector factory.");
+            for (const auto& affectorDesc : m_affectorDescs)
+            {
+                m_affectorPrototypes.push_back(affectorFactory->CreateParticleAffector(affectorDesc.GetValue("Type"), affectorDesc));
+            }
+            
             m_material = in_material;
             m_atlas = in_atlas;
             m_atlasId = std::move(in_atlasId);
@@ -94,6 +116,14 @@ namespace ChilliSource
         }
         //---------------------------------------------------------------------
         //---------------------------------------------------------------------
+        const ParticleEmitterProperties& ParticleEffect::GetEmitterProperties(u32 in_index) const
+        {
+            CS_ASSERT(in_index < GetNumEmitters(), "Emitter index out of bounds");
+            
+            return m_emitterProperties[in_index];
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
         u32 ParticleEffect::GetNumAffectors() const
         {
             return m_affectorDescs.size();
@@ -106,5 +136,18 @@ namespace ChilliSource
             
             return m_affectorDescs[in_index];
         }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        const ParticleAffector* ParticleEffect::GetAffectorPrototype(u32 in_index) const
+        {
+            CS_ASSERT(in_index < GetNumAffectors(), "Affector index out of bounds");
+            
+            return m_affectorPrototypes[in_index].get();
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        ParticleEffect::~ParticleEffect()
+        {
+        }
 	}
 }
@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Resource/Resource.h>
+#include <ChilliSource/Rendering/Particles/Emitters/ParticleEmitterProperties.h>
 
 namespace ChilliSource
 {
@@ -103,6 +104,16 @@ namespace ChilliSource
             //---------------------------------------------------------------------
             const Core::ParamDictionary& GetEmitterDesc(u32 in_index) const;
             //---------------------------------------------------------------------
+            /// The common emitter properties are parsed from the emitter
+            /// descriptor once when the effect is built rather than each time
+            /// a particle component is created from it.
+            ///
+            /// @param Index of emitter
+            ///
+            /// @return The parsed common properties of the emitter
+            //---------------------------------------------------------------------
+            const ParticleEmitterProperties& GetEmitterProperties(u32 in_index) const;
+            //---------------------------------------------------------------------
             /// @author S Downie
             ///
             /// @return Number of affector descriptors
@@ -116,6 +127,21 @@ namespace ChilliSource
             /// @return Descriptor/Properties as key value dictionary
             //---------------------------------------------------------------------
             const Core::ParamDictionary& GetAffectorDesc(u32 in_index) const;
+            //---------------------------------------------------------------------
+            /// The affector created from the descriptor when the effect was
+            /// built. Particle components clone this rather than parsing the
+            /// descriptor again.
+            ///
+            /// @param Index of affector
+            ///
+            /// @return The prototype affector. This is null if the affector
+            /// type couldn't be created when the effect was built.
+            //---------------------------------------------------------------------
+            const ParticleAffector* GetAffectorPrototype(u32 in_index) const;
+            //---------------------------------------------------------------------
+            /// Destructor
+            //---------------------------------------------------------------------
+            ~ParticleEffect();
             
         private:
             
@@ -139,7 +165,9 @@ namespace ChilliSource
         private:
             
             std::vector<Core::ParamDictionary> m_emitterDescs;
+            std::vector<ParticleEmitterProperties> m_emitterProperties;
             std::vector<Core::ParamDictionary> m_affectorDescs;
+            std::vector<ParticleAffectorUPtr> m_affectorPrototypes;
             
             MaterialCSPtr m_material;
             TextureAtlasCSPtr m_atlas;
@@ -150,6 +150,9 @@ namespace ChilliSource
             if(!maSpriteCache.empty())
             {
 #ifdef CS_ENABLE_DEBUGSTATS
+                static const Debugging::DebugStats::CounterHandle k_spritesCounter = Debugging::DebugStats::RegisterCounter("Sprites");
+                static const Debugging::DebugStats::CounterHandle k_transparentSpritesCounter = Debugging::DebugStats::RegisterCounter("Sprites_Trans");
+                
                 if(!maRenderCommands.empty())
                 {
                     RenderCommand &sLastCommand = maRenderCommands.back();
@@ -157,11 +160,11 @@ namespace ChilliSource
                     {
                         if(sLastCommand.m_material->IsTransparencyEnabled())
                         {
-                            Core::Application::Get()->GetDebugStats()->AddToEvent("Sprites_Trans", (u32)maSpriteCache.size());
+                            Core::Application::Get()->GetDebugStats()->IncrementCounter(k_transparentSpritesCounter, (u32)maSpriteCache.size());
                         }
                         else
                         {
-                            Core::Application::Get()->GetDebugStats()->AddToEvent("Sprites", (u32)maSpriteCache.size());
+                            Core::Application::Get()->GetDebugStats()->IncrementCounter(k_spritesCounter, (u32)maSpriteCache.size());
                         }
                     }
                 }
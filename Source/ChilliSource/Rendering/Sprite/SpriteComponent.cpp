@@ -152,6 +152,7 @@ namespace ChilliSource
         }
         
         CS_DEFINE_NAMEDTYPE(SpriteComponent);
+        CS_DEFINE_POOLEDTYPE(SpriteComponent);
 		//----------------------------------------------------------
 		//----------------------------------------------------------
 		SpriteComponent::SpriteComponent()
@@ -397,6 +398,15 @@ namespace ChilliSource
 		}
         //-----------------------------------------------------------
         //-----------------------------------------------------------
+        void SpriteComponent::SetMaterial(const MaterialCSPtr& in_material)
+        {
+            RenderComponent::SetMaterial(in_material);
+            
+            OnTransformChanged();
+            SetTextureSizeCacheValid();
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
         void SpriteComponent::Render(RenderSystem* inpRenderSystem, CameraComponent* inpCam, ShaderPass ineShaderPass)
         {
             if (ineShaderPass == ShaderPass::k_ambient)
@@ -430,6 +440,8 @@ namespace ChilliSource
             m_isBSValid = false;
             m_isAABBValid = false;
             m_isOOBBValid = false;
+            
+            OnVolumeChanged();
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
@@ -473,6 +485,16 @@ namespace ChilliSource
 		{
             m_transformChangedConnection = nullptr;
 		}
+        //----------------------------------------------------
+        //----------------------------------------------------
+        void SpriteComponent::OnUpdate(f32 in_timeSinceLastUpdate)
+        {
+            if(IsTextureSizeCacheValid() == false)
+            {
+                OnTransformChanged();
+                SetTextureSizeCacheValid();
+            }
+        }
         //-----------------------------------------------------------
         /// The image from the texture atlas will have potentially
         /// been cropped by the tool. This will affect the sprites
@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Container/ObjectPool.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Rendering/Base/AlignmentAnchors.h>
 #include <ChilliSource/Rendering/Base/RenderComponent.h>
@@ -56,6 +57,7 @@ namespace ChilliSource
 		public: 
 			
 			CS_DECLARE_NAMEDTYPE(SpriteComponent);
+			CS_DECLARE_POOLEDTYPE(SpriteComponent);
             //----------------------------------------------------------------------------------------
             /// Identifiers for functions that maintain the aspect ratio of the sprite based on
             /// current size and preferred image size
@@ -260,6 +262,13 @@ namespace ChilliSource
 			/// @param Alignment (middle-centre by default)
 			//-----------------------------------------------------------
 			void SetOriginAlignment(AlignmentAnchor in_alignment);
+            //-----------------------------------------------------------
+            /// Sets the material and, as the size of the sprite may
+            /// depend on the texture, updates the bounding volumes.
+            ///
+            /// @param Handle to material
+            //-----------------------------------------------------------
+            void SetMaterial(const MaterialCSPtr& in_material) override;
 			//-----------------------------------------------------------
             /// @author S Downie
             ///
@@ -305,6 +314,15 @@ namespace ChilliSource
             /// @author S Downie
 			//----------------------------------------------------
 			void OnRemovedFromScene() override;
+            //----------------------------------------------------
+            /// Checks whether the size of the texture has changed
+            /// since the bounding volumes were last updated. This
+            /// is done every frame as a culled sprite would
+            /// otherwise never notice.
+            ///
+            /// @param Time since last update in seconds
+            //----------------------------------------------------
+            void OnUpdate(f32 in_timeSinceLastUpdate) override;
             //------------------------------------------------------------
             /// On Transform Changed
             ///